@@ -37,6 +37,8 @@
 #include <string.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -49,12 +51,38 @@
 #include "config.h"
 #include "display_task.h"
 #include "acl.h"
+#include "system.h"
+#include "boot_prof.h"
+#include "rtc_cache.h"
+#include "pm_ctl.h"
+#include "spiflash.h"
 
 static const char *TAG = "acl";
 
 const size_t sha224_len = (56 + 1);
+
+#define ACL_HASH_READ_SIZE 4096
 SemaphoreHandle_t g_acl_mutex;
+static volatile bool s_validated = false;
+
+// Hashing the stored ACL is the slowest boot stage, so it runs on the
+// application core while app_main brings the panel up on the network core;
+// the scan path tasks sharing the core are blocked this early in boot.
+// Lookups that arrive meanwhile simply wait on g_acl_mutex.
+static void acl_validate_task(void *pvParameters)
+{
+    if (acl_validate() == ESP_OK) {
+      display_acl_status(ACL_STATUS_CACHED, 100);
+    } else {
+      display_acl_status(ACL_STATUS_ERROR, 0);
+    }
+
+    s_validated = true;
+    boot_mark(BOOT_STAGE_ACL);
+    vTaskDelete(NULL);
+}
 
+// display_init() must have been called first, validation posts its result to the display
 esp_err_t acl_init(void)
 {
     g_acl_mutex = xSemaphoreCreateMutex();
@@ -63,53 +91,100 @@ esp_err_t acl_init(void)
         return ESP_FAIL;
     }
 
-    if (acl_validate() == ESP_OK) {
-      display_acl_status(ACL_STATUS_CACHED, 100);
-    } else {
-      display_acl_status(ACL_STATUS_ERROR, 0);
+    if (xTaskCreatePinnedToCore(&acl_validate_task, "acl_validate", 4096, NULL, TASK_PRIO_ACL, NULL, TASK_CORE(CORE_APP)) != pdPASS) {
+        ESP_LOGE(TAG, "Could not create ACL validation task, validating inline.");
+        acl_validate_task(NULL);
     }
 
     return ESP_OK;
 }
 
-esp_err_t acl_get_data_filename(char **s)
+// false until the boot time check of the stored ACL has finished
+bool acl_is_validated(void)
 {
-  return config_get_string("acl_file", s, "/config/acl.csv");
+  return s_validated;
 }
 
-esp_err_t acl_get_hash_filename(char **s)
+// copied out, since the caller keeps the name across an fopen() that can
+// block while the config snapshot is replaced
+void acl_get_data_filename(char *buf, size_t len)
 {
-  return config_get_string("acl_hash_file", s, "/config/acl.sha");
+  const config_t *cfg = config_acquire();
+  strlcpy(buf, cfg->acl_file, len);
+  config_release(cfg);
 }
 
-// Load the stored ACL hash from a file
+// Load the stored ACL hash from the trailer at the end of the ACL file.
+// data_len (optional) is set to the length of the list before the trailer.
 // MUST hold the g_acl_mutex before calling!
-esp_err_t acl_get_stored_hash__acl_mutex(const char* filename, char *hash)
+esp_err_t acl_get_stored_hash__acl_mutex(const char* filename, char *hash, long *data_len)
 {
+  char trailer[ACL_TRAILER_LEN + 1];
+  struct stat st;
+
+  if (stat(filename, &st) != 0 || st.st_size < ACL_TRAILER_LEN) {
+      ESP_LOGW(TAG, "no ACL file %s with a hash trailer, may not exist yet.", filename);
+      return ESP_FAIL;
+  }
+
   int fd = open(filename, O_RDONLY);
   if (fd < 0) {
-      ESP_LOGW(TAG, "can't open ACL hash file %s for read, may not exist yet.", filename);
+      ESP_LOGW(TAG, "can't open ACL file %s for read, may not exist yet.", filename);
       return ESP_FAIL;
   }
 
-  int r = read(fd, hash, sha224_len);
-  if (r < 0) {
-    ESP_LOGE(TAG, "error reading ACL hash file %s", filename);
+  if (lseek(fd, st.st_size - ACL_TRAILER_LEN, SEEK_SET) < 0 ||
+      read(fd, trailer, ACL_TRAILER_LEN) != ACL_TRAILER_LEN) {
+    ESP_LOGE(TAG, "error reading ACL hash trailer from %s", filename);
     close(fd);
     return ESP_FAIL;
   }
 
   close(fd);
 
-  // null fence for safety
+  trailer[ACL_TRAILER_LEN] = '\0';
+  if (trailer[0] != '\n' || strncmp(trailer + 1, ACL_HASH_TAG, ACL_HASH_TAG_LEN) != 0 ||
+      trailer[ACL_TRAILER_LEN - 1] != '\n') {
+    ESP_LOGW(TAG, "ACL file %s has no hash trailer", filename);
+    return ESP_FAIL;
+  }
+
+  memcpy(hash, trailer + 1 + ACL_HASH_TAG_LEN, sha224_len - 1);
   hash[sha224_len - 1] = '\0';
+  if (data_len != NULL) {
+    *data_len = st.st_size - ACL_TRAILER_LEN;
+  }
   ESP_LOGI(TAG, "Stored ACL hash is %s", hash);
   return ESP_OK;
 }
 
-// Compute the hash of the stored ACL data file
+// Load a hash from a separate hash file, as ACLs were stored before the
+// hash moved into the trailer.
+// MUST hold the g_acl_mutex before calling!
+static esp_err_t acl_get_legacy_hash__acl_mutex(const char* filename, char *hash)
+{
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+      return ESP_FAIL;
+  }
+
+  int r = read(fd, hash, sha224_len);
+  close(fd);
+  if (r < sha224_len - 1) {
+    ESP_LOGE(TAG, "error reading ACL hash file %s", filename);
+    return ESP_FAIL;
+  }
+
+  // null fence for safety
+  hash[sha224_len - 1] = '\0';
+  ESP_LOGI(TAG, "Stored ACL hash (from %s) is %s", filename, hash);
+  return ESP_OK;
+}
+
+// Compute the hash of the first data_len bytes of the stored ACL data file
+// (the whole file if data_len is negative)
 // MUST hold the g_acl_mutex before calling!
-esp_err_t acl_compute_stored_hash__acl_mutex(const char* filename, char *hash)
+esp_err_t acl_compute_stored_hash__acl_mutex(const char* filename, long data_len, char *hash)
 {
   mbedtls_md_context_t md_ctx;
 
@@ -126,15 +201,23 @@ esp_err_t acl_compute_stored_hash__acl_mutex(const char* filename, char *hash)
       return ESP_FAIL;
   }
 
-  unsigned char *buf = malloc(256);
+  // read whole FAT sectors; 256 byte reads made this the slowest boot stage
+  unsigned char *buf = malloc(ACL_HASH_READ_SIZE);
   int r = -1;
   while (1) {
-    r = read(fd, buf, 256);
+    size_t want = ACL_HASH_READ_SIZE;
+    if (data_len >= 0 && data_len < want) {
+      want = data_len;
+    }
+    r = (want == 0) ? 0 : read(fd, buf, want);
     if (r == 0) break;
     else if (r < 0) {
       ESP_LOGE(TAG, "error reading ACL hash file %s", filename);
       break;
     } else {
+      if (data_len >= 0) {
+        data_len -= r;
+      }
       if (mbedtls_md_update(&md_ctx, buf, r) != ESP_OK) {
         ESP_LOGE(TAG, "error computing sha224 on %d bytes of data", r);
         r = -1;
@@ -162,56 +245,106 @@ esp_err_t acl_compute_stored_hash__acl_mutex(const char* filename, char *hash)
   return ESP_FAIL;
 }
 
+// Append the hash trailer to a downloaded ACL, ready to be moved into place
+// MUST hold the g_acl_mutex before calling!
+esp_err_t acl_append_hash__acl_mutex(const char* filename, const char *hash)
+{
+  char trailer[ACL_TRAILER_LEN + 1];
+
+  if (strlen(hash) != sha224_len - 1) {
+    ESP_LOGE(TAG, "bad ACL hash '%s'", hash);
+    return ESP_FAIL;
+  }
+  snprintf(trailer, sizeof(trailer), "\n" ACL_HASH_TAG "%s\n", hash);
+
+  int fd = open(filename, O_WRONLY | O_APPEND);
+  if (fd < 0) {
+    ESP_LOGE(TAG, "Can't open ACL file %s to append its hash", filename);
+    return ESP_FAIL;
+  }
+  int r = write(fd, trailer, ACL_TRAILER_LEN);
+  fsync(fd);
+  close(fd);
+  if (r != ACL_TRAILER_LEN) {
+    ESP_LOGE(TAG, "Error appending hash to ACL file %s", filename);
+    return ESP_FAIL;
+  }
+  return ESP_OK;
+}
+
+// Check an ACL file against its own trailer; hash is set to the stored hash
+// MUST hold the g_acl_mutex before calling!
+static esp_err_t acl_check__acl_mutex(const char *filename, char *hash, char *computed_hash)
+{
+  long data_len;
+
+  if (acl_get_stored_hash__acl_mutex(filename, hash, &data_len) != ESP_OK ||
+      acl_compute_stored_hash__acl_mutex(filename, data_len, computed_hash) != ESP_OK) {
+    return ESP_FAIL;
+  }
+  return (strcmp(hash, computed_hash) == 0) ? ESP_OK : ESP_FAIL;
+}
+
 esp_err_t acl_validate(void)
 {
   esp_err_t r = ESP_FAIL;
 
   char *stored_hash;
   char *computed_hash;
-  char *conf_acl_filename;
-  char *conf_acl_hash_filename;
+  const config_t *cfg = config_acquire();
+  const char *conf_acl_filename = cfg->acl_file;
+  const char *conf_acl_temp_filename = cfg->acl_temp_file;
+  const char *conf_acl_hash_filename = cfg->acl_hash_file;
+  struct stat st;
 
   stored_hash = malloc(sha224_len);
   computed_hash = malloc(sha224_len);
 
-  acl_get_data_filename(&conf_acl_filename);
-  acl_get_hash_filename(&conf_acl_hash_filename);
-
   xSemaphoreTake(g_acl_mutex, portMAX_DELAY);
-
-  // get the stored hash
-  if (acl_get_stored_hash__acl_mutex(conf_acl_hash_filename, stored_hash) != ESP_OK) {
-    ESP_LOGW(TAG, "Couldn't load stored hash; considering stored ACL invalid");
-    goto failed;
+  pm_busy_begin();
+
+  // on FAT an install is an unlink and a rename; finish one a power cut
+  // interrupted, the temp file's trailer shows whether it was complete
+  if (stat(conf_acl_filename, &st) != 0 &&
+      acl_check__acl_mutex(conf_acl_temp_filename, stored_hash, computed_hash) == ESP_OK) {
+    ESP_LOGW(TAG, "Completing interrupted ACL install from %s", conf_acl_temp_filename);
+    spiflash_replace(conf_acl_temp_filename, conf_acl_filename);
   }
 
-  if (acl_compute_stored_hash__acl_mutex(conf_acl_filename, computed_hash) != ESP_OK) {
-    ESP_LOGW(TAG, "Couldn't computed hash of stored ACL; considering stored ACL invalid.");
-    goto failed;
+  if (acl_check__acl_mutex(conf_acl_filename, stored_hash, computed_hash) == ESP_OK) {
+    ESP_LOGI(TAG, "Stored ACL hashes validated.");
+    rtc_cache_set_acl_gen(stored_hash);
+    r = ESP_OK;
+    goto done;
   }
 
-  if (strcmp(stored_hash, computed_hash) == 0) {
-    ESP_LOGI(TAG, "Stored ACL hashes validated.");
+  // an ACL stored before the hash trailer, with its hash in a separate file;
+  // the next download replaces it with the single file format
+  if (acl_get_legacy_hash__acl_mutex(conf_acl_hash_filename, stored_hash) == ESP_OK &&
+      acl_compute_stored_hash__acl_mutex(conf_acl_filename, -1, computed_hash) == ESP_OK &&
+      strcmp(stored_hash, computed_hash) == 0) {
+    ESP_LOGI(TAG, "Stored ACL validated against legacy hash file.");
+    rtc_cache_set_acl_gen(stored_hash);
     r = ESP_OK;
     goto done;
   }
 
-failed:
   ESP_LOGW(TAG, "Stored ACL hashes not valid.  Removing stored files.");
+  rtc_cache_set_acl_gen(NULL);
 
-  if (unlink(conf_acl_filename) != 0) {
+  if (stat(conf_acl_filename, &st) == 0 && unlink(conf_acl_filename) != 0) {
     ESP_LOGE(TAG, "Could not delete ACL file %s", conf_acl_filename);
   }
-  if (unlink(conf_acl_hash_filename) != 0) {
+  if (stat(conf_acl_hash_filename, &st) == 0 && unlink(conf_acl_hash_filename) != 0) {
     ESP_LOGE(TAG, "Could not delete ACL hash file %s", conf_acl_hash_filename);
   }
 
 
 done:
+  pm_busy_end();
   xSemaphoreGive(g_acl_mutex);
-  free(conf_acl_filename);
-  free(conf_acl_hash_filename);
   free(stored_hash);
   free(computed_hash);
+  config_release(cfg);
   return r;
 }
@@ -1,12 +1,20 @@
 #ifndef _ACL_H
 #define _ACL_H
 
+// The stored ACL ends with a "\n#sha224:<hex>\n" trailer holding the hash
+// of everything before it, so a new list and its hash are installed with a
+// single rename.  The CSV parser skips the trailer like any other short line.
+#define ACL_HASH_TAG "#sha224:"
+#define ACL_HASH_TAG_LEN (sizeof(ACL_HASH_TAG) - 1)
+#define ACL_TRAILER_LEN (1 + ACL_HASH_TAG_LEN + 56 + 1)
+
 esp_err_t acl_init(void);
-esp_err_t acl_get_data_filename(char **s);
-esp_err_t acl_get_hash_filename(char **s);
-esp_err_t acl_get_stored_hash__acl_mutex(const char* filename, char *hash);
-esp_err_t acl_compute_stored_hash__acl_mutex(const char* filename, char *hash);
+void acl_get_data_filename(char *buf, size_t len);
+esp_err_t acl_get_stored_hash__acl_mutex(const char* filename, char *hash, long *data_len);
+esp_err_t acl_compute_stored_hash__acl_mutex(const char* filename, long data_len, char *hash);
+esp_err_t acl_append_hash__acl_mutex(const char* filename, const char *hash);
 esp_err_t acl_validate(void);
+bool acl_is_validated(void);
 
 extern const size_t sha224_len;
 extern SemaphoreHandle_t g_acl_mutex;
@@ -36,18 +36,22 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <time.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_wifi.h"
 #include "esp_system.h"
 #include "nvs_flash.h"
 #include "esp_vfs_dev.h"
 #include "esp_log.h"
+#include "config.h"
 
 static const char *TAG = "config";
 
-// Mount path for the partition
-const char *nvs_namespace = "config";
+// NVS namespace holding config keys
+const char *nvs_namespace = CONFIG_NVS_NAMESPACE;
 
 esp_err_t config_get_string(const char* key, char **str, char* def_val)
 {
@@ -105,3 +109,318 @@ exit:
   nvs_close(hdl);
   return r;
 }
+
+
+//
+// Known config keys, their defaults, and where they live in config_t.
+// Only keys marked remote may be changed over MQTT; credentials, server
+// URLs and cert paths would let a single publish redirect the node.
+//
+typedef struct config_key {
+  const char *key;
+  const char *def_val;
+  size_t offset;
+  bool remote;
+} config_key_t;
+
+#define CONFIG_KEY(name, def, remote) { #name, def, offsetof(config_t, name), remote }
+
+static const config_key_t s_keys[] = {
+  CONFIG_KEY(wifi_ssid,     "ssid",                                                   false),
+  CONFIG_KEY(wifi_password, "password",                                               false),
+  CONFIG_KEY(mqtt_broker,   "mqtts://my-mqtt-server.org:1883",                        false),
+  CONFIG_KEY(ntp_server,    "pool.ntp.org",                                           true),
+  CONFIG_KEY(tz,            "EST5EDT,M3.2.0/2,M11.1.0",                               true),
+  CONFIG_KEY(ota_url,       "https://my-server.org/ota.bin",                          false),
+  CONFIG_KEY(assets_url,    "https://my-server.org/assets.bin",                       false),
+  CONFIG_KEY(acl_url_fmt,   "https://my-server.org:443/auth/api/v0/resources/%s/acl", false),
+  CONFIG_KEY(acl_resource,  "frontdoor",                                              false),
+  CONFIG_KEY(acl_file,      "/config/acl.csv",                                        false),
+  CONFIG_KEY(acl_hash_file, "/config/acl.sha",                                        false),
+  CONFIG_KEY(acl_temp_file, "/config/acltemp.csv",                                    false),
+  CONFIG_KEY(api_user,      "username",                                               false),
+  CONFIG_KEY(api_password,  "password",                                               false),
+  CONFIG_KEY(ca_cert,       "/config/ca.crt",                                         false),
+  CONFIG_KEY(client_cert,   "/config/client.crt",                                     false),
+  CONFIG_KEY(client_key,    "/config/client.key",                                     false),
+};
+
+#define CONFIG_NUM_KEYS (sizeof(s_keys) / sizeof(s_keys[0]))
+
+// Every snapshot is allocated behind a small header holding its pin count
+// and a link for the retired list.
+typedef struct config_slot {
+  struct config_slot *next;
+  unsigned int refs;
+  config_t cfg;
+} config_slot_t;
+
+#define CONFIG_SLOT(c) ((config_slot_t *)((char *)(c) - offsetof(config_slot_t, cfg)))
+
+// current snapshot, read lock-free with an acquire load
+static config_t *s_config = NULL;
+
+// Replaced snapshots, newest first.  The newest one is kept for unpinned
+// config_get() readers; older ones are freed once nobody has them pinned.
+static config_slot_t *s_config_retired = NULL;
+
+// guards the pin counts and the retired list against config_acquire()
+static portMUX_TYPE s_config_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// serializes writers (NVS update + snapshot rebuild + publish)
+static SemaphoreHandle_t s_config_mutex = NULL;
+
+static config_listener_t s_listeners[CONFIG_MAX_LISTENERS];
+static int s_num_listeners = 0;
+
+static const config_key_t *config_find_key(const char *key)
+{
+  for (int i = 0; i < CONFIG_NUM_KEYS; i++) {
+    if (strcmp(s_keys[i].key, key) == 0) {
+      return &s_keys[i];
+    }
+  }
+  return NULL;
+}
+
+bool config_is_known_key(const char *key)
+{
+  return config_find_key(key) != NULL;
+}
+
+bool config_is_remote_key(const char *key)
+{
+  const config_key_t *k = config_find_key(key);
+  return k != NULL && k->remote;
+}
+
+static inline const char **config_field(config_t *cfg, const config_key_t *k)
+{
+  return (const char **)((char *)cfg + k->offset);
+}
+
+// Build a new snapshot from NVS.  The slot header, the struct and all of its
+// strings are allocated as a single block so the whole snapshot can be freed at once.
+static config_t *config_build_snapshot(unsigned int generation)
+{
+  char *vals[CONFIG_NUM_KEYS] = { NULL };
+  size_t total = sizeof(config_slot_t);
+  config_slot_t *slot = NULL;
+  config_t *cfg = NULL;
+
+  for (int i = 0; i < CONFIG_NUM_KEYS; i++) {
+    if (config_get_string(s_keys[i].key, &vals[i], (char *)s_keys[i].def_val) != ESP_OK || vals[i] == NULL) {
+      ESP_LOGW(TAG, "using built-in default for '%s'", s_keys[i].key);
+      free(vals[i]);
+      vals[i] = strdup(s_keys[i].def_val);
+      if (vals[i] == NULL) {
+        goto exit;
+      }
+    }
+    total += strlen(vals[i]) + 1;
+  }
+
+  slot = malloc(total);
+  if (slot == NULL) {
+    ESP_LOGE(TAG, "can't malloc %d bytes for config snapshot", total);
+    goto exit;
+  }
+
+  memset(slot, 0, sizeof(config_slot_t));
+  cfg = &slot->cfg;
+  cfg->generation = generation;
+
+  char *pool = (char *)slot + sizeof(config_slot_t);
+  for (int i = 0; i < CONFIG_NUM_KEYS; i++) {
+    size_t len = strlen(vals[i]) + 1;
+    memcpy(pool, vals[i], len);
+    *config_field(cfg, &s_keys[i]) = pool;
+    pool += len;
+  }
+
+exit:
+  for (int i = 0; i < CONFIG_NUM_KEYS; i++) {
+    free(vals[i]);
+  }
+  return cfg;
+}
+
+// Publish a new snapshot and retire the old one.  Retired snapshots older
+// than the previous generation are freed unless a reader still has them pinned.
+// MUST hold s_config_mutex before calling!
+static void config_publish__config_mutex(config_t *cfg)
+{
+  config_slot_t *dead = NULL;
+
+  portENTER_CRITICAL(&s_config_lock);
+  config_t *old = __atomic_exchange_n(&s_config, cfg, __ATOMIC_ACQ_REL);
+  if (old != NULL) {
+    config_slot_t *slot = CONFIG_SLOT(old);
+    slot->next = s_config_retired;
+    s_config_retired = slot;
+
+    config_slot_t **pp = &slot->next;
+    while (*pp != NULL) {
+      config_slot_t *s = *pp;
+      if (s->refs == 0) {
+        *pp = s->next;
+        s->next = dead;
+        dead = s;
+      } else {
+        pp = &s->next;
+      }
+    }
+  }
+  portEXIT_CRITICAL(&s_config_lock);
+
+  while (dead != NULL) {
+    config_slot_t *next = dead->next;
+    free(dead);
+    dead = next;
+  }
+}
+
+static void config_notify(const config_t *cfg, const char *key)
+{
+  for (int i = 0; i < s_num_listeners; i++) {
+    s_listeners[i](cfg, key);
+  }
+}
+
+static void config_apply_tz(const config_t *cfg, const char *key)
+{
+  if (key == NULL || strcmp(key, "tz") == 0) {
+    setenv("TZ", cfg->tz, 1);
+    tzset();
+  }
+}
+
+esp_err_t config_init(void)
+{
+  s_config_mutex = xSemaphoreCreateMutex();
+  if (s_config_mutex == NULL) {
+    ESP_LOGE(TAG, "Could not create config mutex.");
+    return ESP_FAIL;
+  }
+
+  config_t *cfg = config_build_snapshot(1);
+  if (cfg == NULL) {
+    ESP_LOGE(TAG, "FATAL: could not build config snapshot!");
+    return ESP_FAIL;
+  }
+
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  config_publish__config_mutex(cfg);
+  xSemaphoreGive(s_config_mutex);
+
+  config_register_listener(config_apply_tz);
+  config_apply_tz(cfg, NULL);
+
+  ESP_LOGI(TAG, "loaded %d config keys", CONFIG_NUM_KEYS);
+  return ESP_OK;
+}
+
+const config_t *config_get(void)
+{
+  return __atomic_load_n(&s_config, __ATOMIC_ACQUIRE);
+}
+
+const config_t *config_acquire(void)
+{
+  portENTER_CRITICAL(&s_config_lock);
+  config_t *cfg = s_config;
+  if (cfg != NULL) {
+    CONFIG_SLOT(cfg)->refs++;
+  }
+  portEXIT_CRITICAL(&s_config_lock);
+  return cfg;
+}
+
+void config_release(const config_t *cfg)
+{
+  if (cfg == NULL) {
+    return;
+  }
+  portENTER_CRITICAL(&s_config_lock);
+  CONFIG_SLOT(cfg)->refs--;
+  portEXIT_CRITICAL(&s_config_lock);
+}
+
+esp_err_t config_register_listener(config_listener_t cb)
+{
+  if (s_num_listeners >= CONFIG_MAX_LISTENERS) {
+    ESP_LOGE(TAG, "too many config listeners");
+    return ESP_ERR_NO_MEM;
+  }
+  s_listeners[s_num_listeners++] = cb;
+  return ESP_OK;
+}
+
+// Apply a change to NVS (value NULL erases the key, reverting it to its
+// default on rebuild), then rebuild and publish the snapshot and notify listeners.
+static esp_err_t config_update(const char *key, const char *value)
+{
+  nvs_handle_t hdl;
+  esp_err_t r;
+
+  if (config_find_key(key) == NULL) {
+    ESP_LOGE(TAG, "unknown config key '%s'", key);
+    return ESP_ERR_NOT_FOUND;
+  }
+
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+
+  r = nvs_open(nvs_namespace, NVS_READWRITE, &hdl);
+  if (r != ESP_OK) {
+    ESP_LOGE(TAG, "NVS open error: %s", esp_err_to_name(r));
+    goto exit;
+  }
+
+  if (value != NULL) {
+    r = nvs_set_str(hdl, key, value);
+  } else {
+    r = nvs_erase_key(hdl, key);
+    if (r == ESP_ERR_NVS_NOT_FOUND) {
+      r = ESP_OK;
+    }
+  }
+  if (r == ESP_OK) {
+    r = nvs_commit(hdl);
+  }
+  nvs_close(hdl);
+
+  if (r != ESP_OK) {
+    ESP_LOGE(TAG, "error updating config key '%s': %s", key, esp_err_to_name(r));
+    goto exit;
+  }
+
+  const config_t *cur = config_get();
+  config_t *cfg = config_build_snapshot(cur ? cur->generation + 1 : 1);
+  if (cfg == NULL) {
+    r = ESP_ERR_NO_MEM;
+    goto exit;
+  }
+  config_publish__config_mutex(cfg);
+
+  ESP_LOGI(TAG, "config key '%s' updated, generation %u", key, cfg->generation);
+
+  // listeners run with the writer mutex held so notifications are delivered in order
+  config_notify(cfg, key);
+
+exit:
+  xSemaphoreGive(s_config_mutex);
+  return r;
+}
+
+esp_err_t config_set_string(const char *key, const char *value)
+{
+  if (value == NULL) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  return config_update(key, value);
+}
+
+esp_err_t config_erase_key(const char *key)
+{
+  return config_update(key, NULL);
+}
@@ -1,6 +1,63 @@
 #ifndef _CONFIG_H
 #define _CONFIG_H
 
+#include <stdbool.h>
+#include "esp_err.h"
+
+//
+// Immutable snapshot of every known configuration key.  The snapshot is
+// built from NVS once at boot (missing keys are created with their defaults)
+// and rebuilt only when a key is changed through config_set_string() or
+// config_erase_key().  Readers take the current pointer with config_get(),
+// which is a single atomic load, and must treat the contents as read-only.
+//
+// A snapshot from config_get() remains valid for one further config change
+// after it is replaced, so it's only for non-blocking one-line reads.
+// Anything that blocks while holding the snapshot or a string from it (file
+// or flash I/O, downloads, driver calls, queue waits) must pin it with
+// config_acquire() and drop it with config_release(), or copy the string
+// out while pinned; a pinned snapshot is never freed.
+//
+typedef struct config {
+  unsigned int generation;
+
+  const char *wifi_ssid;
+  const char *wifi_password;
+  const char *mqtt_broker;
+  const char *ntp_server;
+  const char *tz;
+  const char *ota_url;
+  const char *assets_url;
+  const char *acl_url_fmt;
+  const char *acl_resource;
+  const char *acl_file;
+  const char *acl_hash_file;
+  const char *acl_temp_file;
+  const char *api_user;
+  const char *api_password;
+  const char *ca_cert;
+  const char *client_cert;
+  const char *client_key;
+} config_t;
+
+// called after a new snapshot has been published; key is the config key that changed
+typedef void (*config_listener_t)(const config_t *cfg, const char *key);
+
+#define CONFIG_MAX_LISTENERS 8
+
+#define CONFIG_NVS_NAMESPACE "config"
+
+esp_err_t config_init(void);
+const config_t *config_get(void);
+const config_t *config_acquire(void);
+void config_release(const config_t *cfg);
+esp_err_t config_set_string(const char *key, const char *value);
+esp_err_t config_erase_key(const char *key);
+esp_err_t config_register_listener(config_listener_t cb);
+bool config_is_known_key(const char *key);
+bool config_is_remote_key(const char *key);    // may be set over MQTT
+
+// direct NVS access, bypasses the snapshot
 esp_err_t config_get_string(const char* key, char **str, char* def_val);
 
 #endif
@@ -43,6 +43,8 @@
 #include "esp_system.h"
 #include "nvs_flash.h"
 #include "esp_vfs_dev.h"
+#include "esp_timer.h"
+#include "hal/cpu_hal.h"
 
 #include "esp_log.h"
 #include "esp_console.h"
@@ -50,9 +52,21 @@
 #include "linenoise/linenoise.h"
 #include "argtable3/argtable3.h"
 #include "console.h"
+#include "system.h"
 
 #include "main_task.h"
 #include "net_task.h"
+#include "net_ota.h"
+#include "config.h"
+#include "blog.h"
+#include "perf.h"
+#include "stress.h"
+#include "spiflash.h"
+#include "boot_prof.h"
+#include "display_task.h"
+#include "rtc_cache.h"
+#include "pm_ctl.h"
+#include "net_wifi_ps.h"
 
 
 static char prompt[80];
@@ -67,6 +81,15 @@ static void console_register_cmd_acl(void);
 static void console_register_cmd_free(void);
 static void console_register_cmd_reset(void);
 static void console_register_cmd_ota(void);
+static void console_register_cmd_config_bench(void);
+static void console_register_cmd_logdump(void);
+static void console_register_cmd_blog_bench(void);
+static void console_register_cmd_fs_bench(void);
+static void console_register_cmd_perf(void);
+static void console_register_cmd_stress(void);
+static void console_register_cmd_cpu(void);
+static void console_register_cmd_sleep_info(void);
+static void console_register_cmd_wifi_ps(void);
 
 
 void console_init(void)
@@ -141,6 +164,15 @@ void console_init(void)
     console_register_cmd_free();
     console_register_cmd_reset();
     console_register_cmd_ota();
+    console_register_cmd_config_bench();
+    console_register_cmd_logdump();
+    console_register_cmd_blog_bench();
+    console_register_cmd_fs_bench();
+    console_register_cmd_perf();
+    console_register_cmd_stress();
+    console_register_cmd_cpu();
+    console_register_cmd_sleep_info();
+    console_register_cmd_wifi_ps();
 
 
     printf("\n\n"
@@ -293,6 +325,15 @@ static int nvs_set(int argc, char **argv)
       return 1;
   }
 
+  // known config keys go through the config subsystem so the snapshot and listeners see the change
+  if (strcmp(nvs_set_args.namespace->sval[0], CONFIG_NVS_NAMESPACE) == 0 && config_is_known_key(nvs_set_args.key->sval[0])) {
+    esp_err_t r = config_set_string(nvs_set_args.key->sval[0], nvs_set_args.value->sval[0]);
+    if (r != ESP_OK) {
+      printf("\nconfig set error: %s\n", esp_err_to_name(r));
+    }
+    return r;
+  }
+
   nvs_handle_t hdl;
   esp_err_t r = nvs_open(nvs_set_args.namespace->sval[0], NVS_READWRITE, &hdl);
   if (r != ESP_OK) {
@@ -326,6 +367,14 @@ static int nvs_erase(int argc, char **argv)
       return 1;
   }
 
+  if (strcmp(nvs_erase_args.namespace->sval[0], CONFIG_NVS_NAMESPACE) == 0 && config_is_known_key(nvs_erase_args.key->sval[0])) {
+    esp_err_t r = config_erase_key(nvs_erase_args.key->sval[0]);
+    if (r != ESP_OK) {
+      printf("\nconfig erase error: %s\n", esp_err_to_name(r));
+    }
+    return r;
+  }
+
   nvs_handle_t hdl;
   esp_err_t r = nvs_open(nvs_erase_args.namespace->sval[0], NVS_READWRITE, &hdl);
   if (r != ESP_OK) {
@@ -416,7 +465,13 @@ static int fetch_acl(int argc, char **argv)
 
 static int system_free(int argc, char **argv)
 {
+  display_mem_t mem;
+
   printf("\n\nFree heap memory: %d bytes\n", esp_get_free_heap_size());
+
+  display_get_mem(&mem);
+  printf("LVGL heap: %u of %u bytes used, peak %u, steady %u, %u%% fragmented, %u screens built\n",
+         mem.used, mem.total, mem.peak, mem.steady, mem.frag_pct, mem.screens);
   return ESP_OK;
 }
 
@@ -427,14 +482,281 @@ static int system_reset(int argc, char **argv)
   return ESP_OK;
 }
 
+static struct {
+    struct arg_lit *bench;
+    struct arg_end *end;
+} ota_args;
 static int ota_update(int argc, char **argv)
 {
+  int nerrors = arg_parse(argc, argv, (void **) &ota_args);
+  if (nerrors != 0) {
+      arg_print_errors(stderr, ota_args.end, argv[0]);
+      return 1;
+  }
+
+  if (ota_args.bench->count) {
+    printf("\n\nBenchmarking OTA download, results follow in the log.\n");
+    net_ota_bench();
+    return ESP_OK;
+  }
+
   printf("\n\nRequesting OTA update.\n");
   main_task_event(MAIN_EVT_OTA_UPDATE);
   return ESP_OK;
 }
 
 
+static struct {
+    struct arg_int *count;
+    struct arg_end *end;
+} config_bench_args;
+static int config_bench(int argc, char **argv)
+{
+  int nerrors = arg_parse(argc, argv, (void **) &config_bench_args);
+  if (nerrors != 0) {
+      arg_print_errors(stderr, config_bench_args.end, argv[0]);
+      return 1;
+  }
+
+  int n = config_bench_args.count->count ? config_bench_args.count->ival[0] : 1000;
+  if (n <= 0) {
+    n = 1000;
+  }
+
+  volatile size_t sink = 0;
+
+  // old path: NVS open/get/malloc on every read
+  int64_t t0 = esp_timer_get_time();
+  for (int i = 0; i < n; i++) {
+    char *s;
+    if (config_get_string("acl_file", &s, "/config/acl.csv") == ESP_OK && s) {
+      sink += strlen(s);
+    }
+    free(s);
+  }
+  int64_t t_nvs = esp_timer_get_time() - t0;
+
+  // snapshot path: atomic pointer load
+  t0 = esp_timer_get_time();
+  for (int i = 0; i < n; i++) {
+    sink += strlen(config_get()->acl_file);
+  }
+  int64_t t_snap = esp_timer_get_time() - t0;
+
+  printf("\n%d reads of acl_file:\n", n);
+  printf("  nvs:      %lld us total, %lld ns/read\n", t_nvs, (t_nvs * 1000) / n);
+  printf("  snapshot: %lld us total, %lld ns/read\n", t_snap, (t_snap * 1000) / n);
+  printf("  config generation %u, free heap %d bytes\n", config_get()->generation, esp_get_free_heap_size());
+  (void)sink;
+
+  return ESP_OK;
+}
+
+
+static void logdump_sink(const char *line, void *ctx)
+{
+  fputs(line, stdout);
+}
+
+static struct {
+    struct arg_int *count;
+    struct arg_lit *clear;
+    struct arg_end *end;
+} logdump_args;
+static int logdump(int argc, char **argv)
+{
+  int nerrors = arg_parse(argc, argv, (void **) &logdump_args);
+  if (nerrors != 0) {
+      arg_print_errors(stderr, logdump_args.end, argv[0]);
+      return 1;
+  }
+
+  int max = logdump_args.count->count ? logdump_args.count->ival[0] : 0;
+
+  printf("\n");
+  int n = blog_dump(logdump_sink, NULL, max);
+  printf("%d entries\n", n);
+
+  if (logdump_args.clear->count) {
+    blog_clear();
+  }
+  return ESP_OK;
+}
+
+
+static struct {
+    struct arg_int *count;
+    struct arg_end *end;
+} blog_bench_args;
+static int blog_bench(int argc, char **argv)
+{
+  static const char *BENCH_TAG = "blog_bench";
+
+  int nerrors = arg_parse(argc, argv, (void **) &blog_bench_args);
+  if (nerrors != 0) {
+      arg_print_errors(stderr, blog_bench_args.end, argv[0]);
+      return 1;
+  }
+
+  int n = blog_bench_args.count->count ? blog_bench_args.count->ival[0] : 100;
+  if (n <= 0) {
+    n = 100;
+  }
+
+  // ESP_LOGI formats and writes synchronously to the console UART
+  uint32_t c0 = cpu_hal_get_cycle_count();
+  for (int i = 0; i < n; i++) {
+    ESP_LOGI(BENCH_TAG, "bench tag %010u state %d", 0x12345678u, i);
+  }
+  uint32_t c_esp = cpu_hal_get_cycle_count() - c0;
+
+  c0 = cpu_hal_get_cycle_count();
+  for (int i = 0; i < n; i++) {
+    BLOG("bench tag %010u state %d", 0x12345678u, i);
+  }
+  uint32_t c_blog = cpu_hal_get_cycle_count() - c0;
+
+  printf("\n%d log calls:\n", n);
+  printf("  ESP_LOGI: %u cycles/call\n", c_esp / n);
+  printf("  BLOG:     %u cycles/call\n", c_blog / n);
+  printf("  saved:    %u cycles/call\n", (c_esp - c_blog) / n);
+
+  return ESP_OK;
+}
+
+
+static struct {
+    struct arg_int *count;
+    struct arg_end *end;
+} fs_bench_args;
+static int fs_bench(int argc, char **argv)
+{
+  int nerrors = arg_parse(argc, argv, (void **) &fs_bench_args);
+  if (nerrors != 0) {
+      arg_print_errors(stderr, fs_bench_args.end, argv[0]);
+      return 1;
+  }
+
+  int n = fs_bench_args.count->count ? fs_bench_args.count->ival[0] : 256;
+  if (n <= 0) {
+    n = 256;
+  }
+
+  spiflash_bench(n);
+  return ESP_OK;
+}
+
+
+static struct {
+    struct arg_lit *reset;
+    struct arg_end *end;
+} perf_args;
+static int perf(int argc, char **argv)
+{
+  int nerrors = arg_parse(argc, argv, (void **) &perf_args);
+  if (nerrors != 0) {
+      arg_print_errors(stderr, perf_args.end, argv[0]);
+      return 1;
+  }
+
+  perf_report(TASK_AFFINITY_NAME);
+
+  char boot_stages[256];
+  boot_stages_json(boot_stages, sizeof(boot_stages));
+  printf("\nboot stages (ms): %s\n", boot_stages);
+
+  if (perf_args.reset->count) {
+    perf_reset_all();
+  }
+  return ESP_OK;
+}
+
+
+static struct {
+    struct arg_int *duration;
+    struct arg_int *interval;
+    struct arg_end *end;
+} stress_args;
+static int stress(int argc, char **argv)
+{
+  int nerrors = arg_parse(argc, argv, (void **) &stress_args);
+  if (nerrors != 0) {
+      arg_print_errors(stderr, stress_args.end, argv[0]);
+      return 1;
+  }
+
+  int duration = stress_args.duration->count ? stress_args.duration->ival[0] : 30;
+  int interval = stress_args.interval->count ? stress_args.interval->ival[0] : 250;
+
+  stress_run(duration, interval);
+  return ESP_OK;
+}
+
+
+static struct {
+    struct arg_int *duration;
+    struct arg_end *end;
+} cpu_args;
+static int cpu(int argc, char **argv)
+{
+  int nerrors = arg_parse(argc, argv, (void **) &cpu_args);
+  if (nerrors != 0) {
+      arg_print_errors(stderr, cpu_args.end, argv[0]);
+      return 1;
+  }
+
+  int duration = cpu_args.duration->count ? cpu_args.duration->ival[0] : 5;
+  if (duration <= 0) {
+    duration = 5;
+  }
+
+  printf("sampling CPU use for %d s...\n", duration);
+  return perf_cpu_sample(duration * 1000) == 0 ? ESP_OK : 1;
+}
+
+
+static int sleep_info(int argc, char **argv)
+{
+  rtc_cache_report();
+  printf("\n");
+  pm_ctl_report();
+  return ESP_OK;
+}
+
+
+static struct {
+    struct arg_str *mode;
+    struct arg_end *end;
+} wifi_ps_args;
+static int wifi_ps(int argc, char **argv)
+{
+  int nerrors = arg_parse(argc, argv, (void **) &wifi_ps_args);
+  if (nerrors != 0) {
+      arg_print_errors(stderr, wifi_ps_args.end, argv[0]);
+      return 1;
+  }
+
+  if (wifi_ps_args.mode->count) {
+    const char *mode = wifi_ps_args.mode->sval[0];
+    if (strcmp(mode, "none") == 0) {
+      net_wifi_ps_force(WIFI_PS_NONE);
+    } else if (strcmp(mode, "min") == 0) {
+      net_wifi_ps_force(WIFI_PS_MIN_MODEM);
+    } else if (strcmp(mode, "max") == 0) {
+      net_wifi_ps_force(WIFI_PS_MAX_MODEM);
+    } else if (strcmp(mode, "auto") == 0) {
+      net_wifi_ps_force(-1);
+    } else {
+      printf("unknown mode %s\n", mode);
+      return 1;
+    }
+  }
+
+  net_wifi_ps_report();
+  return ESP_OK;
+}
+
+
 static void console_register_cmd_log(void)
 {
     log_args.tag = arg_str1(NULL, NULL, "<tag>", "TAG of module to change, * to reset all to a given level");
@@ -594,19 +916,170 @@ static void console_register_cmd_reset(void)
 
 static void console_register_cmd_ota(void)
 {
+  ota_args.bench = arg_lit0(NULL, "bench", "download the image with both OTA paths without installing it");
+  ota_args.end = arg_end(1);
 
   const esp_console_cmd_t ota_cmd = {
       .command = "ota",
       .help = "Perform OTA update",
       .hint = NULL,
       .func = &ota_update,
-      .argtable = NULL
+      .argtable = &ota_args
   };
 
   ESP_ERROR_CHECK( esp_console_cmd_register(&ota_cmd) );
 }
 
 
+static void console_register_cmd_config_bench(void)
+{
+  config_bench_args.count = arg_int0(NULL, NULL, "<n>", "number of reads (default 1000)");
+  config_bench_args.end = arg_end(1);
+
+  const esp_console_cmd_t config_bench_cmd = {
+      .command = "config_bench",
+      .help = "Compare per-call NVS config reads against the cached config snapshot",
+      .hint = NULL,
+      .func = &config_bench,
+      .argtable = &config_bench_args
+  };
+
+  ESP_ERROR_CHECK( esp_console_cmd_register(&config_bench_cmd) );
+}
+
+
+static void console_register_cmd_logdump(void)
+{
+  logdump_args.count = arg_int0("n", NULL, "<n>", "most recent entries per core (default all)");
+  logdump_args.clear = arg_lit0("c", NULL, "clear the log after dumping");
+  logdump_args.end = arg_end(2);
+
+  const esp_console_cmd_t logdump_cmd = {
+      .command = "logdump",
+      .help = "Format and print the binary ring-buffer log",
+      .hint = NULL,
+      .func = &logdump,
+      .argtable = &logdump_args
+  };
+
+  ESP_ERROR_CHECK( esp_console_cmd_register(&logdump_cmd) );
+}
+
+static void console_register_cmd_blog_bench(void)
+{
+  blog_bench_args.count = arg_int0(NULL, NULL, "<n>", "number of log calls (default 100)");
+  blog_bench_args.end = arg_end(1);
+
+  const esp_console_cmd_t blog_bench_cmd = {
+      .command = "blog_bench",
+      .help = "Compare cycles per call of ESP_LOGI against the binary log",
+      .hint = NULL,
+      .func = &blog_bench,
+      .argtable = &blog_bench_args
+  };
+
+  ESP_ERROR_CHECK( esp_console_cmd_register(&blog_bench_cmd) );
+}
+
+
+static void console_register_cmd_fs_bench(void)
+{
+  fs_bench_args.count = arg_int0(NULL, NULL, "<n>", "records to append and read back (default 256)");
+  fs_bench_args.end = arg_end(1);
+
+  const esp_console_cmd_t fs_bench_cmd = {
+      .command = "fs_bench",
+      .help = "Measure mount time, small reads and appends on the config filesystem",
+      .hint = NULL,
+      .func = &fs_bench,
+      .argtable = &fs_bench_args
+  };
+
+  ESP_ERROR_CHECK( esp_console_cmd_register(&fs_bench_cmd) );
+}
+
+
+static void console_register_cmd_perf(void)
+{
+  perf_args.reset = arg_lit0("r", NULL, "reset all stats after printing");
+  perf_args.end = arg_end(1);
+
+  const esp_console_cmd_t perf_cmd = {
+      .command = "perf",
+      .help = "Show latency statistics (count, min, avg, percentiles, max)",
+      .hint = NULL,
+      .func = &perf,
+      .argtable = &perf_args
+  };
+
+  ESP_ERROR_CHECK( esp_console_cmd_register(&perf_cmd) );
+}
+
+static void console_register_cmd_stress(void)
+{
+  stress_args.duration = arg_int0("d", NULL, "<sec>", "seconds per phase (default 30)");
+  stress_args.interval = arg_int0("i", NULL, "<ms>", "RFID frame replay interval (default 250)");
+  stress_args.end = arg_end(2);
+
+  const esp_console_cmd_t stress_cmd = {
+      .command = "stress",
+      .help = "Replay RFID frames with and without TLS handshake load, report scan latency",
+      .hint = NULL,
+      .func = &stress,
+      .argtable = &stress_args
+  };
+
+  ESP_ERROR_CHECK( esp_console_cmd_register(&stress_cmd) );
+}
+
+static void console_register_cmd_cpu(void)
+{
+  cpu_args.duration = arg_int0("d", NULL, "<sec>", "sample window (default 5)");
+  cpu_args.end = arg_end(1);
+
+  const esp_console_cmd_t cpu_cmd = {
+      .command = "cpu",
+      .help = "Show per-task CPU use and per-core idle percentage over a window",
+      .hint = NULL,
+      .func = &cpu,
+      .argtable = &cpu_args
+  };
+
+  ESP_ERROR_CHECK( esp_console_cmd_register(&cpu_cmd) );
+}
+
+
+static void console_register_cmd_sleep_info(void)
+{
+  const esp_console_cmd_t sleep_info_cmd = {
+      .command = "sleep_info",
+      .help = "Show the RTC hot tag cache, offline event counters, wake latencies, per-state residency and battery runtime estimates",
+      .hint = NULL,
+      .func = &sleep_info,
+      .argtable = NULL
+  };
+
+  ESP_ERROR_CHECK( esp_console_cmd_register(&sleep_info_cmd) );
+}
+
+
+static void console_register_cmd_wifi_ps(void)
+{
+  wifi_ps_args.mode = arg_str0(NULL, NULL, "<none|min|max|auto>", "force a power save mode, or back to automatic");
+  wifi_ps_args.end = arg_end(1);
+
+  const esp_console_cmd_t wifi_ps_cmd = {
+      .command = "wifi_ps",
+      .help = "Show Wi-Fi power save time, MQTT round trips and download throughput per mode",
+      .hint = NULL,
+      .func = &wifi_ps,
+      .argtable = &wifi_ps_args
+  };
+
+  ESP_ERROR_CHECK( esp_console_cmd_register(&wifi_ps_cmd) );
+}
+
+
 int console_poll(void)
 {
     char* line = linenoise(prompt);
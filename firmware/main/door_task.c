@@ -38,100 +38,244 @@
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/queue.h"
 #include "esp_system.h"
 #include "esp_log.h"
 #include "esp_task_wdt.h"
+#include "esp_timer.h"
 #include "soc/gpio_struct.h"
 #include "driver/gpio.h"
 #include "system.h"
+#include "perf.h"
 
 #include "main_task.h"
 #include "door_task.h"
 
 static const char *TAG = "door_task";
 
-#define DOOR_QUEUE_DEPTH 8
+#define DOOR_SETTLE_MS     20     // sensor edges are sampled once they've settled
+#define DOOR_WDT_MS        1000   // wake this often with nothing to do, for the watchdog
+#define DOOR_UNLOCK_MS     300
+#define DOOR_LOCK_MS       400
+#define DOOR_REVERSE_MS    20     // motor off before driving it the other way
 
-typedef struct door_evt {
-  int unlock;
-} door_evt_t;
+typedef enum {
+  DOOR_CMD_NONE,
+  DOOR_CMD_UNLOCK,
+  DOOR_CMD_LOCK
+} door_cmd_t;
 
-static QueueHandle_t m_q;
+//
+// Motor drive is a list of output phases played by a one-shot esp_timer,
+// so the door task never sleeps through a pulse and keeps sampling the
+// door sensor.  O1/O2 both high is the motor's idle (off) state.
+//
+typedef struct {
+  uint8_t o1;
+  uint8_t o2;
+  uint16_t ms;        // 0 ends the schedule
+} door_phase_t;
+
+static const door_phase_t s_unlock_phases[] = { {0, 1, DOOR_UNLOCK_MS}, {1, 1, 0} };
+static const door_phase_t s_lock_phases[] = { {1, 0, DOOR_LOCK_MS}, {1, 1, 0} };
+
+// used when a command reverses a pulse still in progress
+static const door_phase_t s_unlock_rev_phases[] = { {1, 1, DOOR_REVERSE_MS}, {0, 1, DOOR_UNLOCK_MS}, {1, 1, 0} };
+static const door_phase_t s_lock_rev_phases[] = { {1, 1, DOOR_REVERSE_MS}, {1, 0, DOOR_LOCK_MS}, {1, 1, 0} };
+
+static portMUX_TYPE s_door_mux = portMUX_INITIALIZER_UNLOCKED;
+static esp_timer_handle_t s_motor_timer;
+static TaskHandle_t s_door_task = NULL;
+
+// latest command not yet acted on; a newer one replaces it
+static door_cmd_t s_pending = DOOR_CMD_NONE;
+static int64_t s_pending_us;
+
+static const door_phase_t *s_phases = NULL;   // NULL when the motor is idle
+static int s_step;
+static door_cmd_t s_running = DOOR_CMD_NONE;
+static int64_t s_due_us;
+
+static perf_stat_t *s_latency_stat = NULL;
+static perf_stat_t *s_sensor_stat = NULL;
+
+// task notification bits
+#define DOOR_NOTIFY_CMD    (1 << 0)
+#define DOOR_NOTIFY_SENSOR (1 << 1)
+
+static volatile int64_t s_edge_us;
+
+
+static BaseType_t door_command(door_cmd_t cmd)
+{
+    portENTER_CRITICAL(&s_door_mux);
+    s_pending = cmd;
+    s_pending_us = esp_timer_get_time();
+    portEXIT_CRITICAL(&s_door_mux);
+
+    if (s_door_task)
+        xTaskNotify(s_door_task, DOOR_NOTIFY_CMD, eSetBits);
+    return pdTRUE;
+}
+
+// door sensor edges wake the door task instead of it polling
+static void IRAM_ATTR door_sensor_isr(void *arg)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (s_edge_us == 0)
+        s_edge_us = esp_timer_get_time();
+    if (s_door_task)
+        xTaskNotifyFromISR(s_door_task, DOOR_NOTIFY_SENSOR, eSetBits, &woken);
+    if (woken)
+        portYIELD_FROM_ISR();
+}
+
+// (re)arm the sensor edge interrupt; light sleep repurposes the pin as a
+// level wakeup source, so this is also called on wake
+void door_sensor_arm(void)
+{
+    gpio_wakeup_disable(GPIO_PIN_ALARM_SCL);
+    gpio_set_intr_type(GPIO_PIN_ALARM_SCL, GPIO_INTR_ANYEDGE);
+    gpio_intr_enable(GPIO_PIN_ALARM_SCL);
+
+    // the door may have changed while the pin wasn't interrupting
+    if (s_door_task)
+        xTaskNotify(s_door_task, DOOR_NOTIFY_SENSOR, eSetBits);
+}
 
 BaseType_t door_unlock(void)
 {
-    door_evt_t evt;
-    evt.unlock = 1;
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return door_command(DOOR_CMD_UNLOCK);
 }
 
 BaseType_t door_lock(void)
 {
-    door_evt_t evt;
-    evt.unlock = 0;
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return door_command(DOOR_CMD_LOCK);
 }
 
 
-void door_init(void)
+// caller holds s_door_mux
+static void door_motor_phase(int64_t now)
 {
-  m_q = xQueueCreate(DOOR_QUEUE_DEPTH, sizeof(door_evt_t));
-  if (m_q == NULL) {
-      ESP_LOGE(TAG, "FATAL: Cannot create door queue!");
-  }
+  const door_phase_t *p = &s_phases[s_step];
 
-  gpio_set_direction(GPIO_PIN_MOTOR_O1, GPIO_MODE_OUTPUT);
-  gpio_set_direction(GPIO_PIN_MOTOR_O2, GPIO_MODE_OUTPUT);
+  gpio_set_level(GPIO_PIN_MOTOR_O1, p->o1);
+  gpio_set_level(GPIO_PIN_MOTOR_O2, p->o2);
 
-  gpio_set_level(GPIO_PIN_MOTOR_O1, 1);
-  gpio_set_level(GPIO_PIN_MOTOR_O2, 1);
+  if (p->ms == 0) {
+    s_phases = NULL;
+    s_running = DOOR_CMD_NONE;
+    return;
+  }
 
-  gpio_set_direction(GPIO_PIN_ALARM_SCL, GPIO_MODE_INPUT);
+  // phases are timed from the previous deadline, not from when this ran
+  s_due_us += p->ms * 1000;
+  esp_timer_start_once(s_motor_timer, s_due_us > now ? s_due_us - now : 0);
 }
 
-void door_delay(int ms)
+static void door_motor_timer_cb(void *arg)
 {
-    TickType_t delay = ms / portTICK_PERIOD_MS;
-    vTaskDelay(delay);
+  int64_t now = esp_timer_get_time();
+
+  portENTER_CRITICAL(&s_door_mux);
+  // an expiry that raced a restart by door_process() belongs to the old
+  // schedule; the new deadline is still ahead
+  if (s_phases != NULL && now >= s_due_us) {
+    s_step++;
+    door_motor_phase(now);
+  }
+  portEXIT_CRITICAL(&s_door_mux);
 }
 
-void door_actuate_lock(void)
+// act on the latest command: start it, restart the motor the other way,
+// or drop it when the motor is already doing just that
+static void door_process(void)
 {
-  gpio_set_level(GPIO_PIN_MOTOR_O1, 1);
-  gpio_set_level(GPIO_PIN_MOTOR_O2, 0);
-  door_delay(400);
-  gpio_set_level(GPIO_PIN_MOTOR_O1, 1);
-  gpio_set_level(GPIO_PIN_MOTOR_O2, 1);
-
+  int64_t now = esp_timer_get_time();
+  int64_t latency = -1;
+  door_cmd_t cmd;
+  bool reversed = false;
+
+  portENTER_CRITICAL(&s_door_mux);
+  cmd = s_pending;
+  s_pending = DOOR_CMD_NONE;
+
+  if (cmd != DOOR_CMD_NONE && cmd != s_running) {
+    reversed = (s_running != DOOR_CMD_NONE);
+    if (cmd == DOOR_CMD_UNLOCK)
+      s_phases = reversed ? s_unlock_rev_phases : s_unlock_phases;
+    else
+      s_phases = reversed ? s_lock_rev_phases : s_lock_phases;
+
+    esp_timer_stop(s_motor_timer);
+    s_running = cmd;
+    s_step = 0;
+    s_due_us = now;
+    door_motor_phase(now);
+    latency = esp_timer_get_time() - s_pending_us;
+  }
+  portEXIT_CRITICAL(&s_door_mux);
+
+  if (latency >= 0) {
+    perf_record(s_latency_stat, latency);
+    ESP_LOGD(TAG, "%s%s, %lld us after the command", cmd == DOOR_CMD_UNLOCK ? "unlock" : "lock",
+             reversed ? " (reversing)" : "", latency);
+  } else if (cmd != DOOR_CMD_NONE) {
+    ESP_LOGD(TAG, "%s already in progress", cmd == DOOR_CMD_UNLOCK ? "unlock" : "lock");
+  }
 }
 
-void door_actuate_unlock(void)
+
+void door_init(void)
 {
-  gpio_set_level(GPIO_PIN_MOTOR_O1, 0);
-  gpio_set_level(GPIO_PIN_MOTOR_O2, 1);
-  door_delay(300);
+  gpio_set_direction(GPIO_PIN_MOTOR_O1, GPIO_MODE_OUTPUT);
+  gpio_set_direction(GPIO_PIN_MOTOR_O2, GPIO_MODE_OUTPUT);
+
   gpio_set_level(GPIO_PIN_MOTOR_O1, 1);
   gpio_set_level(GPIO_PIN_MOTOR_O2, 1);
+
+  gpio_set_direction(GPIO_PIN_ALARM_SCL, GPIO_MODE_INPUT);
+
+  esp_err_t err = gpio_install_isr_service(0);
+  if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+    ESP_LOGE(TAG, "Could not install GPIO ISR service: %s", esp_err_to_name(err));
+  }
+  gpio_isr_handler_add(GPIO_PIN_ALARM_SCL, door_sensor_isr, NULL);
+  door_sensor_arm();
+
+  const esp_timer_create_args_t timer_args = {
+      .callback = door_motor_timer_cb,
+      .dispatch_method = ESP_TIMER_TASK,
+      .name = "door_motor"
+  };
+  ESP_ERROR_CHECK(esp_timer_create(&timer_args, &s_motor_timer));
+
+  s_latency_stat = perf_register("door_latency", "us");
+  s_sensor_stat = perf_register("door_sensor", "us");
 }
 
 void door_task(void *pvParameters)
 {
     int alarm=0, last_alarm=-1;
 
-    // initially lock after delay
-    door_delay(2000);
-    door_actuate_lock();
+    // the initial lock is requested by main_task (STATE_INITIAL_LOCK) as soon as it starts
 
+    s_door_task = xTaskGetCurrentTaskHandle();
     esp_task_wdt_add(NULL);
 
     while(1) {
-        door_evt_t evt;
+        uint32_t bits = 0;
 
         esp_task_wdt_reset();
 
         alarm = gpio_get_level(GPIO_PIN_ALARM_SCL);
 
+        int64_t edge = s_edge_us;
+        if (edge) {
+            s_edge_us = 0;
+            perf_record(s_sensor_stat, esp_timer_get_time() - edge);
+        }
+
         if (alarm != last_alarm) {
             ESP_LOGD(TAG, "Alarm now=%d", alarm);
 
@@ -140,14 +284,18 @@ void door_task(void *pvParameters)
 
         last_alarm = alarm;
 
-        if (xQueueReceive(m_q, &evt, (20 / portTICK_PERIOD_MS)) == pdPASS) {
-          if (evt.unlock) {
-            // unlock
-            door_actuate_unlock();
-          } else {
-            // lock
-            door_actuate_lock();
-          }
+        door_process();
+
+        // commands and sensor edges notify; otherwise only the watchdog wakes us
+        xTaskNotifyWait(0, UINT32_MAX, &bits, DOOR_WDT_MS / portTICK_PERIOD_MS);
+
+        if (bits & DOOR_NOTIFY_SENSOR) {
+            // let the contact settle before sampling; bounces restart the
+            // wait and a command arriving meanwhile is still acted on at once
+            while (xTaskNotifyWait(0, UINT32_MAX, &bits, DOOR_SETTLE_MS / portTICK_PERIOD_MS) == pdTRUE) {
+                if (bits & DOOR_NOTIFY_CMD)
+                    door_process();
+            }
         }
     }
 }
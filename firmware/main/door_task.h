@@ -39,6 +39,7 @@
 
 void door_task(void *pvParameters);
 void door_init();
+void door_sensor_arm(void);
 
 BaseType_t door_unlock();
 BaseType_t door_lock();
@@ -53,6 +53,7 @@
 #include "beep_task.h"
 #include "system_task.h"
 #include "main_task.h"
+#include "boot_prof.h"
 
 static const char *TAG = "main";
 
@@ -77,35 +78,46 @@ void app_main(void)
     esp_log_set_vprintf(windowed_vprintf);
     */
 
+    boot_mark(BOOT_STAGE_APP_MAIN);
     ESP_LOGI(TAG, "initializing");
 
     ESP_ERROR_CHECK(esp_netif_init());
     ESP_ERROR_CHECK(esp_event_loop_create_default());
 
+    // everything below needs NVS, config and the filesystem
     system_init();
+    boot_mark(BOOT_STAGE_SYSTEM);
 
-#ifdef DISPLAY_ENABLED
+    // display queue only; the panel comes up later
     display_init();
-#endif
 
+    // starts hashing the stored ACL on the application core in the background
     acl_init();
+
+    // scan path first: reader, door and beeper have no dependency on the display
     beep_init();
     door_init();
-
     rfid_init();
     main_task_init();
 
     ESP_LOGI(TAG, "creating tasks");
 
-    xTaskCreate(&system_task, "system_task", 2048, NULL, 5, NULL);
-    xTaskCreate(&beep_task, "beep_task", 2560, NULL, 0, NULL);
-    xTaskCreate(&door_task, "door_task", 2048, NULL, 1, NULL);
-    xTaskCreate(&rfid_task, "rfid_task", 3072, NULL, 1, NULL);
+    xTaskCreatePinnedToCore(&system_task, "system_task", 2048, NULL, TASK_PRIO_SYSTEM, NULL, TASK_CORE(CORE_APP));
+    xTaskCreatePinnedToCore(&door_task, "door_task", 2048, NULL, TASK_PRIO_DOOR, NULL, TASK_CORE(CORE_APP));
+    xTaskCreatePinnedToCore(&rfid_task, "rfid_task", 3072, NULL, TASK_PRIO_RFID, NULL, TASK_CORE(CORE_APP));
+    boot_mark(BOOT_STAGE_SCAN_PATH);
+
+    // overlaps with ACL validation
+    display_init_panel();
+    boot_mark(BOOT_STAGE_DISPLAY);
+
 #ifdef DISPLAY_ENABLED
-    xTaskCreate(&display_task, "display_task", 4096, NULL, 4, NULL);
+    xTaskCreatePinnedToCore(&display_task, "display_task", 4096, NULL, TASK_PRIO_DISPLAY, NULL, TASK_CORE(CORE_APP));
 #endif
-    xTaskCreate(&net_task, "net_task", 4096, NULL, 2, NULL);
-    xTaskCreate(&main_task, "main_task", 2048, NULL, 3, NULL);
+    xTaskCreatePinnedToCore(&net_task, "net_task", 4096, NULL, TASK_PRIO_NET, NULL, TASK_CORE(CORE_NET));
+    // started after the display task so its first screen changes don't wait on a full display queue
+    xTaskCreatePinnedToCore(&main_task, "main_task", 2048, NULL, TASK_PRIO_MAIN, NULL, TASK_CORE(CORE_APP));
+    boot_mark(BOOT_STAGE_TASKS);
 
     ESP_LOGW(TAG, "[APP] Free memory: %d bytes", esp_get_free_heap_size());
 
@@ -46,6 +46,7 @@
 #include "freertos/timers.h"
 #include "system.h"
 #include "esp_task_wdt.h"
+#include "esp_timer.h"
 
 #include "system_task.h"
 #include "beep_task.h"
@@ -54,6 +55,11 @@
 #include "display_task.h"
 #include "net_task.h"
 #include "main_task.h"
+#include "blog.h"
+#include "perf.h"
+#include "boot_prof.h"
+#include "rtc_cache.h"
+#include "pm_ctl.h"
 
 static const char *TAG = "main_task";
 
@@ -74,7 +80,6 @@ typedef enum {
   STATE_PRE_SLEEP2,
   STATE_SLEEPING,
   STATE_WAKE_UP,
-  STATE_WAKING,
   STATE_SHOW_INFO,
   STATE_SHOWING_INFO,
   STATE_OTA_UPDATE,
@@ -97,7 +102,6 @@ static const char* state_names[] =
     "STATE_PRE_SLEEP2",
     "STATE_SLEEPING",
     "STATE_WAKE_UP",
-    "STATE_WAKING",
     "STATE_SHOW_INFO",
     "STATE_SHOWING_INFO",
     "STATE_OTA_UPDATE",
@@ -113,8 +117,29 @@ typedef struct main_evt {
 
 #define MAIN_QUEUE_DEPTH 8
 
+// how long the splash screen stays up at boot before scans are accepted
+#define BOOT_SPLASH_MS 500
+
+// state machine poll interval while waiting for a scan
+#define MAIN_IDLE_POLL_MS 250
+
 static QueueHandle_t m_q;
 
+static perf_stat_t *m_scan_stat;
+
+// waiting for a scan is the only state the CPU may slow down and sleep in
+static pm_class_t main_state_pm_class(main_state_t state)
+{
+  switch (state) {
+    case STATE_WAIT_RFID:
+      return PM_CLASS_IDLE;
+    case STATE_SLEEPING:
+      return PM_CLASS_SLEEP;
+    default:
+      return PM_CLASS_ACTIVE;
+  }
+}
+
 void main_task_init(void)
 {
   ESP_LOGI(TAG, "task init");
@@ -122,6 +147,9 @@ void main_task_init(void)
   if (m_q == NULL) {
     ESP_LOGE(TAG, "FATAL: Cannot create main task queue!");
   }
+
+  // time from an RFID frame being picked up to the state machine acting on the lookup result
+  m_scan_stat = perf_register("scan_to_decision", "us");
 }
 
 
@@ -152,6 +180,10 @@ void main_task(void *pvParameters)
   bool net_connected = false;
   bool door_open = false;
   bool pending_ota_update = false;
+  bool pending_ota_reboot = false;
+  bool woke = false;
+  bool deep_wake = false;
+  int64_t wake_time_us = 0;
 
   esp_task_wdt_add(NULL);
 
@@ -162,12 +194,22 @@ void main_task(void *pvParameters)
 
     esp_task_wdt_reset();
 
-    if (xQueueReceive(m_q, &evt, (20 / portTICK_PERIOD_MS)) == pdTRUE) {
+    // run a newly entered state right away instead of waiting out the poll
+    // interval; waiting for a scan everything arrives as an event, so poll
+    // slowly there and let the CPU sleep
+    TickType_t wait = (state != last_state) ? 0 :
+                      (state == STATE_WAIT_RFID) ? (MAIN_IDLE_POLL_MS / portTICK_PERIOD_MS) : (20 / portTICK_PERIOD_MS);
+
+    if (xQueueReceive(m_q, &evt, wait) == pdTRUE) {
       // handle some events immediately, regardless of system state
       switch(evt.id) {
         case MAIN_EVT_OTA_UPDATE:
           pending_ota_update = true;
           break;
+        case MAIN_EVT_OTA_UPDATE_SUCCESS:
+          // the image is in flash; reboot the next time nobody's at the door
+          pending_ota_reboot = true;
+          break;
         case MAIN_EVT_BATTERY_LOW:
           low_batt = true;
           if (!power_ok) {
@@ -209,18 +251,26 @@ void main_task(void *pvParameters)
           door_open = true;
           net_cmd_queue_door_state(true);
           display_door_state(true);
-          beep_queue(_beep_door_open);
-          ESP_LOGI(TAG, "Door opened");
+          beep_play(_beep_door_open, BEEP_PRIO_LOW);
+          BLOG("main: door opened");
           break;
         case MAIN_EVT_ALARM_DOOR_CLOSED:
           door_open = false;
           net_cmd_queue_door_state(false);
           display_door_state(false);
-          beep_queue(_beep_door_closed);
-          ESP_LOGI(TAG, "Door closed");
+          beep_play(_beep_door_closed, BEEP_PRIO_LOW);
+          BLOG("main: door closed");
           break;
         case MAIN_EVT_UI_BUTTON_PRESS:
-          beep_queue(_beep_button_press);
+          beep_play(_beep_button_press, BEEP_PRIO_LOW);
+          break;
+        case MAIN_EVT_INJECTED_RFID_SCAN:
+          {
+            // stress test replay; measured like a real scan but never acted on
+            member_record_t rec;
+            rfid_get_injected_record(&rec);
+            perf_record(m_scan_stat, esp_timer_get_time() - rec.scan_time_us);
+          }
           break;
         default:
           break;
@@ -228,12 +278,25 @@ void main_task(void *pvParameters)
     }
 
     if (state != last_state) {
-      ESP_LOGI(TAG, "State change: %s -> %s", state_names[last_state], state_names[state]);
+      BLOG("main: state %s -> %s", state_names[last_state], state_names[state]);
+      pm_ctl_state(state, state_names[state], main_state_pm_class(state));
     }
     last_state = state;
 
     switch(state) {
     case STATE_INIT:
+      if (rtc_cache_deep_wake()) {
+        // back from deep sleep: no splash, serve scans (from the RTC cache
+        // until the ACL is validated) while everything else comes up.
+        // esp_timer restarted with this boot, so the wake was at 0
+        woke = deep_wake = true;
+        wake_time_us = 0;
+        door_lock();
+        net_cmd_queue(NET_CMD_CONNECT);
+        state = STATE_START_RFID_READ;
+        break;
+      }
+
       display_show_screen(SCREEN_SPLASH, LV_SCR_LOAD_ANIM_NONE);
       beep_queue(_beep_init);
 
@@ -243,7 +306,7 @@ void main_task(void *pvParameters)
     case STATE_INITIAL_LOCK:
       door_lock();
       net_cmd_queue(NET_CMD_CONNECT);
-      xTimerChangePeriod(timer, 3000 / portTICK_PERIOD_MS, 0);
+      xTimerChangePeriod(timer, BOOT_SPLASH_MS / portTICK_PERIOD_MS, 0);
       xTimerStart(timer, 0);
       state = STATE_WAIT_READ;
       break;
@@ -255,6 +318,7 @@ void main_task(void *pvParameters)
 
     case STATE_START_RFID_READ:
       display_show_screen(SCREEN_IDLE, LV_SCR_LOAD_ANIM_MOVE_RIGHT);
+      boot_mark(BOOT_STAGE_RFID_WAIT);
       state = STATE_WAIT_RFID;
       break;
 
@@ -265,11 +329,17 @@ void main_task(void *pvParameters)
           xTimerStop(timer, 0);
         }
 
+        // the download runs in the background while scans are served
         if (pending_ota_update) {
           pending_ota_update = false;
           net_cmd_queue(NET_CMD_OTA_UPDATE);
+        }
+
+        if (pending_ota_reboot && !door_open && evt.id == MAIN_EVT_NONE) {
+          pending_ota_reboot = false;
           display_show_screen(SCREEN_OTA, LV_SCR_LOAD_ANIM_MOVE_TOP);
           state = STATE_OTA_UPDATE;
+          break;
         }
       } else {
         if (!xTimerIsTimerActive(timer)) {
@@ -279,17 +349,25 @@ void main_task(void *pvParameters)
         }
       }
 
+      if (woke && (evt.id == MAIN_EVT_VALID_RFID_SCAN || evt.id == MAIN_EVT_INVALID_RFID_SCAN)) {
+        uint32_t elapsed_ms = (esp_timer_get_time() - wake_time_us) / 1000;
+        BLOG("main: first scan %u ms after %s wake (network %s)", elapsed_ms,
+             deep_wake ? "deep sleep" : "light sleep", net_connected ? "up" : "down");
+        rtc_cache_wake_latency(deep_wake, elapsed_ms);
+        woke = false;
+      }
+
       switch (evt.id) {
         case MAIN_EVT_RFID_PRE_SCAN:
           beep_queue(_beep_pre_scan);
           break;
         case MAIN_EVT_VALID_RFID_SCAN:
-          display_show_screen(SCREEN_ACCESS, LV_SCR_LOAD_ANIM_MOVE_LEFT);
+          // the access screen is shown by display_allowed_msg() once the
+          // result is known, no slide-in with stale content
           state = STATE_RFID_VALID;
           break;
         case MAIN_EVT_INVALID_RFID_SCAN:
           xTimerStop(timer, 0);
-          display_show_screen(SCREEN_ACCESS, LV_SCR_LOAD_ANIM_MOVE_LEFT);
           state = STATE_RFID_INVALID;
           break;
 
@@ -309,12 +387,15 @@ void main_task(void *pvParameters)
     case STATE_RFID_VALID:
       {
         rfid_get_member_record(&active_member_record);
+        perf_record(m_scan_stat, esp_timer_get_time() - active_member_record.scan_time_us);
+        boot_mark(BOOT_STAGE_FIRST_SCAN);
 
-        display_allowed_msg(active_member_record.name, active_member_record.allowed);
+        display_allowed_msg(active_member_record.name, active_member_record.allowed ? ACCESS_RESULT_ALLOWED : ACCESS_RESULT_DENIED);
 
         if (active_member_record.allowed) {
-          ESP_LOGI(TAG, "MEMBER ALLOWED");
-          beep_queue(_beep_allowed);
+          BLOG("main: member allowed, tag %010u%s", active_member_record.tag,
+               active_member_record.from_cache ? " (RTC cache)" : "");
+          beep_play(_beep_allowed, BEEP_PRIO_ACCESS);
           door_unlock();
 
           xTimerChangePeriod(timer, 7000 / portTICK_PERIOD_MS, 0);
@@ -322,8 +403,8 @@ void main_task(void *pvParameters)
 
           state = STATE_UNLOCKED;
         } else {
-          ESP_LOGI(TAG, "MEMBER DENIED");
-          beep_queue(_beep_denied);
+          BLOG("main: member denied, tag %010u", active_member_record.tag);
+          beep_play(_beep_denied, BEEP_PRIO_ACCESS);
 
           xTimerChangePeriod(timer, 10000 / portTICK_PERIOD_MS, 0);
           xTimerStart(timer, 0);
@@ -338,10 +419,12 @@ void main_task(void *pvParameters)
     case STATE_RFID_INVALID:
       {
         rfid_get_member_record(&active_member_record);
+        perf_record(m_scan_stat, esp_timer_get_time() - active_member_record.scan_time_us);
+        boot_mark(BOOT_STAGE_FIRST_SCAN);
 
-        display_allowed_msg("Unknown RFID", false);
+        display_allowed_msg("Unknown RFID", ACCESS_RESULT_UNKNOWN);
 
-        beep_queue(_beep_invalid);
+        beep_play(_beep_invalid, BEEP_PRIO_ACCESS);
 
         char tagstr[12];
         snprintf(tagstr, sizeof(tagstr), "%10.10u", active_member_record.tag);
@@ -409,14 +492,24 @@ void main_task(void *pvParameters)
     case STATE_SLEEPING:
       system_sleep();
       // zzzz...
+#ifdef DEEP_SLEEP_AFTER_MIN
+      if (system_sleep_timed_out()) {
+        // a long outage; only returns if main power came back meanwhile
+        system_deep_sleep();
+      }
+#endif
       state = STATE_WAKE_UP;
       break;
 
     case STATE_WAKE_UP:
+      woke = true;
+      deep_wake = false;
+      wake_time_us = esp_timer_get_time();
       system_wake();
-      display_show_screen(SCREEN_SPLASH, LV_SCR_LOAD_ANIM_FADE_ON);
 
-      vTaskDelay(1000/portTICK_PERIOD_MS);
+      // the ACL is local, so go straight back to serving scans; the network
+      // reconnects in the background and queued MQTT events publish once it's up
+      display_show_screen(SCREEN_IDLE, LV_SCR_LOAD_ANIM_FADE_ON);
 
       net_cmd_queue(NET_CMD_CONNECT);
       net_cmd_queue_power_status(POWER_STATUS_WAKE);
@@ -425,14 +518,9 @@ void main_task(void *pvParameters)
         display_power_status(POWER_STATUS_ON_BATT);
         net_cmd_queue_power_status(POWER_STATUS_ON_BATT);
       }
-      state = STATE_WAKING;
-      break;
 
-    case STATE_WAKING:
-      if (net_connected) {
-        display_show_screen(SCREEN_IDLE, LV_SCR_LOAD_ANIM_FADE_ON);
-        state = STATE_START_RFID_READ;
-      }
+      ESP_LOGI(TAG, "ready for scans %lld ms after wake", (esp_timer_get_time() - wake_time_us) / 1000);
+      state = STATE_WAIT_RFID;
       break;
 
     case STATE_SHOW_INFO:
@@ -453,10 +541,10 @@ void main_task(void *pvParameters)
       break;
 
     case STATE_OTA_UPDATE:
-      if (evt.id == MAIN_EVT_OTA_UPDATE_FAILED) {
-        display_show_screen(SCREEN_IDLE, LV_SCR_LOAD_ANIM_MOVE_BOTTOM);
-        state = STATE_START_RFID_READ;
-      } else if (evt.id == MAIN_EVT_OTA_UPDATE_SUCCESS) {
+      {
+        // the only part of an update that takes the reader offline
+        display_ota_status(OTA_STATUS_APPLYING, 100);
+        vTaskDelay(1000/portTICK_PERIOD_MS);
         display_show_screen(SCREEN_BLANK, LV_SCR_LOAD_ANIM_FADE_ON);
         net_cmd_queue(NET_CMD_DISCONNECT);
 
@@ -469,7 +557,6 @@ void main_task(void *pvParameters)
             vTaskDelay(1000 / portTICK_PERIOD_MS);
         }
       }
-
       break;
 
     default:
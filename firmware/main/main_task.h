@@ -58,6 +58,7 @@ typedef enum {
   MAIN_EVT_ALARM_DOOR_OPEN,
   MAIN_EVT_ALARM_DOOR_CLOSED,
   MAIN_EVT_UI_BUTTON_PRESS,
+  MAIN_EVT_INJECTED_RFID_SCAN,
 } main_evt_id_t;
 
 void main_task(void *pvParameters);
@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <errno.h>
 #include <signal.h>
 #include <sys/socket.h>
@@ -16,15 +17,139 @@
 #include "esp_http_client.h"
 #include "esp_crt_bundle.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "system.h"
+#include "pm_ctl.h"
+#include "net_wifi_ps.h"
 
 static const char *TAG = "https";
 
+#define HTTP_RESUME_DELAY_MS 2000   // backoff before resume n is n times this
+#define HTTP_KBPS_MIN_BYTES  8192   // smaller bodies measure latency more than throughput
+
 static SemaphoreHandle_t s_busy_mutex;
 static int s_fd = 0;
 static mbedtls_md_context_t s_md_ctx;
 
 static http_get_req_t* s_req;
 
+//
+// Download checkpoint, kept across the attempts of one http_get().  The
+// body bytes already written to the file or sink and the hash context
+// fed with them stay valid after a dropped connection, so a resumed
+// attempt just asks for the rest with a Range request.
+//
+static struct {
+  size_t total;         // whole body length, from the first response
+  size_t received;      // body bytes delivered so far
+  size_t transferred;   // body bytes over all attempts
+  char etag[64];
+  bool resuming;        // this attempt sent Range/If-Range
+  bool started;         // this attempt's status has been checked
+  bool accept;          // this attempt's body continues the download
+  bool changed;         // the server no longer has the same body
+  bool headers;         // this attempt's whole-body headers have started
+} s_dl;
+
+//
+// Write-behind for file downloads.  The body arrives in chunks of a few
+// hundred bytes, and each write() to the wear-levelled FAT partition
+// costs a read-modify-write of a whole CONFIG_WL_SECTOR_SIZE sector, so
+// chunks are gathered into full, sector-aligned writes and the tail is
+// written and synced when the download completes.
+//
+#define HTTP_WB_SECTOR CONFIG_WL_SECTOR_SIZE
+
+static struct {
+  uint8_t *buf;         // NULL: write through
+  size_t fill;
+  size_t offset;        // file offset of the next write
+  uint32_t calls;
+  uint32_t sectors;     // flash sectors the writes touched
+  int64_t us;
+} s_wb;
+
+static esp_err_t http_file_write(const void *data, size_t len)
+{
+  int64_t t0 = esp_timer_get_time();
+  int r = write(s_fd, data, len);
+
+  s_wb.us += esp_timer_get_time() - t0;
+  s_wb.calls++;
+  s_wb.sectors += (s_wb.offset + len - 1) / HTTP_WB_SECTOR - s_wb.offset / HTTP_WB_SECTOR + 1;
+  s_wb.offset += len;
+
+  if (r != (int) len) {
+    ESP_LOGE(TAG, "error writing %u bytes to file", len);
+    return ESP_FAIL;
+  }
+  return ESP_OK;
+}
+
+static esp_err_t http_file_put(const uint8_t *data, size_t len)
+{
+  esp_err_t r = ESP_OK;
+
+  if (s_wb.buf == NULL) {
+    return http_file_write(data, len);
+  }
+
+  while (len && r == ESP_OK) {
+    size_t n = HTTP_WB_SECTOR - s_wb.fill;
+    n = n < len ? n : len;
+    memcpy(s_wb.buf + s_wb.fill, data, n);
+    s_wb.fill += n;
+    data += n;
+    len -= n;
+
+    if (s_wb.fill == HTTP_WB_SECTOR) {
+      r = http_file_write(s_wb.buf, s_wb.fill);
+      s_wb.fill = 0;
+    }
+  }
+  return r;
+}
+
+static esp_err_t http_file_flush(void)
+{
+  esp_err_t r = ESP_OK;
+
+  if (s_wb.fill) {
+    r = http_file_write(s_wb.buf, s_wb.fill);
+    s_wb.fill = 0;
+  }
+  if (r == ESP_OK && fsync(s_fd) != 0) {
+    r = ESP_FAIL;
+  }
+  return r;
+}
+
+// first body bytes of an attempt: decide whether they continue the download
+static void http_get_check_attempt(esp_http_client_handle_t client)
+{
+  int status = esp_http_client_get_status_code(client);
+
+  s_dl.started = true;
+  s_dl.accept = !s_dl.resuming || status == 206;
+
+  if (s_dl.resuming && status == 200) {
+    // If-Range didn't match: the body changed, start it over if we can
+    if (s_req->filename && lseek(s_fd, 0, SEEK_SET) == 0 && ftruncate(s_fd, 0) == 0) {
+      ESP_LOGW(TAG, "body changed on the server, starting over");
+      s_dl.received = 0;
+      s_wb.fill = 0;
+      s_wb.offset = 0;
+      s_dl.accept = true;
+      if (s_req->resp_hash_buf) {
+        mbedtls_md_starts(&s_md_ctx);
+      }
+    } else {
+      s_dl.changed = true;
+    }
+  }
+}
+
 esp_err_t http_init(void)
 {
     s_busy_mutex = xSemaphoreCreateMutex();
@@ -35,9 +160,6 @@ esp_err_t http_init(void)
 
 static esp_err_t http_get_file_event_handler(esp_http_client_event_t *evt)
 {
-    static size_t content_length = 0;
-    static size_t received_length = 0;
-
     esp_task_wdt_reset();
 
     switch(evt->event_id) {
@@ -46,17 +168,8 @@ static esp_err_t http_get_file_event_handler(esp_http_client_event_t *evt)
             break;
         case HTTP_EVENT_ON_CONNECTED:
             ESP_LOGD(TAG, "HTTP_EVENT_ON_CONNECTED");
-
-            content_length = 0;
-            received_length = 0;
-
-            if (s_req->resp_hash_buf) {
-              mbedtls_md_init(&s_md_ctx);
-              if (mbedtls_md_setup(&s_md_ctx, mbedtls_md_info_from_type(MBEDTLS_MD_SHA224), 0) != ESP_OK ||
-                  mbedtls_md_starts(&s_md_ctx) != ESP_OK) {
-                  ESP_LOGE(TAG, "error setting up mbedtls");
-              }
-            }
+            s_dl.started = false;
+            s_dl.headers = false;
             break;
         case HTTP_EVENT_HEADER_SENT:
             ESP_LOGD(TAG, "HTTP_EVENT_HEADER_SENT");
@@ -64,9 +177,25 @@ static esp_err_t http_get_file_event_handler(esp_http_client_event_t *evt)
         case HTTP_EVENT_ON_HEADER:
             ESP_LOGD(TAG, "HTTP_EVENT_ON_HEADER %s=%s", evt->header_key, evt->header_value);
 
-            if (strcmp(evt->header_key, "Content-Length")==0) {
-              content_length = atoi(evt->header_value);
+            // a 206 describes the rest of the body we have; a 200 (always on
+            // the first attempt, or a resume after the body changed) the whole
+            // of a body, whose length, ETag and hash replace any we had
+            if (s_dl.resuming && esp_http_client_get_status_code(evt->client) != 200) {
+              break;
+            }
+            if (!s_dl.headers) {
+              // a changed body may come without an ETag or hash
+              s_dl.headers = true;
+              s_dl.etag[0] = '\0';
+              s_req->resp_hash_server[0] = '\0';
+            }
+
+            if (strcasecmp(evt->header_key, "Content-Length")==0) {
+              s_dl.total = atoi(evt->header_value);
+            } else if (strcasecmp(evt->header_key, "ETag")==0) {
+              strlcpy(s_dl.etag, evt->header_value, sizeof(s_dl.etag));
             } else if (strcmp(evt->header_key, "X-Hash-SHA224")==0) {
+              strlcpy(s_req->resp_hash_server, evt->header_value, sizeof(s_req->resp_hash_server));
 
               if (s_req->hash_expected && strcmp(evt->header_value, s_req->hash_expected)==0) {
                 if (s_req->hash_expected_cancel) {
@@ -91,10 +220,18 @@ static esp_err_t http_get_file_event_handler(esp_http_client_event_t *evt)
         case HTTP_EVENT_ON_DATA:
             if (!esp_http_client_is_chunked_response(evt->client)) {
                 ESP_LOGD(TAG, "Receive %d bytes", evt->data_len);
-                received_length += evt->data_len;
+                if (!s_dl.started) {
+                  http_get_check_attempt(evt->client);
+                }
+
+                s_dl.transferred += evt->data_len;
+                if (!s_dl.accept) {
+                  break;
+                }
+                s_dl.received += evt->data_len;
 
                 if (s_req->progress_cb) {
-                  s_req->progress_cb(received_length, content_length);
+                  s_req->progress_cb(s_dl.received, s_dl.total);
                 }
 
                 if (s_req->resp_hash_buf) {
@@ -103,27 +240,21 @@ static esp_err_t http_get_file_event_handler(esp_http_client_event_t *evt)
                   }
                 }
 
-                int r = write(s_fd, evt->data, evt->data_len);
-                if (r < 0) {
-                  ESP_LOGE(TAG, "error writing %d bytes to file", evt->data_len);
+                if (s_req->filename) {
+                  if (!s_req->resp_data_err && http_file_put(evt->data, evt->data_len) != ESP_OK) {
+                    s_req->resp_data_err = true;
+                  }
+                } else if (!s_req->resp_data_err) {
+                  if (s_req->data_cb(s_req->data_ctx, evt->data, evt->data_len) != ESP_OK) {
+                    ESP_LOGE(TAG, "data sink rejected %d bytes", evt->data_len);
+                    s_req->resp_data_err = true;
+                  }
                 }
             }
 
             break;
         case HTTP_EVENT_ON_FINISH:
             ESP_LOGD(TAG, "HTTP_EVENT_ON_FINISH");
-            if (s_req->resp_hash_buf) {
-              uint8_t hbuf[32];
-              mbedtls_md_finish(&s_md_ctx, hbuf);
-              mbedtls_md_free(&s_md_ctx);
-
-              if (!s_req->resp_hash_expected_match) {
-                for (uint8_t idx=0; idx<(224/8); idx++) {
-                  sprintf(s_req->resp_hash_buf + (idx * 2), "%2.2x", hbuf[idx]);
-                }
-              }
-
-            }
             break;
         case HTTP_EVENT_DISCONNECTED:
             ESP_LOGD(TAG, "HTTP_EVENT_DISCONNECTED");
@@ -138,6 +269,10 @@ esp_err_t http_get(http_get_req_t* req)
   xSemaphoreTake(s_busy_mutex, portMAX_DELAY);
 
   s_req = req;
+  req->resp_data_err = false;
+  req->resp_resumes = 0;
+  req->resp_hash_server[0] = '\0';
+  memset(&s_dl, 0, sizeof(s_dl));
 
   esp_http_client_config_t config = {
      .url = req->url
@@ -152,6 +287,13 @@ esp_err_t http_get(http_get_req_t* req)
         return ESP_FAIL;
     }
 
+    memset(&s_wb, 0, sizeof(s_wb));
+#ifdef HTTP_WRITE_BEHIND
+    s_wb.buf = malloc(HTTP_WB_SECTOR);
+#endif
+
+    config.event_handler = http_get_file_event_handler;
+  } else if (req->data_cb) {
     config.event_handler = http_get_file_event_handler;
   }
 
@@ -172,23 +314,116 @@ esp_err_t http_get(http_get_req_t* req)
     config.crt_bundle_attach = esp_crt_bundle_attach;
   }
 
-  esp_http_client_handle_t client = esp_http_client_init(&config);
-  esp_err_t err = esp_http_client_perform(client);
+  if (req->resp_hash_buf) {
+    mbedtls_md_init(&s_md_ctx);
+    if (mbedtls_md_setup(&s_md_ctx, mbedtls_md_info_from_type(MBEDTLS_MD_SHA224), 0) != ESP_OK ||
+        mbedtls_md_starts(&s_md_ctx) != ESP_OK) {
+        ESP_LOGE(TAG, "error setting up mbedtls");
+    }
+  }
 
-  if (err == ESP_OK) {
-    req->resp_status = esp_http_client_get_status_code(client);
-    req->resp_content_length = esp_http_client_get_content_length(client);
+  int64_t t_start = esp_timer_get_time();
+  esp_err_t err;
+  net_wifi_ps_transfer(true);
+  for (;;) {
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+
+    if (s_dl.resuming) {
+      char range[32];
+      snprintf(range, sizeof(range), "bytes=%u-", s_dl.received);
+      esp_http_client_set_header(client, "Range", range);
+      esp_http_client_set_header(client, "If-Range", s_dl.etag);
+    }
+
+    // TLS handshake and body hashing at full speed
+    pm_busy_begin();
+    err = esp_http_client_perform(client);
+    pm_busy_end();
+    if (err == ESP_OK) {
+      req->resp_status = esp_http_client_get_status_code(client);
+      req->resp_content_length = esp_http_client_get_content_length(client);
+    }
+    esp_http_client_cleanup(client);
+
+    // only a body cut short of its Content-Length is worth resuming
+    bool cut_short = (err != ESP_OK || s_dl.received < s_dl.total) &&
+                     s_dl.total && !req->resp_hash_expected_match &&
+                     (req->resp_status == 200 || req->resp_status == 206 || err != ESP_OK);
+    if (!cut_short) {
+      break;
+    }
+
+    if (!s_dl.etag[0] || s_dl.changed || req->resp_data_err ||
+        req->resp_resumes >= req->resume_retries) {
+      ESP_LOGE(TAG, "download of %s failed at %u of %u bytes", req->url, s_dl.received, s_dl.total);
+      err = ESP_FAIL;
+      break;
+    }
 
+    req->resp_resumes++;
+    ESP_LOGW(TAG, "connection lost at %u of %u bytes, resuming (%d)", s_dl.received, s_dl.total,
+             req->resp_resumes);
+    s_dl.resuming = true;
+    vTaskDelay(HTTP_RESUME_DELAY_MS * req->resp_resumes / portTICK_PERIOD_MS);
+  }
+
+  if (err == ESP_OK && s_dl.resuming && !req->resp_hash_expected_match) {
+    if (s_dl.received == s_dl.total && !s_dl.changed) {
+      // report the download as a whole rather than the last partial response
+      req->resp_status = 200;
+      req->resp_content_length = s_dl.total;
+    } else {
+      ESP_LOGE(TAG, "resume of %s refused with status %d", req->url, req->resp_status);
+      err = ESP_FAIL;
+    }
+  }
+  req->resp_bytes_transferred = s_dl.transferred;
+
+  net_wifi_ps_transfer(false);
+  uint32_t dl_ms = (esp_timer_get_time() - t_start) / 1000;
+  if (err == ESP_OK && dl_ms && s_dl.transferred >= HTTP_KBPS_MIN_BYTES) {
+    net_wifi_ps_record_kbps(s_dl.transferred / dl_ms * 1000 / 1024);
+  }
+
+  if (req->resp_hash_buf) {
+    uint8_t hbuf[32];
+    mbedtls_md_finish(&s_md_ctx, hbuf);
+    mbedtls_md_free(&s_md_ctx);
+
+    if (err == ESP_OK && !req->resp_hash_expected_match) {
+      for (uint8_t idx=0; idx<(224/8); idx++) {
+        sprintf(req->resp_hash_buf + (idx * 2), "%2.2x", hbuf[idx]);
+      }
+    }
+  }
+
+  if (err == ESP_OK) {
     ESP_LOGD(TAG, "Status = %d, content_length = %u", req->resp_status, req->resp_content_length);
     if (!req->resp_hash_expected_match && req->resp_hash_buf) {
       ESP_LOGI(TAG, "Calculated SHA224 hash %s", req->resp_hash_buf);
     }
-
+    if (req->resp_resumes) {
+      ESP_LOGW(TAG, "%u byte body took %u bytes over %d resumes", s_dl.total, s_dl.transferred,
+               req->resp_resumes);
+    }
   }
-  esp_http_client_cleanup(client);
 
   if (req->filename) {
+    if (http_file_flush() != ESP_OK) {
+      req->resp_data_err = true;
+    }
+    if (req->resp_data_err) {
+      ESP_LOGE(TAG, "error writing %s", req->filename);
+      err = ESP_FAIL;
+    }
     close(s_fd);
+    free(s_wb.buf);
+
+    // sectors x sector size over bytes is roughly what wear levelling rewrites
+    ESP_LOGI(TAG, "%s: %u bytes in %lld ms, %u writes (%lld ms) over %u sectors, %u.%02ux write amplification",
+             req->filename, s_wb.offset, (esp_timer_get_time() - t_start) / 1000, s_wb.calls, s_wb.us / 1000,
+             s_wb.sectors, s_wb.offset ? s_wb.sectors * HTTP_WB_SECTOR / s_wb.offset : 0,
+             s_wb.offset ? (s_wb.sectors * HTTP_WB_SECTOR * 100 / s_wb.offset) % 100 : 0);
   }
   xSemaphoreGive(s_busy_mutex);
   return err;
@@ -18,13 +18,22 @@ typedef struct {
   char *data_buf;
   size_t data_buf_len;
 
+  esp_err_t (*data_cb)(void *ctx, const void *data, size_t len);  // streaming sink used when filename is NULL
+  void *data_ctx;
+
   char *hash_expected;    // set hash_buf to NULL and set this to the expected hash; won't download if matches the X-Hash-SHA224 header value
   bool hash_expected_cancel;
 
+  int resume_retries;           // Range requests after a dropped connection; needs an ETag from the server
+
   int resp_status;
   size_t resp_content_length;
   char *resp_hash_buf;         // MUST be at least 57 bytes; if NULL no hash will be returned
+  char resp_hash_server[57];    // X-Hash-SHA224 the server sent for the body, "" if none
   bool resp_hash_expected_match;
+  bool resp_data_err;           // data_cb or file write failed; the rest of the body was dropped
+  int resp_resumes;
+  size_t resp_bytes_transferred;  // body bytes over all attempts, including any started over
 } http_get_req_t;
 
 esp_err_t http_get(http_get_req_t* req);
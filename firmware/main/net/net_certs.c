@@ -91,13 +91,11 @@ esp_err_t net_certs_load(const char* filename, char** buf)
 
 esp_err_t net_certs_init()
 {
-  char *conf_ca_cert;
-  char *conf_client_cert;
-  char *conf_client_key;
-  config_get_string("ca_cert", &conf_ca_cert, "/config/ca.crt");
-  config_get_string("client_cert", &conf_client_cert, "/config/client.crt");
-  config_get_string("client_key", &conf_client_key, "/config/client.key");
-
+  // pinned, the certs are read from flash
+  const config_t *cfg = config_acquire();
+  const char *conf_ca_cert = cfg->ca_cert;
+  const char *conf_client_cert = cfg->client_cert;
+  const char *conf_client_key = cfg->client_key;
 
   if (net_certs_load(conf_ca_cert, &g_ca_cert) != ESP_OK) {
     g_ca_cert = NULL;
@@ -111,9 +109,7 @@ esp_err_t net_certs_init()
     g_client_key = NULL;
   }
 
-  free(conf_ca_cert);
-  free(conf_client_cert);
-  free(conf_client_key);
+  config_release(cfg);
 
   if (g_ca_cert == NULL || g_client_cert == NULL || g_client_key == NULL) {
     ESP_LOGE(TAG, "One or more certificates failed to load!");
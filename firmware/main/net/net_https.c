@@ -49,6 +49,9 @@
 
 #include "https.h"
 #include "net_certs.h"
+#include "system.h"
+#include "spiflash.h"
+#include "rtc_cache.h"
 #include "config.h"
 #include "acl.h"
 #include "rfid_task.h"
@@ -88,39 +91,31 @@ esp_err_t net_https_download_acl()
   char *url = NULL;
   char *hash_buf = NULL;
   char *hash_expected = NULL;
-  char *conf_acl_url_fmt = NULL;
-  char *conf_acl_resource = NULL;
-  char *conf_acl_filename = NULL;
-  char *conf_acl_temp_filename = NULL;
-  char *conf_acl_hash_filename = NULL;
-  char *conf_api_user = NULL;
-  char *conf_api_password = NULL;
+  // one snapshot for the whole download so all keys are consistent; pinned
+  // because config changes can arrive over MQTT while we're downloading
+  const config_t *cfg = config_acquire();
+  const char *conf_acl_filename = cfg->acl_file;
+  const char *conf_acl_temp_filename = cfg->acl_temp_file;
+  const char *conf_acl_hash_filename = cfg->acl_hash_file;
 
   url = malloc(url_len);
   hash_buf = malloc(sha224_len);
   hash_expected = malloc(sha224_len);
 
   // construct the URL
-  config_get_string("acl_url_fmt", &conf_acl_url_fmt, "https://my-server.org:443/auth/api/v0/resources/%s/acl");
-  config_get_string("acl_resource", &conf_acl_resource, "frontdoor");
-  snprintf(url, url_len, conf_acl_url_fmt, conf_acl_resource);
-
-  acl_get_data_filename(&conf_acl_filename);
-  acl_get_hash_filename(&conf_acl_hash_filename);
-  config_get_string("acl_temp_file", &conf_acl_temp_filename, "/config/acltemp.csv");
-
-  config_get_string("api_user", &conf_api_user, "username");
-  config_get_string("api_password", &conf_api_password, "password");
+  snprintf(url, url_len, cfg->acl_url_fmt, cfg->acl_resource);
 
   xSemaphoreTake(g_acl_mutex, portMAX_DELAY);
-  acl_get_stored_hash__acl_mutex(conf_acl_hash_filename, hash_expected);
+  if (acl_get_stored_hash__acl_mutex(conf_acl_filename, hash_expected, NULL) != ESP_OK) {
+    hash_expected[0] = '\0';
+  }
   xSemaphoreGive(g_acl_mutex);
 
   // Build the HTTP(s) request
   http_get_req_t req = {
     .url = url,
-    .auth_user = conf_api_user,
-    .auth_password = conf_api_password,
+    .auth_user = cfg->api_user,
+    .auth_password = cfg->api_password,
     .filename = conf_acl_temp_filename,
     .client_cert_pem = g_client_cert,
     .client_key_pem = g_client_key,
@@ -129,6 +124,7 @@ esp_err_t net_https_download_acl()
 
     .hash_expected = hash_expected,
     .hash_expected_cancel = true,
+    .resume_retries = HTTP_RESUME_RETRIES,
 
     .progress_cb = acl_progress,
 
@@ -151,56 +147,22 @@ esp_err_t net_https_download_acl()
       display_acl_status(ACL_STATUS_DOWNLOADED_SAME_HASH, 100);
       net_cmd_queue(NET_CMD_SEND_ACL_UPDATED);
     } else {
+      // the hash goes in a trailer on the downloaded file, so installing the
+      // ACL together with its hash is a single rename: atomic on LittleFS,
+      // and on FAT acl_validate() finishes an unlink + rename cut in half
       xSemaphoreTake(g_acl_mutex, portMAX_DELAY);
-
-      // delete existing ACL file if it exists
-      struct stat st;
-      if (stat(conf_acl_filename, &st) == 0) {
-        if (unlink(conf_acl_filename) != 0) {
-          ESP_LOGE(TAG, "Could not delete old ACL file %s", conf_acl_filename);
-          xSemaphoreGive(g_acl_mutex);
-          goto failed;
-        }
-      }
-
-      ESP_LOGD(TAG, "Deleted old ACL file %s", conf_acl_filename);
-
-      // move downloaded ACL in place
-      if (rename(conf_acl_temp_filename, conf_acl_filename) != 0) {
-        ESP_LOGE(TAG, "Could not rename downloaded ACL file %s -> %s", conf_acl_temp_filename, conf_acl_filename);
+      if (acl_append_hash__acl_mutex(conf_acl_temp_filename, req.resp_hash_buf) != ESP_OK ||
+          spiflash_replace(conf_acl_temp_filename, conf_acl_filename) != ESP_OK) {
         xSemaphoreGive(g_acl_mutex);
         goto failed;
       }
+      // hash file from before the trailer format
+      unlink(conf_acl_hash_filename);
+      rtc_cache_set_acl_gen(req.resp_hash_buf);
+      xSemaphoreGive(g_acl_mutex);
 
       ESP_LOGD(TAG, "Moved temporary ACL file %s -> %s.", conf_acl_temp_filename, conf_acl_filename);
 
-      // delete temp ACL file if it exists
-      if (stat(conf_acl_temp_filename, &st) == 0) {
-        if (unlink(conf_acl_temp_filename) != 0) {
-          ESP_LOGE(TAG, "Could not delete temp ACL file %s", conf_acl_temp_filename);
-          xSemaphoreGive(g_acl_mutex);
-          goto failed;
-        }
-      }
-
-
-      // save the hash of the ACL to a separate file
-      int fd = open(conf_acl_hash_filename, O_WRONLY|O_CREAT|O_TRUNC);
-      if (fd < 0) {
-          ESP_LOGE(TAG, "Can't open ACL hash file %s for write", conf_acl_hash_filename);
-          xSemaphoreGive(g_acl_mutex);
-          goto failed;
-      }
-      int r = write(fd, req.resp_hash_buf, strlen(req.resp_hash_buf)+1);
-      if (r < 0) {
-        ESP_LOGE(TAG, "Error writing to ACL hash file %s", conf_acl_hash_filename);
-        close(fd);
-        xSemaphoreGive(g_acl_mutex);
-        goto failed;
-      }
-      close(fd);
-      xSemaphoreGive(g_acl_mutex);
-
       display_acl_status(ACL_STATUS_DOWNLOADED_UPDATED, 100);
       net_cmd_queue(NET_CMD_SEND_ACL_UPDATED);
     }
@@ -224,13 +186,7 @@ done:
   free(url);
   free(hash_buf);
   free(hash_expected);
-  free(conf_acl_filename);
-  free(conf_acl_temp_filename);
-  free(conf_acl_hash_filename);
-  free(conf_acl_url_fmt);
-  free(conf_acl_resource);
-  free(conf_api_user);
-  free(conf_api_password);
+  config_release(cfg);
 
   return r;
 }
@@ -254,13 +210,15 @@ int net_https_get_file(const char *web_url, const char *filename)
     .ssl_insecure = false,
 
     .progress_cb = NULL,
+    .resume_retries = HTTP_RESUME_RETRIES,
 
     .resp_hash_buf = NULL,
   };
 
   r = http_get(&req);
 
-  ESP_LOGI(TAG, "http_get returned %d", req.resp_status);
+  ESP_LOGI(TAG, "http_get returned %d, %u bytes transferred, %d resumes", req.resp_status,
+           req.resp_bytes_transferred, req.resp_resumes);
   if (r != ESP_OK) {
     goto failed;
   }
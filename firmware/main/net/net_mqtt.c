@@ -71,13 +71,131 @@
 #include "rfid_task.h"
 #include "net_task.h"
 #include "net_mqtt.h"
+#include "net_ota.h"
 #include "net_certs.h"
 #include "display_task.h"
+#include "blog.h"
+#include "boot_prof.h"
+#include "rtc_cache.h"
+#include "pm_ctl.h"
+#include "net_wifi_ps.h"
 
 static const char *TAG = "net_mqtt";
 
 static esp_mqtt_client_handle_t s_mqtt_client;
 static bool s_mqtt_connected = false;
+static char s_config_set_topic[128];
+static char s_log_dump_topic[128];
+
+// QoS 1/2 messages produced while the broker is unreachable (e.g. scans served
+// right after wake) are held here and published from the net task on reconnect
+#define MQTT_PENDING_DEPTH 16
+
+typedef struct {
+  char *topic;
+  char *payload;
+  int qos;
+} mqtt_pending_t;
+
+static mqtt_pending_t s_pending[MQTT_PENDING_DEPTH];
+static int s_pending_head = 0;
+static int s_pending_count = 0;
+
+static int net_mqtt_pending_push(const char *topic, const char *payload, int qos)
+{
+  if (s_pending_count == MQTT_PENDING_DEPTH) {
+    mqtt_pending_t *oldest = &s_pending[s_pending_head];
+    ESP_LOGW(TAG, "pending queue full, dropping message for '%s'", oldest->topic);
+    free(oldest->topic);
+    free(oldest->payload);
+    s_pending_head = (s_pending_head + 1) % MQTT_PENDING_DEPTH;
+    s_pending_count--;
+    rtc_cache_event_dropped();
+  }
+
+  mqtt_pending_t *p = &s_pending[(s_pending_head + s_pending_count) % MQTT_PENDING_DEPTH];
+  p->topic = strdup(topic);
+  p->payload = strdup(payload);
+  p->qos = qos;
+  if (!p->topic || !p->payload) {
+    free(p->topic);
+    free(p->payload);
+    return -1;
+  }
+  s_pending_count++;
+  rtc_cache_event_queued();
+
+  ESP_LOGD(TAG, "queued message for '%s' while offline (%d pending)", topic, s_pending_count);
+  return 0;
+}
+
+static int net_mqtt_publish(const char *topic, const char *payload, int qos)
+{
+  if (s_mqtt_connected) {
+    int msg_id = esp_mqtt_client_publish(s_mqtt_client, topic, payload, 0, qos, 0);
+    if (msg_id != -1) {
+      net_wifi_ps_mqtt_sent(msg_id);
+      display_mqtt_status(MQTT_STATUS_DATA_SENT);
+      return msg_id;
+    }
+  }
+
+  // QoS 0 is fire-and-forget; don't hold on to it
+  if (qos == 0) {
+    return -1;
+  }
+
+  return net_mqtt_pending_push(topic, payload, qos);
+}
+
+void net_mqtt_send_power_stats(void)
+{
+  char *topic, *payload;
+  topic = malloc(128);
+  payload = malloc(768);
+
+  if (topic && payload) {
+    net_mqtt_topic_targeted(MQTT_TOPIC_TYPE_STATUS, "system/power_stats", topic, 128);
+
+    // time in each main state since boot and the current draw it implies
+    pm_ctl_json(payload, 768);
+
+    // QOS 0 - not very important.
+    if (net_mqtt_publish(topic, payload, 0) != -1) {
+      ESP_LOGD(TAG, "published power stats");
+    } else {
+      ESP_LOGE(TAG, "error publishing to topic '%s'", topic);
+    }
+  }
+
+  free(topic);
+  free(payload);
+}
+
+void net_mqtt_send_pending(void)
+{
+  if (s_pending_count) {
+    ESP_LOGI(TAG, "publishing %d messages queued while offline", s_pending_count);
+  }
+
+  while (s_pending_count && s_mqtt_connected) {
+    mqtt_pending_t *p = &s_pending[s_pending_head];
+
+    int msg_id = esp_mqtt_client_publish(s_mqtt_client, p->topic, p->payload, 0, p->qos, 0);
+    if (msg_id == -1) {
+      ESP_LOGE(TAG, "error publishing queued message to topic '%s'", p->topic);
+      break;
+    }
+    net_wifi_ps_mqtt_sent(msg_id);
+    display_mqtt_status(MQTT_STATUS_DATA_SENT);
+
+    free(p->topic);
+    free(p->payload);
+    s_pending_head = (s_pending_head + 1) % MQTT_PENDING_DEPTH;
+    s_pending_count--;
+    rtc_cache_event_sent();
+  }
+}
 
 int net_mqtt_topic_targeted(char *topic_type, char *subtopic, char *obuf, size_t obuf_len)
 {
@@ -109,8 +227,7 @@ void net_mqtt_send_wifi_strength(void)
       wifidata.rssi);
 
     // QOS 0 - not very important.
-    if (esp_mqtt_client_publish(s_mqtt_client, topic, payload, 0, 0, 0) != -1) {
-      display_mqtt_status(MQTT_STATUS_DATA_SENT);
+    if (net_mqtt_publish(topic, payload, 0) != -1) {
       ESP_LOGD(TAG, "published wifi status");
     } else {
       ESP_LOGE(TAG, "error publishing to topic '%s'", topic);
@@ -133,8 +250,7 @@ void net_mqtt_send_acl_updated(char* status)
   net_mqtt_topic_targeted(MQTT_TOPIC_TYPE_STATUS, "acl/update", topic, 128);
 
   snprintf(payload, 128, "{\"status\":\"%s\"}", status);
-  if (esp_mqtt_client_publish(s_mqtt_client, topic, payload, 0, 2, 0) != -1) {
-    display_mqtt_status(MQTT_STATUS_DATA_SENT);
+  if (net_mqtt_publish(topic, payload, 2) != -1) {
     ESP_LOGD(TAG, "published acl update status");
   } else {
     ESP_LOGE(TAG, "error publishing to topic '%s'", topic);
@@ -154,8 +270,7 @@ void net_mqtt_send_access(char *member, int allowed)
   net_mqtt_topic_targeted(MQTT_TOPIC_TYPE_STATUS, "personality/access", topic, 128);
 
   snprintf(payload, 128, "{\"member\": \"%s\", \"allowed\": %s}", member, allowed ? "true" : "false");
-  if (esp_mqtt_client_publish(s_mqtt_client, topic, payload, 0, 2, 0) != -1) {
-    display_mqtt_status(MQTT_STATUS_DATA_SENT);
+  if (net_mqtt_publish(topic, payload, 2) != -1) {
     ESP_LOGD(TAG, "published personality access");
   } else {
     ESP_LOGE(TAG, "error publishing to topic '%s'", topic);
@@ -175,8 +290,7 @@ void net_mqtt_send_access_error(char *err_text, char *err_ext)
 
   snprintf(payload, 512, "{\"error\": true, \"errorText\": \"%s\", \"errorExt\": \"%s\"}", err_text, err_ext);
 
-  if (esp_mqtt_client_publish(s_mqtt_client, topic, payload, 0, 2, 0) != -1) {
-    display_mqtt_status(MQTT_STATUS_DATA_SENT);
+  if (net_mqtt_publish(topic, payload, 2) != -1) {
     ESP_LOGD(TAG, "published personality access error");
   } else {
     ESP_LOGE(TAG, "error publishing to topic '%s'", topic);
@@ -186,13 +300,19 @@ void net_mqtt_send_access_error(char *err_text, char *err_ext)
   free(payload);
 }
 
+#define BOOT_STATUS_PAYLOAD_LEN 768
+
 void net_mqtt_send_boot_status(void)
 {
   char *topic, *payload;
   char reason[20];
   char fw_sha[65];
+  char boot_stages[256];
+  char ota_path[12];
+  uint32_t ota_bytes = 0;
+  uint32_t ev_pending, ev_lost;
   topic = malloc(128);
-  payload = malloc(256);
+  payload = malloc(BOOT_STATUS_PAYLOAD_LEN);
 
   net_mqtt_topic_targeted(MQTT_TOPIC_TYPE_STATUS, "system/boot", topic, 128);
 
@@ -241,11 +361,22 @@ void net_mqtt_send_boot_status(void)
     strcat(fw_sha, s);
   }
 
-  snprintf(payload, 512, "{\"reset_reason\": \"%s\", \"fw_name\": \"%s\", \"fw_version\": \"%s\", \"fw_date\": \"%s\", \"fw_time\": \"%s\", \"fw_sha256\": \"%s\", \"idf_ver\": \"%s\"}",
-           reason, desc->project_name, desc->version, desc->date, desc->time, fw_sha, desc->idf_ver);
+  // milliseconds since app start at which each boot stage completed
+  boot_stages_json(boot_stages, sizeof(boot_stages));
 
-  if (esp_mqtt_client_publish(s_mqtt_client, topic, payload, 0, 2, 0) != -1) {
-    display_mqtt_status(MQTT_STATUS_DATA_SENT);
+  // how the last OTA update delivered this image
+  if (net_ota_last_path(ota_path, sizeof(ota_path), &ota_bytes) != ESP_OK) {
+    strcpy(ota_path, "none");
+  }
+
+  // access events queued offline that a deep sleep or a full queue threw away
+  rtc_cache_get_events(&ev_pending, &ev_lost);
+
+  snprintf(payload, BOOT_STATUS_PAYLOAD_LEN, "{\"reset_reason\": \"%s\", \"fw_name\": \"%s\", \"fw_version\": \"%s\", \"fw_date\": \"%s\", \"fw_time\": \"%s\", \"fw_sha256\": \"%s\", \"idf_ver\": \"%s\", \"boot_ms\": %s, \"ota_path\": \"%s\", \"ota_bytes\": %u, \"events_lost\": %u}",
+           reason, desc->project_name, desc->version, desc->date, desc->time, fw_sha, desc->idf_ver, boot_stages,
+           ota_path, ota_bytes, ev_lost);
+
+  if (net_mqtt_publish(topic, payload, 2) != -1) {
     ESP_LOGD(TAG, "published system boot status");
   } else {
     ESP_LOGE(TAG, "error publishing to topic '%s'", topic);
@@ -285,8 +416,7 @@ void net_mqtt_send_power_status(power_status_t status)
       break;
   }
 
-  if (esp_mqtt_client_publish(s_mqtt_client, topic, payload, 0, 2, 0) != -1) {
-    display_mqtt_status(MQTT_STATUS_DATA_SENT);
+  if (net_mqtt_publish(topic, payload, 2) != -1) {
     ESP_LOGD(TAG, "published system power status");
   } else {
     ESP_LOGE(TAG, "error publishing to topic '%s'", topic);
@@ -312,8 +442,7 @@ void net_mqtt_send_door_state(bool door_open)
     snprintf(payload, 128, "{\"state\": \"closed\"}");
   }
 
-  if (esp_mqtt_client_publish(s_mqtt_client, topic, payload, 0, 2, 0) != -1) {
-    display_mqtt_status(MQTT_STATUS_DATA_SENT);
+  if (net_mqtt_publish(topic, payload, 2) != -1) {
     ESP_LOGD(TAG, "published personality door status");
   } else {
     ESP_LOGE(TAG, "error publishing to topic '%s'", topic);
@@ -354,8 +483,7 @@ void net_mqtt_send_ota_status(ota_status_t status, int progress)
 
   snprintf(payload, 128, "{\"status\": \"%s\", \"progress\": \"%d\"}", st, progress);
 
-  if (esp_mqtt_client_publish(s_mqtt_client, topic, payload, 0, 2, 0) != -1) {
-    display_mqtt_status(MQTT_STATUS_DATA_SENT);
+  if (net_mqtt_publish(topic, payload, 2) != -1) {
     ESP_LOGD(TAG, "published system ota status");
   } else {
     ESP_LOGE(TAG, "error publishing to topic '%s'", topic);
@@ -365,6 +493,106 @@ void net_mqtt_send_ota_status(ota_status_t status, int progress)
   free(payload);
 }
 
+#define MQTT_LOG_DUMP_CHUNK 1024
+
+typedef struct {
+  char *topic;
+  char *buf;
+  size_t len;
+  int chunks;
+} mqtt_log_dump_t;
+
+static void net_mqtt_log_dump_flush(mqtt_log_dump_t *d)
+{
+  if (d->len == 0) {
+    return;
+  }
+  if (net_mqtt_publish(d->topic, d->buf, 0) == -1) {
+    ESP_LOGE(TAG, "error publishing to topic '%s'", d->topic);
+  }
+  d->chunks++;
+  d->len = 0;
+  d->buf[0] = '\0';
+}
+
+static void net_mqtt_log_dump_sink(const char *line, void *ctx)
+{
+  mqtt_log_dump_t *d = (mqtt_log_dump_t *)ctx;
+  size_t n = strlen(line);
+
+  if (d->len + n >= MQTT_LOG_DUMP_CHUNK) {
+    net_mqtt_log_dump_flush(d);
+  }
+  if (n >= MQTT_LOG_DUMP_CHUNK) {
+    n = MQTT_LOG_DUMP_CHUNK - 1;
+  }
+  memcpy(d->buf + d->len, line, n);
+  d->len += n;
+  d->buf[d->len] = '\0';
+}
+
+// publish the binary log, formatted as text, in chunks of up to 1 KB
+void net_mqtt_send_log_dump(void)
+{
+  mqtt_log_dump_t d = { 0 };
+  d.topic = malloc(128);
+  d.buf = malloc(MQTT_LOG_DUMP_CHUNK);
+  if (!d.topic || !d.buf) {
+    ESP_LOGE(TAG, "can't malloc log dump buffers");
+    goto done;
+  }
+
+  net_mqtt_topic_targeted(MQTT_TOPIC_TYPE_STATUS, "system/log", d.topic, 128);
+
+  int n = blog_dump(net_mqtt_log_dump_sink, &d, 0);
+  net_mqtt_log_dump_flush(&d);
+  ESP_LOGI(TAG, "published %d log entries in %d chunks", n, d.chunks);
+
+done:
+  free(d.topic);
+  free(d.buf);
+}
+
+// payload is "key=value", e.g. "ntp_server=time.example.org"
+static void net_mqtt_handle_config_set(const char *data, int data_len)
+{
+  char *buf = strndup(data, data_len);
+  if (buf == NULL) {
+    return;
+  }
+
+  char *eq = strchr(buf, '=');
+  if (eq == NULL) {
+    ESP_LOGE(TAG, "malformed config/set payload, expected key=value");
+  } else {
+    *eq = '\0';
+    if (!config_is_remote_key(buf)) {
+      ESP_LOGE(TAG, "config/set '%s' refused, not settable over MQTT", buf);
+    } else if (net_cmd_queue_config_set(buf, eq + 1) != ESP_OK) {
+      ESP_LOGE(TAG, "config/set '%s' could not be queued", buf);
+    }
+  }
+  free(buf);
+}
+
+static void net_mqtt_config_changed(const config_t *cfg, const char *key)
+{
+  if (strcmp(key, "mqtt_broker") == 0) {
+    ESP_LOGI(TAG, "MQTT broker changed to %s, will be used on next reconnect", cfg->mqtt_broker);
+    esp_mqtt_client_set_uri(s_mqtt_client, cfg->mqtt_broker);
+  }
+}
+
+// full speed from connect attempt to the end of the TLS handshake
+static bool s_handshake_busy = false;
+
+static void net_mqtt_handshake_done(void)
+{
+  if (s_handshake_busy) {
+    s_handshake_busy = false;
+    pm_busy_end();
+  }
+}
 
 static esp_err_t net_mqtt_event_handler(esp_mqtt_event_handle_t event)
 {
@@ -372,15 +600,29 @@ static esp_err_t net_mqtt_event_handler(esp_mqtt_event_handle_t event)
     int msg_id;
     // your_context_t *context = event->context;
     switch (event->event_id) {
+        case MQTT_EVENT_BEFORE_CONNECT:
+            if (!s_handshake_busy) {
+              s_handshake_busy = true;
+              pm_busy_begin();
+            }
+            break;
         case MQTT_EVENT_CONNECTED:
+            net_mqtt_handshake_done();
             ESP_LOGI(TAG, "Connected to MQTT broker");
+            // node-targeted control topics; MAC is known by the time we connect
+            net_mqtt_topic_targeted(MQTT_TOPIC_TYPE_CONTROL, "config/set", s_config_set_topic, sizeof(s_config_set_topic));
+            net_mqtt_topic_targeted(MQTT_TOPIC_TYPE_CONTROL, "log/dump", s_log_dump_topic, sizeof(s_log_dump_topic));
             msg_id = esp_mqtt_client_subscribe(client, "ratt/control/broadcast/acl/update", 0);
             msg_id = esp_mqtt_client_subscribe(client, "ratt/control/broadcast/firmware/update", 0);
+            msg_id = esp_mqtt_client_subscribe(client, s_config_set_topic, 1);
+            msg_id = esp_mqtt_client_subscribe(client, s_log_dump_topic, 0);
             ESP_LOGD(TAG, "sent subscribe successful, msg_id=%d", msg_id);
             display_mqtt_status(MQTT_STATUS_CONNECTED);
             s_mqtt_connected = true;
+            net_cmd_queue(NET_CMD_SEND_PENDING);
             break;
         case MQTT_EVENT_DISCONNECTED:
+            net_mqtt_handshake_done();
             ESP_LOGI(TAG, "Disconnected from MQTT broker");
 
             display_mqtt_status(MQTT_STATUS_DISCONNECTED);
@@ -395,25 +637,29 @@ static esp_err_t net_mqtt_event_handler(esp_mqtt_event_handle_t event)
             ESP_LOGD(TAG, "MQTT_EVENT_UNSUBSCRIBED, msg_id=%d", event->msg_id);
             break;
         case MQTT_EVENT_PUBLISHED:
-            ESP_LOGD(TAG, "MQTT_EVENT_PUBLISHED, msg_id=%d", event->msg_id);
+            BLOG("mqtt: published msg_id=%d", event->msg_id);
+            net_wifi_ps_mqtt_acked(event->msg_id);
 
             display_mqtt_status(MQTT_STATUS_DATA_SENT);
             break;
         case MQTT_EVENT_DATA:
-            ESP_LOGD(TAG, "MQTT_EVENT_DATA");
-            ESP_LOGD(TAG, "TOPIC=%.*s\r\n", event->topic_len, event->topic);
-            ESP_LOGD(TAG, "DATA=%.*s\r\n", event->data_len, event->data);
+            BLOG("mqtt: data msg_id=%d topic_len=%d data_len=%d", event->msg_id, event->topic_len, event->data_len);
 
             // note using strncmp on non-null-terminated char arrays here...
             if (strncmp(event->topic, "ratt/control/broadcast/acl/update", event->topic_len) == 0) {
               net_cmd_queue(NET_CMD_DOWNLOAD_ACL);
             } else if (strncmp(event->topic, "ratt/control/broadcast/firmware/update", event->topic_len) == 0) {
               main_task_event(MAIN_EVT_OTA_UPDATE);
+            } else if (strncmp(event->topic, s_config_set_topic, event->topic_len) == 0) {
+              net_mqtt_handle_config_set(event->data, event->data_len);
+            } else if (strncmp(event->topic, s_log_dump_topic, event->topic_len) == 0) {
+              net_cmd_queue(NET_CMD_SEND_LOG_DUMP);
             }
 
             display_mqtt_status(MQTT_STATUS_DATA_RECEIVED);
             break;
         case MQTT_EVENT_ERROR:
+            net_mqtt_handshake_done();
             ESP_LOGE(TAG, "MQTT_EVENT_ERROR");
             display_mqtt_status(MQTT_STATUS_ERROR);
             break;
@@ -445,18 +691,18 @@ int net_mqtt_init(void)
       .skip_cert_common_name_check = true,
   };
 
-  char *conf_mqtt_broker;
-  config_get_string("mqtt_broker", &conf_mqtt_broker, "mqtts://my-mqtt-server.org:1883");
+  // the client copies the URI during init
+  const config_t *cfg = config_acquire();
+  mqtt_cfg.uri = cfg->mqtt_broker;
 
-  ESP_LOGI(TAG, "MQTT broker is %s", conf_mqtt_broker);
-
-  mqtt_cfg.uri = conf_mqtt_broker;
+  ESP_LOGI(TAG, "MQTT broker is %s", mqtt_cfg.uri);
 
   s_mqtt_client = esp_mqtt_client_init(&mqtt_cfg);
+  config_release(cfg);
 
-  esp_log_level_set(TAG, ESP_LOG_INFO);
+  config_register_listener(net_mqtt_config_changed);
 
-  free(conf_mqtt_broker);
+  esp_log_level_set(TAG, ESP_LOG_INFO);
 
   return 0;
 }
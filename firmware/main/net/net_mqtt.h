@@ -15,6 +15,9 @@ void net_mqtt_send_access_error(char *err_text, char *err_ext);
 void net_mqtt_send_power_status(power_status_t status);
 void net_mqtt_send_door_state(bool door_open);
 void net_mqtt_send_ota_status(ota_status_t status, int progress);
+void net_mqtt_send_pending(void);
+void net_mqtt_send_power_stats(void);
+void net_mqtt_send_log_dump(void);
 
 #define MQTT_BASE_TOPIC "ratt"
 #define MQTT_TOPIC_TYPE_STATUS "status"
@@ -1,3 +1,4 @@
+#include <stdlib.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_system.h"
@@ -7,21 +8,34 @@
 #include "esp_http_client.h"
 #include "esp_https_ota.h"
 #include "esp_task_wdt.h"
+#include "esp_timer.h"
 #include "string.h"
+#include "system.h"
 #include "net_ota.h"
+#include "net_ota_pipe.h"
 #include "net_certs.h"
 #include "net_mqtt.h"
 #include "esp_wifi.h"
 #include "config.h"
+#include "https.h"
+#include "assets.h"
 #include "main_task.h"
 #include "display_task.h"
+#include "perf.h"
+#include "nvs_flash.h"
+#include "pm_ctl.h"
+#include "net_wifi_ps.h"
 
 static const char *TAG = "ota";
 
 #define OTA_URL_SIZE 256
+#define OTA_NVS_NAMESPACE "ota"
+
+static perf_stat_t *s_kbps_stat = NULL;
 
 void net_ota_init(void)
 {
+    s_kbps_stat = perf_register("ota_kbps", "KB/s");
 }
 
 void net_ota_progress(size_t received, size_t total)
@@ -38,74 +52,304 @@ void net_ota_progress(size_t received, size_t total)
 }
 
 
-esp_err_t net_ota_http_event_handler(esp_http_client_event_t *evt)
+#ifdef CONFIG_RATT_ASSETS_PARTITION
+static esp_err_t net_ota_assets_write(void *ctx, const void *data, size_t len)
+{
+    return assets_write(data, len);
+}
+
+//
+// Bring the assets partition up to date before the app.  The server's
+// X-Hash-SHA224 is checked against the mapped blob first, so unchanged
+// assets cost one request; a 404 just means the server doesn't publish
+// them and the app OTA goes ahead.
+//
+static esp_err_t net_ota_fetch_assets(const char *url)
 {
-    static size_t content_length = 0;
-    static size_t received_length = 0;
+    char hash[ASSETS_HASH_LEN];
+    char resp_hash[ASSETS_HASH_LEN];
+    int64_t t0 = esp_timer_get_time();
+
+    assets_hash(hash);
+
+    esp_err_t r = assets_write_begin();
+    if (r != ESP_OK) {
+        return r;
+    }
 
-    esp_task_wdt_reset();
+    http_get_req_t req = {
+        .url = url,
+        .client_cert_pem = g_client_cert,
+        .client_key_pem = g_client_key,
+        .ca_cert_pem = g_ca_cert,
+        .ssl_insecure = true,
 
-    switch (evt->event_id) {
-    case HTTP_EVENT_ERROR:
-        ESP_LOGD(TAG, "HTTP_EVENT_ERROR");
-        break;
-    case HTTP_EVENT_ON_CONNECTED:
-        ESP_LOGD(TAG, "HTTP_EVENT_ON_CONNECTED");
-        content_length = 0;
-        received_length = 0;
-        break;
-    case HTTP_EVENT_HEADER_SENT:
-        ESP_LOGD(TAG, "HTTP_EVENT_HEADER_SENT");
-        break;
-    case HTTP_EVENT_ON_HEADER:
-        ESP_LOGD(TAG, "HTTP_EVENT_ON_HEADER, key=%s, value=%s", evt->header_key, evt->header_value);
-        if (strcmp(evt->header_key, "Content-Length")==0) {
-          content_length = atoi(evt->header_value);
+        .data_cb = net_ota_assets_write,
+        .resume_retries = HTTP_RESUME_RETRIES,
+
+        .hash_expected = hash,
+        .hash_expected_cancel = true,
+
+        .resp_hash_buf = resp_hash
+    };
+
+    ESP_LOGI(TAG, "Checking assets at %s", url);
+    r = http_get(&req);
+
+    if (r != ESP_OK || req.resp_data_err) {
+        ESP_LOGE(TAG, "assets download failed");
+        assets_write_abort();
+        return ESP_FAIL;
+    }
+
+    if (req.resp_status != 200 || req.resp_hash_expected_match) {
+        if (req.resp_hash_expected_match) {
+            ESP_LOGI(TAG, "assets unchanged (%s)", hash);
+        } else {
+            ESP_LOGW(TAG, "no assets on server (status %d), keeping current", req.resp_status);
         }
-        break;
-    case HTTP_EVENT_ON_DATA:
-        ESP_LOGD(TAG, "HTTP_EVENT_ON_DATA, len=%d", evt->data_len);
-        received_length += evt->data_len;
-        net_ota_progress(received_length, content_length);
-        break;
-    case HTTP_EVENT_ON_FINISH:
-        ESP_LOGD(TAG, "HTTP_EVENT_ON_FINISH");
-        break;
-    case HTTP_EVENT_DISCONNECTED:
-        ESP_LOGD(TAG, "HTTP_EVENT_DISCONNECTED");
-        break;
+        assets_write_abort();
+        return ESP_OK;
     }
-    return ESP_OK;
+
+    // the blob must be the one the server advertised, not just what arrived
+    r = assets_write_end(req.resp_hash_server);
+    ESP_LOGW(TAG, "assets download %u bytes in %lld ms", req.resp_content_length,
+             (esp_timer_get_time() - t0) / 1000);
+    return r;
+}
+
+static esp_err_t net_ota_update_assets(void)
+{
+    // pinned so a config change during the download can't free the URL
+    const config_t *cfg = config_acquire();
+    esp_err_t r = net_ota_fetch_assets(cfg->assets_url);
+    config_release(cfg);
+    return r;
 }
+#endif
 
+//
+// The download runs in its own low priority task on the network core so
+// net_task stays free for MQTT and ACL work and the main task keeps
+// granting access while the image streams to flash.  Reads are paced to
+// OTA_THROTTLE_KBPS so the download doesn't starve the rest of the
+// network traffic; main_task reboots into the new image once it's idle.
+//
+static TaskHandle_t s_ota_task = NULL;
 
-void net_ota_update(void)
+typedef struct {
+    char *url;
+    bool bench;
+} net_ota_job_t;
+
+static inline uint32_t net_ota_kbps(uint32_t bytes, uint32_t ms)
+{
+    return ms ? bytes / ms * 1000 / 1024 : 0;
+}
+
+//
+// Remember how the new image arrived so the boot status after the reboot
+// can report it.  The image hash is kept alongside so a later serial
+// flash doesn't inherit the record.
+//
+static void net_ota_save_path(const char *path, uint32_t bytes)
+{
+    uint8_t sha[32];
+    nvs_handle_t hdl;
+
+    if (esp_partition_get_sha256(esp_ota_get_boot_partition(), sha) != ESP_OK ||
+        nvs_open(OTA_NVS_NAMESPACE, NVS_READWRITE, &hdl) != ESP_OK) {
+        return;
+    }
+
+    nvs_set_str(hdl, "path", path);
+    nvs_set_u32(hdl, "bytes", bytes);
+    nvs_set_blob(hdl, "sha", sha, sizeof(sha));
+    nvs_commit(hdl);
+    nvs_close(hdl);
+}
+
+esp_err_t net_ota_last_path(char *path, size_t len, uint32_t *bytes)
+{
+    uint8_t sha[32], running_sha[32];
+    size_t sha_len = sizeof(sha);
+    nvs_handle_t hdl;
+    esp_err_t r;
+
+    r = nvs_open(OTA_NVS_NAMESPACE, NVS_READONLY, &hdl);
+    if (r != ESP_OK) {
+        return r;
+    }
+
+    r = nvs_get_blob(hdl, "sha", sha, &sha_len);
+    if (r == ESP_OK) {
+        r = nvs_get_str(hdl, "path", path, &len);
+    }
+    if (r == ESP_OK) {
+        r = nvs_get_u32(hdl, "bytes", bytes);
+    }
+    nvs_close(hdl);
+
+    if (r == ESP_OK &&
+        (esp_partition_get_sha256(esp_ota_get_running_partition(), running_sha) != ESP_OK ||
+         memcmp(sha, running_sha, sizeof(sha)) != 0)) {
+        r = ESP_ERR_NOT_FOUND;
+    }
+    return r;
+}
+
+//
+// esp_https_ota path: each read is followed by its flash write (and any
+// erase that write needs) before the socket is read again.  Without commit
+// the image is dropped once it has been received, for benchmarking.
+//
+static esp_err_t net_ota_download_https(const char *url, int throttle_kbps, bool commit)
 {
     esp_http_client_config_t config = {
+        .url = url,
         .cert_pem = g_ca_cert,
         .skip_cert_common_name_check = true,
         .keep_alive_enable = true,
-        .event_handler = net_ota_http_event_handler,
     };
+    esp_https_ota_config_t ota_config = {
+        .http_config = &config,
+    };
+    esp_https_ota_handle_t handle = NULL;
+    int64_t t0 = esp_timer_get_time();
+
+    esp_err_t ret = esp_https_ota_begin(&ota_config, &handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "OTA begin failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
 
-    char *conf_ota_url;
-    config_get_string("ota_url", &conf_ota_url, "https://my-server.org/ota.bin");
-    config.url = conf_ota_url;
+    int total = esp_https_ota_get_image_size(handle);
 
-    ESP_LOGI(TAG, "Starting OTA update from %s", conf_ota_url);
+    while ((ret = esp_https_ota_perform(handle)) == ESP_ERR_HTTPS_OTA_IN_PROGRESS) {
+        int received = esp_https_ota_get_image_len_read(handle);
+
+        if (total > 0 && commit) {
+            net_ota_progress(received, total);
+        }
+
+        if (throttle_kbps == 0) {
+            continue;
+        }
+
+        // sleep off whatever is ahead of the bandwidth budget
+        int64_t budget_ms = (int64_t) received * 1000 / (throttle_kbps * 1024);
+        int64_t elapsed_ms = (esp_timer_get_time() - t0) / 1000;
+        if (budget_ms > elapsed_ms) {
+            vTaskDelay((budget_ms - elapsed_ms) / portTICK_PERIOD_MS + 1);
+        }
+    }
 
+    if (ret == ESP_OK && esp_https_ota_is_complete_data_received(handle)) {
+        ret = commit ? esp_https_ota_finish(handle) : esp_https_ota_abort(handle);
+    } else {
+        ESP_LOGE(TAG, "OTA download incomplete: %s", esp_err_to_name(ret));
+        esp_https_ota_abort(handle);
+        ret = ESP_FAIL;
+    }
+
+    uint32_t ms = (esp_timer_get_time() - t0) / 1000;
+    ESP_LOGW(TAG, "https_ota: %d bytes in %u ms (%u KB/s)", total, ms, net_ota_kbps(total, ms));
+    perf_record(s_kbps_stat, net_ota_kbps(total, ms));
+    if (throttle_kbps == 0) {
+        net_wifi_ps_record_kbps(net_ota_kbps(total, ms));
+    }
+
+    if (ret == ESP_OK && commit) {
+        net_ota_save_path(ota_delta_kind_name(OTA_DELTA_PLAIN), total);
+    }
+    return ret;
+}
+
+static esp_err_t net_ota_download_pipe(const char *url, int throttle_kbps, bool commit)
+{
+    net_ota_pipe_req_t req = {
+        .url = url,
+        .commit = commit,
+        .throttle_kbps = throttle_kbps,
+        .progress_cb = commit ? net_ota_progress : NULL,
+        .max_resumes = HTTP_RESUME_RETRIES,
+    };
+    net_ota_pipe_stats_t st;
+
+    esp_err_t ret = net_ota_pipe_download(&req, &st);
+
+    ESP_LOGW(TAG, "pipeline: %s, %u bytes for a %u byte image in %u ms (%u KB/s), "
+             "flash erase+write %u ms, rx blocked %u ms, writer idle %u ms, ring peak %u, "
+             "%u resumes",
+             ota_delta_kind_name(st.kind), st.bytes, st.image_bytes, st.total_ms,
+             net_ota_kbps(st.bytes, st.total_ms), st.write_ms,
+             st.rx_blocked_ms, st.wr_idle_ms, st.ring_peak, st.resumes);
+    perf_record(s_kbps_stat, net_ota_kbps(st.bytes, st.total_ms));
+    if (throttle_kbps == 0) {
+        net_wifi_ps_record_kbps(net_ota_kbps(st.bytes, st.total_ms));
+    }
+
+    if (ret == ESP_OK && commit) {
+        net_ota_save_path(ota_delta_kind_name(st.kind), st.bytes);
+    }
+    return ret;
+}
+
+static esp_err_t net_ota_download(const char *url)
+{
+#ifdef OTA_PIPELINE
+    return net_ota_download_pipe(url, OTA_THROTTLE_KBPS, true);
+#else
+    return net_ota_download_https(url, OTA_THROTTLE_KBPS, true);
+#endif
+}
+
+//
+// Unthrottled dry run of both download paths against the configured OTA
+// URL (point it at tools/ota_server.py for repeatable numbers).  Neither
+// image is made bootable.
+//
+static void net_ota_bench_run(const char *url)
+{
+    esp_err_t r1 = net_ota_download_https(url, 0, false);
+    esp_err_t r2 = net_ota_download_pipe(url, 0, false);
+
+    ESP_LOGW(TAG, "bench done: https_ota %s, pipeline %s", esp_err_to_name(r1), esp_err_to_name(r2));
+}
+
+static void net_ota_task(void *pvParameters)
+{
+    net_ota_job_t *job = pvParameters;
+    char *conf_ota_url = job->url;
+    esp_err_t ret = ESP_OK;
+
+    // TLS, hashing and inflating the image are all CPU bound
+    pm_busy_begin();
+    net_wifi_ps_transfer(true);
+
+    if (job->bench) {
+        ESP_LOGW(TAG, "Benchmarking OTA download from %s", conf_ota_url);
+        net_ota_bench_run(conf_ota_url);
+        goto done;
+    }
+
+    ESP_LOGI(TAG, "Starting OTA update from %s", conf_ota_url);
 
     display_ota_status(OTA_STATUS_DOWNLOADING, 0);
     net_mqtt_send_ota_status(OTA_STATUS_DOWNLOADING, 0);
 
-    esp_err_t ret = esp_https_ota(&config);
+#ifdef CONFIG_RATT_ASSETS_PARTITION
+    ret = net_ota_update_assets();
+#endif
 
-    free(conf_ota_url);
+    if (ret == ESP_OK) {
+        ret = net_ota_download(conf_ota_url);
+    }
 
     if (ret == ESP_OK) {
         ESP_LOGW(TAG, "OTA firmware download success");
         net_mqtt_send_ota_status(OTA_STATUS_APPLYING, 100);
-        vTaskDelay(500/portTICK_PERIOD_MS);
         main_task_event(MAIN_EVT_OTA_UPDATE_SUCCESS);
     } else {
         ESP_LOGE(TAG, "OTA firmware upgrade failed ret=%d", ret);
@@ -113,4 +357,52 @@ void net_ota_update(void)
         display_ota_status(OTA_STATUS_ERROR, 100);
         main_task_event(MAIN_EVT_OTA_UPDATE_FAILED);
     }
+
+done:
+    net_wifi_ps_transfer(false);
+    pm_busy_end();
+    free(conf_ota_url);
+    free(job);
+    s_ota_task = NULL;
+    vTaskDelete(NULL);
+}
+
+static void net_ota_start(bool bench)
+{
+    if (s_ota_task != NULL) {
+        ESP_LOGW(TAG, "OTA update already in progress");
+        return;
+    }
+
+    // private copy; the download outlives the config snapshot
+    net_ota_job_t *job = calloc(1, sizeof(net_ota_job_t));
+    const config_t *cfg = config_acquire();
+    char *conf_ota_url = strdup(cfg->ota_url);
+    config_release(cfg);
+    if (job == NULL || conf_ota_url == NULL) {
+        ESP_LOGE(TAG, "can't malloc OTA URL");
+        free(job);
+        free(conf_ota_url);
+        return;
+    }
+    job->url = conf_ota_url;
+    job->bench = bench;
+
+    if (xTaskCreatePinnedToCore(&net_ota_task, "ota_task", 8192, job, TASK_PRIO_OTA,
+                                &s_ota_task, TASK_CORE(CORE_NET)) != pdPASS) {
+        ESP_LOGE(TAG, "can't start OTA task");
+        free(conf_ota_url);
+        free(job);
+        s_ota_task = NULL;
+    }
+}
+
+void net_ota_update(void)
+{
+    net_ota_start(false);
+}
+
+void net_ota_bench(void)
+{
+    net_ota_start(true);
 }
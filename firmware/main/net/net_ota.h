@@ -1,7 +1,15 @@
 #ifndef NET_OTA_H
 #define NET_OTA_H
 
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
 void net_ota_init(void);
 void net_ota_update(void);
+void net_ota_bench(void);
+// how the running image was installed ("full", "full_z", "delta", "delta_z")
+// and how many bytes were downloaded for it; ESP_ERR_NOT_FOUND if unknown
+esp_err_t net_ota_last_path(char *path, size_t len, uint32_t *bytes);
 
 #endif
@@ -0,0 +1,352 @@
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#include "esp32/rom/miniz.h"
+#include "mbedtls/md.h"
+#include "net_ota_delta.h"
+
+static const char *TAG = "ota_delta";
+
+#define OP_DIFF          0x01
+#define OP_ADD           0x02
+#define OP_HDR_MAX       9
+#define DICT_SIZE        (1 << OTA_DELTA_WINDOW_BITS)
+#define SRC_CHUNK        256
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t flags;
+  uint32_t target_size;
+  uint32_t source_size;
+  uint8_t target_sha[32];
+  uint8_t source_sha[32];
+} __attribute__((packed)) ota_delta_hdr_t;
+
+_Static_assert(sizeof(ota_delta_hdr_t) == OTA_DELTA_HDR_SIZE, "RATD header size");
+
+struct ota_delta {
+  ota_delta_out_t out;
+  void *ctx;
+  ota_delta_kind_t kind;
+
+  uint8_t hdr_buf[OTA_DELTA_HDR_SIZE];
+  size_t hdr_fill;
+  ota_delta_hdr_t hdr;
+
+  // inflate: output wraps around a window sized dictionary
+  tinfl_decompressor *inflator;
+  uint8_t *dict;
+  size_t dict_ofs;
+  bool inflate_done;
+
+  // delta ops, parsed across chunk boundaries
+  const esp_partition_t *src;
+  uint8_t op_buf[OP_HDR_MAX];
+  size_t op_fill;
+  size_t op_need;
+  uint32_t op_left;
+  uint32_t src_ofs;
+  uint8_t src_buf[SRC_CHUNK];
+
+  mbedtls_md_context_t md;
+  bool md_ok;
+  uint32_t out_bytes;
+};
+
+const char *ota_delta_kind_name(ota_delta_kind_t kind)
+{
+  switch (kind) {
+    case OTA_DELTA_PLAIN:   return "full";
+    case OTA_DELTA_FULL_Z:  return "full_z";
+    case OTA_DELTA_PATCH:   return "delta";
+    case OTA_DELTA_PATCH_Z: return "delta_z";
+    default:                return "unknown";
+  }
+}
+
+ota_delta_t *ota_delta_new(ota_delta_out_t out, void *ctx)
+{
+  ota_delta_t *d = calloc(1, sizeof(ota_delta_t));
+  if (d == NULL) {
+    return NULL;
+  }
+
+  d->out = out;
+  d->ctx = ctx;
+  mbedtls_md_init(&d->md);
+  return d;
+}
+
+void ota_delta_free(ota_delta_t *d)
+{
+  if (d == NULL) {
+    return;
+  }
+
+  mbedtls_md_free(&d->md);
+  free(d->inflator);
+  free(d->dict);
+  free(d);
+}
+
+ota_delta_kind_t ota_delta_kind(const ota_delta_t *d)
+{
+  return d->kind;
+}
+
+size_t ota_delta_target_size(const ota_delta_t *d)
+{
+  return d->kind == OTA_DELTA_PLAIN ? 0 : d->hdr.target_size;
+}
+
+static esp_err_t delta_emit(ota_delta_t *d, const uint8_t *data, size_t len)
+{
+  if (d->out_bytes + len > d->hdr.target_size) {
+    ESP_LOGE(TAG, "image runs past %u bytes", d->hdr.target_size);
+    return ESP_ERR_INVALID_SIZE;
+  }
+
+  mbedtls_md_update(&d->md, data, len);
+  d->out_bytes += len;
+  return d->out(d->ctx, data, len);
+}
+
+static esp_err_t delta_start_op(ota_delta_t *d)
+{
+  uint32_t len, ofs = 0;
+
+  if (d->op_buf[0] == OP_DIFF) {
+    memcpy(&ofs, d->op_buf + 1, 4);
+    memcpy(&len, d->op_buf + 5, 4);
+    if (ofs + len > d->hdr.source_size || ofs + len < ofs) {
+      ESP_LOGE(TAG, "copy of %u bytes at %u is outside the source", len, ofs);
+      return ESP_ERR_INVALID_ARG;
+    }
+  } else {
+    memcpy(&len, d->op_buf + 1, 4);
+  }
+
+  d->op_left = len;
+  d->src_ofs = ofs;
+  d->op_fill = 0;
+  return ESP_OK;
+}
+
+static esp_err_t delta_body(ota_delta_t *d, const uint8_t *data, size_t len)
+{
+  esp_err_t r = ESP_OK;
+
+  if (!(d->hdr.flags & OTA_DELTA_F_DELTA)) {
+    return delta_emit(d, data, len);
+  }
+
+  while (len && r == ESP_OK) {
+    if (d->op_left == 0) {
+      if (d->op_fill == 0) {
+        d->op_need = data[0] == OP_DIFF ? 9 : data[0] == OP_ADD ? 5 : 0;
+        if (d->op_need == 0) {
+          ESP_LOGE(TAG, "bad op 0x%02x after %u bytes", data[0], d->out_bytes);
+          return ESP_ERR_INVALID_ARG;
+        }
+      }
+
+      size_t n = d->op_need - d->op_fill;
+      n = n < len ? n : len;
+      memcpy(d->op_buf + d->op_fill, data, n);
+      d->op_fill += n;
+      data += n;
+      len -= n;
+
+      if (d->op_fill == d->op_need) {
+        r = delta_start_op(d);
+      }
+      continue;
+    }
+
+    size_t n = d->op_left < len ? d->op_left : len;
+
+    if (d->op_buf[0] == OP_DIFF) {
+      n = n < SRC_CHUNK ? n : SRC_CHUNK;
+      r = esp_partition_read(d->src, d->src_ofs, d->src_buf, n);
+      if (r != ESP_OK) {
+        return r;
+      }
+      for (size_t i = 0; i < n; i++) {
+        d->src_buf[i] += data[i];
+      }
+      r = delta_emit(d, d->src_buf, n);
+      d->src_ofs += n;
+    } else {
+      r = delta_emit(d, data, n);
+    }
+
+    d->op_left -= n;
+    data += n;
+    len -= n;
+  }
+
+  return r;
+}
+
+static esp_err_t delta_inflate(ota_delta_t *d, const uint8_t *data, size_t len)
+{
+  const mz_uint32 flags = TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT;
+  esp_err_t r = ESP_OK;
+
+  while (r == ESP_OK && !d->inflate_done) {
+    size_t in_size = len;
+    size_t out_size = DICT_SIZE - d->dict_ofs;
+    tinfl_status status = tinfl_decompress(d->inflator, data, &in_size, d->dict,
+                                           d->dict + d->dict_ofs, &out_size, flags);
+    data += in_size;
+    len -= in_size;
+
+    if (out_size) {
+      r = delta_body(d, d->dict + d->dict_ofs, out_size);
+      d->dict_ofs = (d->dict_ofs + out_size) & (DICT_SIZE - 1);
+    }
+
+    if (status == TINFL_STATUS_DONE) {
+      d->inflate_done = true;
+    } else if (status < 0) {
+      ESP_LOGE(TAG, "inflate failed (%d) after %u bytes", status, d->out_bytes);
+      return ESP_FAIL;
+    } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT && len == 0) {
+      break;
+    }
+  }
+
+  if (r == ESP_OK && d->inflate_done && len) {
+    ESP_LOGW(TAG, "%u bytes after the end of the compressed stream", len);
+  }
+  return r;
+}
+
+static esp_err_t delta_parse_header(ota_delta_t *d)
+{
+  ota_delta_hdr_t *h = &d->hdr;
+
+  memcpy(h, d->hdr_buf, sizeof(*h));
+  if (h->version != OTA_DELTA_VERSION) {
+    ESP_LOGE(TAG, "unsupported version %u", h->version);
+    return ESP_ERR_NOT_SUPPORTED;
+  }
+
+  if (h->flags & OTA_DELTA_F_DELTA) {
+    uint8_t running_sha[32];
+    d->src = esp_ota_get_running_partition();
+
+    if (esp_partition_get_sha256(d->src, running_sha) != ESP_OK ||
+        memcmp(running_sha, h->source_sha, sizeof(running_sha)) != 0 ||
+        h->source_size > d->src->size) {
+      ESP_LOGE(TAG, "patch is not for the running image");
+      return ESP_ERR_INVALID_VERSION;
+    }
+  }
+
+  if (h->flags & OTA_DELTA_F_ZLIB) {
+    d->inflator = malloc(sizeof(tinfl_decompressor));
+    d->dict = malloc(DICT_SIZE);
+    if (d->inflator == NULL || d->dict == NULL) {
+      return ESP_ERR_NO_MEM;
+    }
+    tinfl_init(d->inflator);
+  }
+
+  if (mbedtls_md_setup(&d->md, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), 0) != 0 ||
+      mbedtls_md_starts(&d->md) != 0) {
+    return ESP_ERR_NO_MEM;
+  }
+  d->md_ok = true;
+
+  if (h->flags & OTA_DELTA_F_DELTA) {
+    d->kind = (h->flags & OTA_DELTA_F_ZLIB) ? OTA_DELTA_PATCH_Z : OTA_DELTA_PATCH;
+  } else {
+    d->kind = (h->flags & OTA_DELTA_F_ZLIB) ? OTA_DELTA_FULL_Z : OTA_DELTA_PLAIN;
+  }
+
+  ESP_LOGI(TAG, "%s image, %u bytes", ota_delta_kind_name(d->kind), h->target_size);
+  return ESP_OK;
+}
+
+esp_err_t ota_delta_feed(ota_delta_t *d, const uint8_t *data, size_t len)
+{
+  esp_err_t r;
+
+  if (d->kind == OTA_DELTA_UNKNOWN) {
+    size_t n = OTA_DELTA_HDR_SIZE - d->hdr_fill;
+    n = n < len ? n : len;
+    memcpy(d->hdr_buf + d->hdr_fill, data, n);
+    d->hdr_fill += n;
+    data += n;
+    len -= n;
+
+    uint32_t magic = 0;
+    memcpy(&magic, d->hdr_buf, d->hdr_fill < 4 ? d->hdr_fill : 4);
+
+    if (d->hdr_fill >= 4 && magic != OTA_DELTA_MAGIC) {
+      // a plain app image; pass it and the bytes held back through as-is
+      d->kind = OTA_DELTA_PLAIN;
+      r = d->out(d->ctx, d->hdr_buf, d->hdr_fill);
+      if (r != ESP_OK) {
+        return r;
+      }
+    } else if (d->hdr_fill < OTA_DELTA_HDR_SIZE) {
+      return ESP_OK;
+    } else {
+      r = delta_parse_header(d);
+      if (r != ESP_OK) {
+        return r;
+      }
+    }
+  }
+
+  if (len == 0) {
+    return ESP_OK;
+  }
+
+  if (d->kind == OTA_DELTA_PLAIN && !d->md_ok) {
+    return d->out(d->ctx, data, len);
+  }
+
+  if (d->hdr.flags & OTA_DELTA_F_ZLIB) {
+    return delta_inflate(d, data, len);
+  }
+  return delta_body(d, data, len);
+}
+
+esp_err_t ota_delta_finish(ota_delta_t *d)
+{
+  uint8_t sha[32];
+
+  if (d->kind == OTA_DELTA_UNKNOWN) {
+    // shorter than a header; only a plain (and surely invalid) image
+    d->kind = OTA_DELTA_PLAIN;
+    return d->hdr_fill ? d->out(d->ctx, d->hdr_buf, d->hdr_fill) : ESP_OK;
+  }
+
+  if (!d->md_ok) {
+    return ESP_OK;    // plain image, esp_ota_end() verifies it
+  }
+
+  if (((d->hdr.flags & OTA_DELTA_F_ZLIB) && !d->inflate_done) || d->op_left || d->op_fill) {
+    ESP_LOGE(TAG, "stream ends early");
+    return ESP_ERR_INVALID_SIZE;
+  }
+
+  if (d->out_bytes != d->hdr.target_size) {
+    ESP_LOGE(TAG, "got %u of %u image bytes", d->out_bytes, d->hdr.target_size);
+    return ESP_ERR_INVALID_SIZE;
+  }
+
+  mbedtls_md_finish(&d->md, sha);
+  if (memcmp(sha, d->hdr.target_sha, sizeof(sha)) != 0) {
+    ESP_LOGE(TAG, "reconstructed image SHA-256 mismatch");
+    return ESP_ERR_INVALID_CRC;
+  }
+
+  return ESP_OK;
+}
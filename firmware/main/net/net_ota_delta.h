@@ -0,0 +1,57 @@
+#ifndef NET_OTA_DELTA_H
+#define NET_OTA_DELTA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+//
+// Streaming decoder for compressed and delta OTA images made by
+// tools/mkpatch.py.  Anything that doesn't start with the RATD header is
+// passed through unchanged as a plain app image.  Layout, little endian:
+//
+//   header    u32 magic 'RATD', u16 version, u16 flags,
+//             u32 target size, u32 source size,
+//             u8 target sha256[32], u8 source sha256[32]
+//   body      zlib stream (8K window) if OTA_DELTA_F_ZLIB, else raw
+//
+// A full image body is the image itself.  A delta body is a sequence of
+//
+//   0x01 u32 src_offset u32 len  u8 diff[len]   target = source + diff
+//   0x02 u32 len                 u8 data[len]   target = data
+//
+// where source is the running app partition, whose image hash must match
+// the header's.  The reconstructed image's SHA-256 is checked at the end.
+//
+
+#define OTA_DELTA_MAGIC        0x44544152   // "RATD"
+#define OTA_DELTA_VERSION      1
+#define OTA_DELTA_HDR_SIZE     80
+#define OTA_DELTA_F_DELTA      0x0001
+#define OTA_DELTA_F_ZLIB       0x0002
+#define OTA_DELTA_WINDOW_BITS  13
+
+typedef enum {
+  OTA_DELTA_UNKNOWN = 0,      // header not seen yet
+  OTA_DELTA_PLAIN,
+  OTA_DELTA_FULL_Z,
+  OTA_DELTA_PATCH,
+  OTA_DELTA_PATCH_Z,
+} ota_delta_kind_t;
+
+typedef esp_err_t (*ota_delta_out_t)(void *ctx, const uint8_t *data, size_t len);
+
+typedef struct ota_delta ota_delta_t;
+
+ota_delta_t *ota_delta_new(ota_delta_out_t out, void *ctx);
+void ota_delta_free(ota_delta_t *d);
+esp_err_t ota_delta_feed(ota_delta_t *d, const uint8_t *data, size_t len);
+esp_err_t ota_delta_finish(ota_delta_t *d);
+
+ota_delta_kind_t ota_delta_kind(const ota_delta_t *d);
+// image size from the header, 0 for plain images
+size_t ota_delta_target_size(const ota_delta_t *d);
+const char *ota_delta_kind_name(ota_delta_kind_t kind);
+
+#endif
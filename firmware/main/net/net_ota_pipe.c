@@ -0,0 +1,378 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/ringbuf.h"
+#include "esp_system.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#include "esp_http_client.h"
+#include "esp_spi_flash.h"
+#include "system.h"
+#include "net_certs.h"
+#include "net_ota_pipe.h"
+
+static const char *TAG = "net_ota_pipe";
+
+#define OTA_PIPE_SECTOR      SPI_FLASH_SEC_SIZE
+#define OTA_PIPE_SEND_MS     10000
+#define OTA_PIPE_RESUME_MS   2000     // backoff before resume n is n times this
+
+typedef struct {
+  const esp_partition_t *part;
+  esp_ota_handle_t ota;
+  RingbufHandle_t ring;
+  size_t content_length;      // whole body, 0 if not sent
+  char etag[64];              // from the first response, validates resumes
+  long range_start;           // from Content-Range, -1 if none
+  size_t image_size;          // what will be written, 0 until known
+  volatile bool rx_done;
+  volatile esp_err_t err;
+  size_t written;
+  ota_delta_t *delta;
+  uint8_t *sector;
+  size_t fill;
+  TaskHandle_t receiver;
+  net_ota_pipe_stats_t *stats;
+} ota_pipe_t;
+
+static inline uint32_t pipe_ms_since(int64_t t0)
+{
+  return (esp_timer_get_time() - t0) / 1000;
+}
+
+// the OTA handle was opened for sequential writes, so esp_ota_write()
+// erases each sector as the image reaches it
+static esp_err_t pipe_write(ota_pipe_t *p, const uint8_t *buf, size_t len)
+{
+  if (p->written + len > p->part->size) {
+    return ESP_ERR_INVALID_SIZE;
+  }
+
+  int64_t t0 = esp_timer_get_time();
+  esp_err_t r = esp_ota_write(p->ota, buf, len);
+  p->stats->write_ms += pipe_ms_since(t0);
+  p->written += len;
+  return r;
+}
+
+// decoded image bytes from the delta decoder, gathered into whole sectors
+static esp_err_t pipe_image_out(void *ctx, const uint8_t *data, size_t len)
+{
+  ota_pipe_t *p = ctx;
+  esp_err_t r = ESP_OK;
+
+  while (len && r == ESP_OK) {
+    size_t n = OTA_PIPE_SECTOR - p->fill;
+    n = n < len ? n : len;
+    memcpy(p->sector + p->fill, data, n);
+    p->fill += n;
+    data += n;
+    len -= n;
+
+    if (p->fill == OTA_PIPE_SECTOR) {
+      r = pipe_write(p, p->sector, p->fill);
+      p->fill = 0;
+    }
+  }
+
+  return r;
+}
+
+//
+// Writer: runs ring data through the delta decoder (a pass-through for
+// plain images) and writes the image in order, a whole sector at a time,
+// while the receiver keeps filling the ring.
+//
+static void pipe_writer_task(void *pvParameters)
+{
+  ota_pipe_t *p = pvParameters;
+  esp_err_t err = ESP_OK;
+
+  while (err == ESP_OK && p->err == ESP_OK) {
+    bool done = p->rx_done;
+    size_t len = 0;
+    uint8_t *data = xRingbufferReceiveUpTo(p->ring, &len, 0, OTA_PIPE_SECTOR);
+
+    if (data == NULL) {
+      if (done) {
+        break;
+      }
+
+      int64_t t0 = esp_timer_get_time();
+      data = xRingbufferReceiveUpTo(p->ring, &len, 50 / portTICK_PERIOD_MS, OTA_PIPE_SECTOR);
+      p->stats->wr_idle_ms += pipe_ms_since(t0);
+      if (data == NULL) {
+        continue;
+      }
+    }
+
+    err = ota_delta_feed(p->delta, data, len);
+    vRingbufferReturnItem(p->ring, data);
+
+    if (p->image_size == 0 && ota_delta_kind(p->delta) != OTA_DELTA_UNKNOWN) {
+      size_t size = ota_delta_target_size(p->delta);
+      p->image_size = size ? size : p->content_length;
+      if (p->image_size > p->part->size) {
+        err = ESP_ERR_INVALID_SIZE;
+      }
+    }
+  }
+
+  if (err == ESP_OK && p->err == ESP_OK) {
+    err = ota_delta_finish(p->delta);
+  }
+  if (err == ESP_OK && p->fill) {
+    err = pipe_write(p, p->sector, p->fill);
+  }
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "image write failed at %u: %s", p->written, esp_err_to_name(err));
+    p->err = err;
+  }
+
+  xTaskNotifyGive(p->receiver);
+  vTaskDelete(NULL);
+}
+
+static esp_err_t pipe_http_event(esp_http_client_event_t *evt)
+{
+  ota_pipe_t *p = evt->user_data;
+
+  if (evt->event_id != HTTP_EVENT_ON_HEADER) {
+    return ESP_OK;
+  }
+
+  if (strcasecmp(evt->header_key, "ETag") == 0 && p->stats->bytes == 0) {
+    strlcpy(p->etag, evt->header_value, sizeof(p->etag));
+  } else if (strcasecmp(evt->header_key, "Content-Range") == 0) {
+    sscanf(evt->header_value, "bytes %ld-", &p->range_start);
+  }
+  return ESP_OK;
+}
+
+//
+// Reconnect after a dropped connection and ask for the rest of the body.
+// Everything received so far is already in the ring or past the decoder,
+// so the download carries on from the checkpoint as if nothing happened.
+// If-Range makes the server send the whole body instead of a 206 if the
+// image has changed since, which is treated as a failure.
+//
+static esp_err_t pipe_resume(ota_pipe_t *p, esp_http_client_handle_t client, int attempt)
+{
+  char range[32];
+
+  esp_http_client_close(client);
+  vTaskDelay(OTA_PIPE_RESUME_MS * attempt / portTICK_PERIOD_MS);
+
+  snprintf(range, sizeof(range), "bytes=%u-", p->stats->bytes);
+  esp_http_client_set_header(client, "Range", range);
+  esp_http_client_set_header(client, "If-Range", p->etag);
+  p->range_start = -1;
+
+  esp_err_t err = esp_http_client_open(client, 0);
+  if (err != ESP_OK) {
+    return err;
+  }
+
+  int length = esp_http_client_fetch_headers(client);
+  int status = esp_http_client_get_status_code(client);
+  if (status != 206 || p->range_start != (long) p->stats->bytes ||
+      length != (int) (p->content_length - p->stats->bytes)) {
+    ESP_LOGE(TAG, "can't resume at %u: status %d, range from %ld", p->stats->bytes, status, p->range_start);
+    return ESP_ERR_INVALID_RESPONSE;
+  }
+
+  ESP_LOGW(TAG, "resumed at %u of %u bytes", p->stats->bytes, p->content_length);
+  return ESP_OK;
+}
+
+static esp_err_t pipe_receive(ota_pipe_t *p, esp_http_client_handle_t client, const net_ota_pipe_req_t *req)
+{
+  net_ota_pipe_stats_t *stats = p->stats;
+  uint8_t *buf = malloc(OTA_PIPE_READ_SIZE);
+  int64_t t_start = esp_timer_get_time();
+  esp_err_t err = ESP_OK;
+
+  if (buf == NULL) {
+    return ESP_ERR_NO_MEM;
+  }
+
+  while (p->err == ESP_OK) {
+    int n = esp_http_client_read(client, (char *) buf, OTA_PIPE_READ_SIZE);
+    if (n <= 0 && p->content_length && stats->bytes < p->content_length) {
+      ESP_LOGW(TAG, "connection lost after %u bytes", stats->bytes);
+      if (!p->etag[0] || stats->resumes >= req->max_resumes) {
+        err = ESP_FAIL;
+        break;
+      }
+      stats->resumes++;
+      err = pipe_resume(p, client, stats->resumes);
+      if (err != ESP_OK) {
+        break;
+      }
+      continue;
+    }
+    if (n < 0) {
+      ESP_LOGE(TAG, "read failed after %u bytes", stats->bytes);
+      err = ESP_FAIL;
+      break;
+    }
+    if (n == 0) {
+      break;
+    }
+
+    int64_t t0 = esp_timer_get_time();
+    if (xRingbufferSend(p->ring, buf, n, OTA_PIPE_SEND_MS / portTICK_PERIOD_MS) != pdTRUE) {
+      ESP_LOGE(TAG, "writer stopped taking data");
+      err = ESP_ERR_TIMEOUT;
+      break;
+    }
+    stats->rx_blocked_ms += pipe_ms_since(t0);
+    stats->bytes += n;
+
+    uint32_t queued = OTA_PIPE_RING_SIZE - xRingbufferGetCurFreeSize(p->ring);
+    if (queued > stats->ring_peak) {
+      stats->ring_peak = queued;
+    }
+
+    if (req->progress_cb && p->content_length) {
+      req->progress_cb(stats->bytes, p->content_length);
+    }
+
+    if (req->throttle_kbps > 0) {
+      int64_t budget_ms = (int64_t) stats->bytes * 1000 / (req->throttle_kbps * 1024);
+      int64_t elapsed_ms = (esp_timer_get_time() - t_start) / 1000;
+      if (budget_ms > elapsed_ms) {
+        vTaskDelay((budget_ms - elapsed_ms) / portTICK_PERIOD_MS + 1);
+      }
+    }
+  }
+
+  if (err == ESP_OK && p->content_length && stats->bytes != p->content_length) {
+    ESP_LOGE(TAG, "got %u of %u bytes", stats->bytes, p->content_length);
+    err = ESP_FAIL;
+  }
+
+  free(buf);
+  return err;
+}
+
+esp_err_t net_ota_pipe_download(const net_ota_pipe_req_t *req, net_ota_pipe_stats_t *stats)
+{
+  ota_pipe_t p = {
+    .receiver = xTaskGetCurrentTaskHandle(),
+    .stats = stats,
+    .err = ESP_OK,
+    .range_start = -1,
+  };
+  esp_http_client_config_t config = {
+    .url = req->url,
+    .cert_pem = g_ca_cert,
+    .skip_cert_common_name_check = true,
+    .keep_alive_enable = true,
+    .event_handler = pipe_http_event,
+    .user_data = &p,
+  };
+  int64_t t0 = esp_timer_get_time();
+  esp_err_t err;
+
+  memset(stats, 0, sizeof(*stats));
+
+  p.part = esp_ota_get_next_update_partition(NULL);
+  if (p.part == NULL) {
+    ESP_LOGE(TAG, "no OTA partition to update");
+    return ESP_ERR_NOT_FOUND;
+  }
+
+  esp_http_client_handle_t client = esp_http_client_init(&config);
+  if (client == NULL) {
+    return ESP_FAIL;
+  }
+
+  // lets the server send a patch against the running image instead
+  uint8_t sha[32];
+  char sha_hex[65];
+  if (esp_partition_get_sha256(esp_ota_get_running_partition(), sha) == ESP_OK) {
+    for (int i = 0; i < sizeof(sha); i++) {
+      sprintf(sha_hex + i * 2, "%02x", sha[i]);
+    }
+    esp_http_client_set_header(client, "X-Running-SHA256", sha_hex);
+  }
+  esp_http_client_set_header(client, "X-OTA-Accept", "ratd");
+
+  err = esp_http_client_open(client, 0);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "can't connect: %s", esp_err_to_name(err));
+    esp_http_client_cleanup(client);
+    return err;
+  }
+
+  int length = esp_http_client_fetch_headers(client);
+  int status = esp_http_client_get_status_code(client);
+  if (status != 200 || length > (int) p.part->size) {
+    ESP_LOGE(TAG, "bad response: status %d, %d bytes", status, length);
+    err = ESP_FAIL;
+    goto close;
+  }
+  p.content_length = length > 0 ? length : 0;
+
+  // nothing is erased up front; esp_ota_write() erases as it goes
+  err = esp_ota_begin(p.part, OTA_WITH_SEQUENTIAL_WRITES, &p.ota);
+  if (err != ESP_OK) {
+    goto close;
+  }
+
+  p.ring = xRingbufferCreate(OTA_PIPE_RING_SIZE, RINGBUF_TYPE_BYTEBUF);
+  p.sector = malloc(OTA_PIPE_SECTOR);
+  p.delta = ota_delta_new(pipe_image_out, &p);
+  if (p.ring == NULL || p.sector == NULL || p.delta == NULL) {
+    err = ESP_ERR_NO_MEM;
+    esp_ota_abort(p.ota);
+    goto close;
+  }
+
+  if (xTaskCreatePinnedToCore(&pipe_writer_task, "ota_write", 4096, &p, TASK_PRIO_OTA,
+                              NULL, TASK_CORE(CORE_NET)) != pdPASS) {
+    err = ESP_ERR_NO_MEM;
+    esp_ota_abort(p.ota);
+    goto close;
+  }
+
+  err = pipe_receive(&p, client, req);
+  if (err != ESP_OK) {
+    p.err = err;
+  }
+  p.rx_done = true;
+
+  // the writer always signals once it has drained the ring or failed
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  err = p.err;
+  stats->image_bytes = p.written;
+  stats->kind = ota_delta_kind(p.delta);
+
+  if (err == ESP_OK) {
+    // verifies the image; only a real update makes it the boot partition
+    err = esp_ota_end(p.ota);
+    if (err == ESP_OK && req->commit) {
+      err = esp_ota_set_boot_partition(p.part);
+    }
+  } else {
+    esp_ota_abort(p.ota);
+  }
+
+close:
+  esp_http_client_close(client);
+  esp_http_client_cleanup(client);
+  if (p.ring) {
+    vRingbufferDelete(p.ring);
+  }
+  ota_delta_free(p.delta);
+  free(p.sector);
+
+  stats->total_ms = pipe_ms_since(t0);
+  return err;
+}
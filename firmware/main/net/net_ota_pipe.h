@@ -0,0 +1,42 @@
+#ifndef NET_OTA_PIPE_H
+#define NET_OTA_PIPE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "net_ota_delta.h"
+
+//
+// Two stage OTA download: the calling task reads the image from the
+// server into a ring buffer while a writer task erases and writes the
+// update partition a whole flash sector at a time, so neither a slow
+// socket nor a flash erase stalls the other.  The writer decodes
+// compressed and delta images (net_ota_delta.h) on the way.
+//
+
+#define OTA_PIPE_RING_SIZE   (16 * 1024)
+#define OTA_PIPE_READ_SIZE   1024
+
+typedef struct {
+  const char *url;
+  bool commit;                // false: verify the image but keep booting this one
+  int throttle_kbps;          // 0 for no limit
+  void (*progress_cb)(size_t received, size_t total);
+  int max_resumes;            // Range requests after dropped connections
+} net_ota_pipe_req_t;
+
+typedef struct {
+  uint32_t bytes;             // received, patch or image
+  uint32_t image_bytes;       // written to the update partition
+  uint32_t total_ms;          // connect to verified image
+  uint32_t rx_blocked_ms;     // receiver waiting for ring space (flash behind)
+  uint32_t wr_idle_ms;        // writer waiting for data (network behind)
+  uint32_t write_ms;           // including the erase of each sector
+  uint32_t ring_peak;
+  uint32_t resumes;
+  ota_delta_kind_t kind;      // what the server sent
+} net_ota_pipe_stats_t;
+
+esp_err_t net_ota_pipe_download(const net_ota_pipe_req_t *req, net_ota_pipe_stats_t *stats);
+
+#endif
@@ -23,6 +23,7 @@
 static const char *TAG = "net_sntp";
 
 static bool s_initialized = false;
+static char s_ntp_server[64];
 
 void net_sntp_sync_cb(struct timeval *tv)
 {
@@ -30,38 +31,50 @@ void net_sntp_sync_cb(struct timeval *tv)
     struct tm timeinfo;
     time_t now;
 
-    char *conf_tz;
-    config_get_string("tz", &conf_tz, "EST5EDT,M3.2.0/2,M11.1.0");
-    setenv("TZ", conf_tz, 1);
-
-    tzset();
+    // TZ is applied by the config subsystem at boot and whenever it changes
     time(&now);
     localtime_r(&now, &timeinfo);
     strftime(strftime_buf, sizeof(strftime_buf), "%c", &timeinfo);
 
-    ESP_LOGI(TAG, "Time synced, %s time is: %s", conf_tz, strftime_buf);
-
-    free(conf_tz);
+    const config_t *cfg = config_acquire();
+    ESP_LOGI(TAG, "Time synced, %s time is: %s", cfg->tz, strftime_buf);
+    config_release(cfg);
+}
 
+static void net_sntp_config_changed(const config_t *cfg, const char *key)
+{
+  if (strcmp(key, "ntp_server") == 0) {
+    strncpy(s_ntp_server, cfg->ntp_server, sizeof(s_ntp_server) - 1);
+    ESP_LOGI(TAG, "ntp server changed to %s", s_ntp_server);
+    if (s_initialized) {
+      sntp_stop();
+      sntp_setservername(0, s_ntp_server);
+      sntp_init();
+    }
+  }
 }
 
 
 void net_sntp_init(void)
 {
   if (!s_initialized) {
-    static char ntp_server[64];
+    static bool listener_registered = false;
     esp_log_level_set(TAG, ESP_LOG_DEBUG);
     ESP_LOGI(TAG, "Initializing SNTP...");
 
     sntp_setoperatingmode(SNTP_OPMODE_POLL);
 
-    char *conf_ntp_server;
-    config_get_string("ntp_server", &conf_ntp_server, "pool.ntp.org");
-    strncpy(ntp_server, conf_ntp_server, sizeof(ntp_server));
-    free(conf_ntp_server);
-    ESP_LOGI(TAG, "ntp server is %s", ntp_server);
+    const config_t *cfg = config_acquire();
+    strncpy(s_ntp_server, cfg->ntp_server, sizeof(s_ntp_server) - 1);
+    config_release(cfg);
+    ESP_LOGI(TAG, "ntp server is %s", s_ntp_server);
+
+    sntp_setservername(0, s_ntp_server);
 
-    sntp_setservername(0, ntp_server);
+    if (!listener_registered) {
+      config_register_listener(net_sntp_config_changed);
+      listener_registered = true;
+    }
 
     sntp_set_time_sync_notification_cb(net_sntp_sync_cb);
     sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH);
@@ -49,6 +49,7 @@
 #include "esp_netif.h"
 #include "esp_task_wdt.h"
 #include "config.h"
+#include "system.h"
 #include "https.h"
 
 #include "lwip/err.h"
@@ -72,22 +73,24 @@
 #include "rfid_task.h"
 #include "net_certs.h"
 #include "net_task.h"
+#include "boot_prof.h"
 #include "net_https.h"
 #include "net_mqtt.h"
 #include "net_sntp.h"
 #include "net_ota.h"
+#include "net_wifi_ps.h"
 #include "main_task.h"
 
 static const char *TAG = "net_task";
 
 void net_timer(TimerHandle_t xTimer);
 
-
-#define NR_OF_IP_ADDRESSES_TO_WAIT_FOR (s_active_interfaces)
+// a NET_CMD_WIFI_PS_TICK is waiting in the queue
+static bool s_ps_tick_queued;
 
 
 static int s_active_interfaces = 0;
-static xSemaphoreHandle s_semph_get_ip_addrs;
+static bool s_started = false;
 static esp_netif_t *s_example_esp_netif = NULL;
 
 
@@ -151,12 +154,22 @@ static void on_got_ip(void *arg, esp_event_base_t event_base,
       return;
   }
   ESP_LOGI(TAG, "Got IPv4 event: Interface \"%s\" address: " IPSTR, esp_netif_get_desc(event->esp_netif), IP2STR(&event->ip_info.ip));
+  boot_mark(BOOT_STAGE_NET_UP);
   memcpy(&s_ip_addr, &event->ip_info.ip, sizeof(s_ip_addr));
-  xSemaphoreGive(s_semph_get_ip_addrs);
 
   display_wifi_status(WIFI_STATUS_CONNECTED);
 
+  char s[32];
+
+  snprintf(s, sizeof(s), "%2x%2x%2x%2x%2x%2x", g_mac_addr[0],g_mac_addr[1],g_mac_addr[2],g_mac_addr[3],g_mac_addr[4],g_mac_addr[5]);
+  display_net_status(NET_STATUS_CUR_MAC, s);
+
+  snprintf(s, sizeof(s), IPSTR, IP2STR(&event->ip_info.ip));
+  display_net_status(NET_STATUS_CUR_IP, s);
+
   net_cmd_queue(NET_CMD_INIT);
+
+  main_task_event(MAIN_EVT_NET_CONNECT);
 }
 
 
@@ -168,20 +181,16 @@ static void net_wifi_configure(void)
           .sort_method = WIFI_CONNECT_AP_BY_SIGNAL,
           .threshold.rssi = -127,
           .threshold.authmode = WIFI_AUTH_WPA_PSK,
+          .listen_interval = WIFI_PS_LISTEN_INTERVAL,
       },
   };
 
-  char *conf_ssid;
-  char *conf_password;
-  config_get_string("wifi_ssid", &conf_ssid, "ssid");
-  config_get_string("wifi_password", &conf_password, "password");
-  strncpy((char*)wifi_config.sta.ssid, conf_ssid, sizeof(wifi_config.sta.ssid));
-  strncpy((char*)wifi_config.sta.password, conf_password, sizeof(wifi_config.sta.password));
-
-  ESP_LOGW(TAG, "WiFi SSID is %s", conf_ssid);
+  const config_t *cfg = config_acquire();
+  strncpy((char*)wifi_config.sta.ssid, cfg->wifi_ssid, sizeof(wifi_config.sta.ssid));
+  strncpy((char*)wifi_config.sta.password, cfg->wifi_password, sizeof(wifi_config.sta.password));
 
-  free(conf_ssid);
-  free(conf_password);
+  ESP_LOGW(TAG, "WiFi SSID is %s", cfg->wifi_ssid);
+  config_release(cfg);
 
   ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
   ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config));
@@ -234,6 +243,7 @@ static esp_netif_t *net_wifi_start(void)
     net_wifi_configure();
 
     ESP_ERROR_CHECK(esp_wifi_start());
+    net_wifi_ps_apply();
     display_wifi_status(WIFI_STATUS_CONNECTING);
     esp_wifi_connect();
     return netif;
@@ -264,8 +274,7 @@ static void net_start(void)
 {
     s_example_esp_netif = net_wifi_start();
     s_active_interfaces++;
-    /* create semaphore if at least one interface is active */
-    s_semph_get_ip_addrs = xSemaphoreCreateCounting(NR_OF_IP_ADDRESSES_TO_WAIT_FOR, 0);
+    s_started = true;
 }
 
 static void net_stop(void)
@@ -275,53 +284,27 @@ static void net_stop(void)
 }
 
 
+// Starts Wi-Fi and returns immediately; on_got_ip() finishes bringing the
+// network up, so the net task keeps draining its queue while we associate.
 esp_err_t net_connect(void)
 {
-    if (s_semph_get_ip_addrs != NULL) {
+    if (s_started) {
         return ESP_ERR_INVALID_STATE;
     }
 
     net_start();
     ESP_ERROR_CHECK(esp_register_shutdown_handler(&net_stop));
     ESP_LOGI(TAG, "Waiting for IP(s)");
-    for (int i = 0; i < NR_OF_IP_ADDRESSES_TO_WAIT_FOR; ++i) {
-        xSemaphoreTake(s_semph_get_ip_addrs, portMAX_DELAY);
-    }
-    // iterate over active interfaces, and print out IPs of "our" netifs
-    esp_netif_t *netif = NULL;
-    esp_netif_ip_info_t ip;
-    for (int i = 0; i < esp_netif_get_nr_of_ifs(); ++i) {
-        netif = esp_netif_next(netif);
-        if (is_our_netif(TAG, netif)) {
-            ESP_LOGI(TAG, "Connected to %s", esp_netif_get_desc(netif));
-            ESP_ERROR_CHECK(esp_netif_get_ip_info(netif, &ip));
-
-            ESP_LOGI(TAG, "- IPv4 address: " IPSTR, IP2STR(&ip.ip));
-
-
-
-            char s[32];
-
-            snprintf(s, sizeof(s), "%2x%2x%2x%2x%2x%2x", g_mac_addr[0],g_mac_addr[1],g_mac_addr[2],g_mac_addr[3],g_mac_addr[4],g_mac_addr[5]);
-            display_net_status(NET_STATUS_CUR_MAC, s);
-
-            snprintf(s, sizeof(s), IPSTR, IP2STR(&ip.ip));
-            display_net_status(NET_STATUS_CUR_IP, s);
-        }
-    }
-
-    main_task_event(MAIN_EVT_NET_CONNECT);
 
     return ESP_OK;
 }
 
 esp_err_t net_disconnect(void)
 {
-    if (s_semph_get_ip_addrs == NULL) {
+    if (!s_started) {
         return ESP_ERR_INVALID_STATE;
     }
-    vSemaphoreDelete(s_semph_get_ip_addrs);
-    s_semph_get_ip_addrs = NULL;
+    s_started = false;
     net_stop();
     ESP_ERROR_CHECK(esp_unregister_shutdown_handler(&net_stop));
 
@@ -406,6 +389,27 @@ esp_err_t net_cmd_queue_wget(char *url, char *filename)
     return ESP_ERR_NO_MEM;
 }
 
+// config changes from MQTT are applied here rather than in the MQTT event
+// task, since the listeners restart SNTP and reconfigure the MQTT client
+esp_err_t net_cmd_queue_config_set(const char *key, const char *value)
+{
+    net_evt_t evt;
+    evt.cmd = NET_CMD_CONFIG_SET;
+    evt.buf1 = strdup(key);
+    evt.params.buf2 = strdup(value);
+    if (evt.buf1 && evt.params.buf2) {
+      if (xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS) == pdTRUE) {
+        return ESP_OK;
+      }
+      free(evt.buf1);
+      free(evt.params.buf2);
+      return ESP_FAIL;
+    }
+    free(evt.buf1);
+    free(evt.params.buf2);
+    return ESP_ERR_NO_MEM;
+}
+
 
 void net_init(void)
 {
@@ -432,6 +436,7 @@ void net_init(void)
     net_https_init();
     net_mqtt_init();
     net_ota_init();
+    net_wifi_ps_init();
 
     TimerHandle_t timer = xTimerCreate("rssi_timer", (1000 / portTICK_PERIOD_MS), pdTRUE, (void*) 0, net_timer);
     if (xTimerStart(timer, 0) != pdPASS) {
@@ -455,7 +460,8 @@ void net_task(void *pvParameters)
 
       esp_task_wdt_reset();
 
-      if (xQueueReceive(m_q, &evt, (20 / portTICK_PERIOD_MS)) == pdPASS) {
+      // commands wake the task; the timeout only paces the watchdog reset
+      if (xQueueReceive(m_q, &evt, (1000 / portTICK_PERIOD_MS)) == pdPASS) {
         switch(evt.cmd) {
           case NET_CMD_INIT:
             net_sntp_init();
@@ -504,17 +510,25 @@ void net_task(void *pvParameters)
             break;
 
           case NET_CMD_SEND_ACCESS:
+            net_wifi_ps_activity();
             net_mqtt_send_access(evt.buf1, evt.params.allowed);
             free(evt.buf1);
             break;
 
           case NET_CMD_SEND_ACCESS_ERROR:
+            net_wifi_ps_activity();
             net_mqtt_send_access_error(evt.buf1, evt.params.buf2);
             free(evt.buf1);
             free(evt.params.buf2);
             break;
 
           case NET_CMD_SEND_POWER_STATUS:
+            if (evt.params.power_status == POWER_STATUS_ON_EXT) {
+              net_wifi_ps_battery(false);
+            } else if (evt.params.power_status == POWER_STATUS_ON_BATT ||
+                       evt.params.power_status == POWER_STATUS_ON_BATT_LOW) {
+              net_wifi_ps_battery(true);
+            }
             net_mqtt_send_power_status(evt.params.power_status);
             break;
 
@@ -532,6 +546,34 @@ void net_task(void *pvParameters)
             free(evt.params.buf2);
             break;
 
+          case NET_CMD_SEND_PENDING:
+            net_mqtt_send_pending();
+            break;
+
+          case NET_CMD_SEND_LOG_DUMP:
+            net_mqtt_send_log_dump();
+            break;
+
+          case NET_CMD_SEND_POWER_STATS:
+            net_mqtt_send_power_stats();
+            break;
+
+          case NET_CMD_CONFIG_SET:
+            {
+              esp_err_t r = config_set_string(evt.buf1, evt.params.buf2);
+              if (r != ESP_OK) {
+                ESP_LOGE(TAG, "config/set '%s' failed: %s", evt.buf1, esp_err_to_name(r));
+              }
+            }
+            free(evt.buf1);
+            free(evt.params.buf2);
+            break;
+
+          case NET_CMD_WIFI_PS_TICK:
+            __atomic_store_n(&s_ps_tick_queued, false, __ATOMIC_SEQ_CST);
+            net_wifi_ps_tick();
+            break;
+
           default:
             ESP_LOGE(TAG, "Unknown net event cmd %d", evt.cmd);
             break;
@@ -544,6 +586,14 @@ void net_timer(TimerHandle_t xTimer)
 {
     static int interval = 0;
 
+    // switching power save blocks, so it's done in net_task rather than
+    // stalling the timer daemon; one tick at a time, so a long download
+    // doesn't fill the queue with them
+    if (!__atomic_exchange_n(&s_ps_tick_queued, true, __ATOMIC_SEQ_CST) &&
+        net_cmd_queue(NET_CMD_WIFI_PS_TICK) != ESP_OK) {
+      __atomic_store_n(&s_ps_tick_queued, false, __ATOMIC_SEQ_CST);
+    }
+
     wifi_ap_record_t wifidata;
     if (esp_wifi_sta_get_ap_info(&wifidata)==0){
         display_wifi_rssi(wifidata.rssi);
@@ -552,6 +602,10 @@ void net_timer(TimerHandle_t xTimer)
           net_cmd_queue(NET_CMD_SEND_WIFI_STR);
         }
 
+        if (interval % 900 == 0) {
+          net_cmd_queue(NET_CMD_SEND_POWER_STATS);
+        }
+
         interval++;
     }
 }
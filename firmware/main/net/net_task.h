@@ -51,6 +51,7 @@ esp_err_t net_cmd_queue_access_error(char *err, char *err_ext);
 esp_err_t net_cmd_queue_wget(char *url, char *filename);
 esp_err_t net_cmd_queue_power_status(power_status_t status);
 esp_err_t net_cmd_queue_door_state(bool door_open);
+esp_err_t net_cmd_queue_config_set(const char *key, const char *value);
 
 typedef enum  {
     NET_CMD_INIT = 0,
@@ -65,7 +66,12 @@ typedef enum  {
     NET_CMD_SEND_POWER_STATUS,
     NET_CMD_SEND_DOOR_STATE,
     NET_CMD_OTA_UPDATE,
-    NET_CMD_WGET
+    NET_CMD_WGET,
+    NET_CMD_SEND_PENDING,
+    NET_CMD_SEND_LOG_DUMP,
+    NET_CMD_SEND_POWER_STATS,
+    NET_CMD_WIFI_PS_TICK,
+    NET_CMD_CONFIG_SET
 } net_cmd_t;
 
 extern uint8_t g_mac_addr[6];
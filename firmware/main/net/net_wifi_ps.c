@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+#include "system.h"
+#include "blog.h"
+#include "perf.h"
+#include "net_wifi_ps.h"
+
+static const char *TAG = "wifi_ps";
+
+#define PS_MODES   3            // WIFI_PS_NONE, WIFI_PS_MIN_MODEM, WIFI_PS_MAX_MODEM
+#define RTT_SLOTS  8
+
+static const char *s_mode_names[PS_MODES] = { "none", "min", "max" };
+static const char *s_rtt_names[PS_MODES] = { "mqtt_rtt_none", "mqtt_rtt_min", "mqtt_rtt_max" };
+static const char *s_kbps_names[PS_MODES] = { "dl_kbps_none", "dl_kbps_min", "dl_kbps_max" };
+
+typedef struct {
+  int msg_id;
+  int64_t t_us;
+  wifi_ps_type_t mode;
+} rtt_slot_t;
+
+static SemaphoreHandle_t s_mutex;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static int s_transfers;
+static int64_t s_activity_until_us;
+static bool s_battery;
+static int s_forced = -1;
+
+static wifi_ps_type_t s_mode = WIFI_PS_MIN_MODEM;     // the driver's default
+static int64_t s_mode_since_us;
+static int64_t s_mode_us[PS_MODES];
+static uint32_t s_switches;
+
+static rtt_slot_t s_rtt[RTT_SLOTS];
+static perf_stat_t *s_rtt_stat[PS_MODES];
+static perf_stat_t *s_kbps_stat[PS_MODES];
+
+
+static wifi_ps_type_t net_wifi_ps_wanted(int64_t now)
+{
+  if (s_forced >= 0) {
+    return s_forced;
+  }
+#ifdef WIFI_PS_ADAPTIVE
+  if (s_transfers || now < s_activity_until_us) {
+    return WIFI_PS_NONE;
+  }
+  return s_battery ? WIFI_PS_MAX_MODEM : WIFI_PS_MIN_MODEM;
+#else
+  return WIFI_PS_MIN_MODEM;
+#endif
+}
+
+static void net_wifi_ps_update(bool reapply, TickType_t wait)
+{
+  if (s_mutex == NULL || xSemaphoreTake(s_mutex, wait) != pdTRUE) {
+    return;
+  }
+
+  int64_t now = esp_timer_get_time();
+  wifi_ps_type_t mode = net_wifi_ps_wanted(now);
+
+  if (mode != s_mode || reapply) {
+    esp_err_t err = esp_wifi_set_ps(mode);
+    if (err == ESP_OK) {
+      if (mode != s_mode) {
+        BLOG("wifi_ps: %s -> %s", s_mode_names[s_mode], s_mode_names[mode]);
+        s_mode_us[s_mode] += now - s_mode_since_us;
+        s_mode_since_us = now;
+        s_mode = mode;
+        s_switches++;
+      }
+    } else if (err != ESP_ERR_WIFI_NOT_INIT) {
+      ESP_LOGW(TAG, "can't set power save %s: %s", s_mode_names[mode], esp_err_to_name(err));
+    }
+  }
+
+  xSemaphoreGive(s_mutex);
+}
+
+void net_wifi_ps_init(void)
+{
+  s_mutex = xSemaphoreCreateMutex();
+  s_mode_since_us = esp_timer_get_time();
+
+  for (int i = 0; i < PS_MODES; i++) {
+    s_rtt_stat[i] = perf_register(s_rtt_names[i], "ms");
+    s_kbps_stat[i] = perf_register(s_kbps_names[i], "KB/s");
+  }
+}
+
+void net_wifi_ps_apply(void)
+{
+  net_wifi_ps_update(true, portMAX_DELAY);
+}
+
+void net_wifi_ps_transfer(bool start)
+{
+  portENTER_CRITICAL(&s_lock);
+  if (start) {
+    s_transfers++;
+  } else if (s_transfers) {
+    s_transfers--;
+  }
+  portEXIT_CRITICAL(&s_lock);
+
+  net_wifi_ps_update(false, portMAX_DELAY);
+}
+
+void net_wifi_ps_activity(void)
+{
+  s_activity_until_us = esp_timer_get_time() + WIFI_PS_ACTIVITY_MS * 1000LL;
+  net_wifi_ps_update(false, portMAX_DELAY);
+}
+
+void net_wifi_ps_battery(bool on_battery)
+{
+  s_battery = on_battery;
+  net_wifi_ps_update(false, portMAX_DELAY);
+}
+
+// 1 Hz from net_task (NET_CMD_WIFI_PS_TICK), never from the timer daemon:
+// esp_wifi_set_ps() blocks on the WiFi task
+void net_wifi_ps_tick(void)
+{
+  net_wifi_ps_update(false, portMAX_DELAY);
+}
+
+void net_wifi_ps_force(int mode)
+{
+  s_forced = (mode >= 0 && mode < PS_MODES) ? mode : -1;
+  net_wifi_ps_update(false, portMAX_DELAY);
+}
+
+// QoS 1/2 publishes; the round trip to the PUBACK is how long the AP held
+// the ack for us, which is what the power save mode trades away
+void net_wifi_ps_mqtt_sent(int msg_id)
+{
+  if (msg_id <= 0) {
+    return;
+  }
+
+  portENTER_CRITICAL(&s_lock);
+  // a free slot, or the oldest if acks have gone missing
+  rtt_slot_t *slot = &s_rtt[0];
+  for (int i = 1; i < RTT_SLOTS && slot->msg_id; i++) {
+    if (s_rtt[i].msg_id == 0 || s_rtt[i].t_us < slot->t_us) {
+      slot = &s_rtt[i];
+    }
+  }
+  slot->msg_id = msg_id;
+  slot->t_us = esp_timer_get_time();
+  slot->mode = s_mode;
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void net_wifi_ps_mqtt_acked(int msg_id)
+{
+  int64_t now = esp_timer_get_time();
+  int64_t t_us = 0;
+  wifi_ps_type_t mode = WIFI_PS_NONE;
+
+  portENTER_CRITICAL(&s_lock);
+  for (int i = 0; i < RTT_SLOTS; i++) {
+    if (s_rtt[i].msg_id == msg_id) {
+      t_us = s_rtt[i].t_us;
+      mode = s_rtt[i].mode;
+      s_rtt[i].msg_id = 0;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&s_lock);
+
+  if (t_us) {
+    perf_record(s_rtt_stat[mode], (now - t_us) / 1000);
+  }
+}
+
+void net_wifi_ps_record_kbps(uint32_t kbps)
+{
+  perf_record(s_kbps_stat[s_mode], kbps);
+}
+
+void net_wifi_ps_report(void)
+{
+  int64_t now = esp_timer_get_time();
+
+  printf("wifi power save: %s (%s), %u switches, %s, %d transfers\n", s_mode_names[s_mode],
+         s_forced >= 0 ? "forced" : "auto", s_switches, s_battery ? "on battery" : "on mains", s_transfers);
+  printf("%-5s %10s %9s %9s %9s %9s\n", "mode", "time s", "rtt n", "rtt p50", "rtt p90", "KB/s avg");
+
+  for (int i = 0; i < PS_MODES; i++) {
+    perf_summary_t rtt, kbps;
+    if (s_rtt_stat[i] == NULL || s_kbps_stat[i] == NULL) {
+      continue;
+    }
+    perf_summarize(s_rtt_stat[i], &rtt);
+    perf_summarize(s_kbps_stat[i], &kbps);
+
+    int64_t us = s_mode_us[i] + (i == (int) s_mode ? now - s_mode_since_us : 0);
+    printf("%-5s %10lld %9u %9u %9u %9u\n", s_mode_names[i], us / 1000000, rtt.count, rtt.p50, rtt.p90, kbps.avg);
+  }
+}
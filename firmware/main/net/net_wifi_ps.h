@@ -0,0 +1,40 @@
+#ifndef NET_WIFI_PS_H
+#define NET_WIFI_PS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//
+// Picks the Wi-Fi power save mode from what the node is doing:
+//
+//   WIFI_PS_NONE       while an ACL, OTA or file download runs, and for
+//                      WIFI_PS_ACTIVITY_MS after a scan, so the access event
+//                      and whatever the server sends back aren't held up
+//                      waiting for the next beacon
+//   WIFI_PS_MIN_MODEM  idle on mains power, wakes for every DTIM
+//   WIFI_PS_MAX_MODEM  idle on battery, wakes every WIFI_PS_LISTEN_INTERVAL
+//                      beacons
+//
+// MQTT publish to PUBACK round trips and http_get throughput are recorded
+// per mode as perf stats (mqtt_rtt_<mode>, dl_kbps_<mode>); force a mode
+// with net_wifi_ps_force() ("wifi_ps" on the console) to measure the ones
+// the controller wouldn't pick for a transfer.
+//
+
+void net_wifi_ps_init(void);
+// Wi-Fi was (re)started, push the current mode to the driver
+void net_wifi_ps_apply(void);
+
+void net_wifi_ps_transfer(bool start);     // nestable
+void net_wifi_ps_activity(void);
+void net_wifi_ps_battery(bool on_battery);
+void net_wifi_ps_tick(void);               // 1 Hz, ends the post-scan hold
+void net_wifi_ps_force(int mode);          // a wifi_ps_type_t, -1 for automatic
+
+void net_wifi_ps_mqtt_sent(int msg_id);
+void net_wifi_ps_mqtt_acked(int msg_id);
+void net_wifi_ps_record_kbps(uint32_t kbps);
+
+void net_wifi_ps_report(void);
+
+#endif
@@ -41,6 +41,8 @@
 #include <esp_system.h>
 #include "esp_task_wdt.h"
 #include <driver/uart.h>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
 #include <soc/uart_struct.h>
 #include <mbedtls/sha256.h>
 
@@ -51,6 +53,12 @@
 #include "rfid_task.h"
 #include "main_task.h"
 #include "acl.h"
+#include "rtc_cache.h"
+#include "blog.h"
+#include "perf.h"
+#include "pm_ctl.h"
+#include "esp_timer.h"
+#include "freertos/queue.h"
 
 #define SER_BUF_SIZE (256)
 #define SER_RFID_TXD  (GPIO_PIN_TXD1)
@@ -66,6 +74,70 @@ static const char *TAG = "rfid_task";
 SemaphoreHandle_t m_member_record_mutex;
 member_record_t m_member_record;
 
+// frames replayed by the stress test are looked up like real scans but kept
+// out of m_member_record so they never reach the door/UI/network
+member_record_t m_injected_record;
+
+#define RFID_INJECT_QUEUE_DEPTH 4
+static QueueHandle_t m_inject_q;
+
+// rfid_task blocks on reader data and injected frames together, waking
+// only to feed the watchdog when neither arrives
+#define RFID_UART_QUEUE_DEPTH 8
+#define RFID_WDT_MS 1000
+static QueueHandle_t m_uart_q;
+static QueueSetHandle_t m_rx_set;
+
+// The UART is clock gated in light sleep, so while idle the RX line itself
+// is a low level wakeup source (the line idles high, the start bit is low).
+// The level interrupt is one-shot: the ISR disables it and tells rfid_task,
+// which keeps the chip awake for the reader's repeated frame and re-arms
+// the pin once the line has been quiet.  The bytes that arrived before the
+// UART was clocked again are lost.
+#ifdef CONFIG_PM_ENABLE
+static QueueHandle_t m_wake_q;
+static volatile bool m_rx_wake_en;
+static bool m_rx_woke;
+#endif
+
+static perf_stat_t *m_lookup_stat;
+
+
+#ifdef CONFIG_PM_ENABLE
+static void IRAM_ATTR rfid_rx_isr(void *arg)
+{
+    BaseType_t woken = pdFALSE;
+    uint8_t dummy = 0;
+
+    gpio_intr_disable(SER_RFID_RXD);
+    xQueueOverwriteFromISR(m_wake_q, &dummy, &woken);
+    if (woken)
+        portYIELD_FROM_ISR();
+}
+
+static void rfid_rx_arm(void)
+{
+    if (m_rx_wake_en) {
+        gpio_wakeup_enable(SER_RFID_RXD, GPIO_INTR_LOW_LEVEL);
+        gpio_intr_enable(SER_RFID_RXD);
+    }
+}
+#endif
+
+// the reader is powered off in system_sleep and its line may float, so the
+// RX wakeup is dropped before and re-armed after
+void rfid_rx_wakeup(bool enable)
+{
+#ifdef CONFIG_PM_ENABLE
+    m_rx_wake_en = enable;
+    if (enable) {
+        rfid_rx_arm();
+    } else {
+        gpio_intr_disable(SER_RFID_RXD);
+        gpio_wakeup_disable(SER_RFID_RXD);
+    }
+#endif
+}
 
 void rfid_init()
 {
@@ -76,17 +148,49 @@ void rfid_init()
         .stop_bits = UART_STOP_BITS_1,
         .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
         .rx_flow_ctrl_thresh = 122,
+#ifdef CONFIG_PM_ENABLE
+        // keeps the baud rate right while the APB clock scales
+        .source_clk = UART_SCLK_REF_TICK,
+#endif
     };
 
     uart_param_config(uart_num, &uart_config);
     uart_set_pin(uart_num, SER_RFID_TXD, SER_RFID_RXD, SER_RFID_RTS, SER_RFID_CTS);
-    uart_driver_install(uart_num, SER_BUF_SIZE * 2, 0, 0, NULL, 0);
+    uart_driver_install(uart_num, SER_BUF_SIZE * 2, 0, RFID_UART_QUEUE_DEPTH, &m_uart_q, 0);
 
     m_member_record_mutex = xSemaphoreCreateMutex();
     if (!m_member_record_mutex) {
         ESP_LOGE(TAG, "Could not create mutexes.");
         return;
     }
+
+    m_inject_q = xQueueCreate(RFID_INJECT_QUEUE_DEPTH, RFID_FRAME_LEN);
+    if (m_inject_q == NULL) {
+        ESP_LOGE(TAG, "Could not create inject queue.");
+    }
+
+    m_rx_set = xQueueCreateSet(RFID_UART_QUEUE_DEPTH + RFID_INJECT_QUEUE_DEPTH + 1);
+    if (m_rx_set == NULL || xQueueAddToSet(m_uart_q, m_rx_set) != pdPASS ||
+        xQueueAddToSet(m_inject_q, m_rx_set) != pdPASS) {
+        ESP_LOGE(TAG, "Could not create receive queue set.");
+    }
+
+#ifdef CONFIG_PM_ENABLE
+    m_wake_q = xQueueCreate(1, sizeof(uint8_t));
+    if (m_wake_q == NULL || m_rx_set == NULL || xQueueAddToSet(m_wake_q, m_rx_set) != pdPASS) {
+        ESP_LOGE(TAG, "Could not create RX wakeup queue.");
+    } else {
+        esp_err_t err = gpio_install_isr_service(0);
+        if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+            ESP_LOGE(TAG, "Could not install GPIO ISR service: %s", esp_err_to_name(err));
+        }
+        gpio_isr_handler_add(SER_RFID_RXD, rfid_rx_isr, NULL);
+        esp_sleep_enable_gpio_wakeup();
+        rfid_rx_wakeup(true);
+    }
+#endif
+
+    m_lookup_stat = perf_register("rfid_lookup", "us");
 }
 
 
@@ -99,6 +203,23 @@ BaseType_t rfid_get_member_record(member_record_t* member)
   return 0;
 }
 
+BaseType_t rfid_get_injected_record(member_record_t* member)
+{
+  xSemaphoreTake(m_member_record_mutex, portMAX_DELAY);
+  memcpy(member, &m_injected_record, sizeof(member_record_t));
+  xSemaphoreGive(m_member_record_mutex);
+  return 0;
+}
+
+// queue a raw reader frame to be processed by rfid_task as if it came from the UART
+BaseType_t rfid_inject_frame(const uint8_t *buf, size_t len)
+{
+  if (len != RFID_FRAME_LEN) {
+    return pdFALSE;
+  }
+  return xQueueSendToBack(m_inject_q, buf, 0);
+}
+
 //
 // create a hex digest of the SHA224 hashed tag
 // this is some legacy stuff of the MakeIt RFID system where tags are internally saved/managed as SHA224
@@ -123,13 +244,14 @@ void rfid_hash_sha224(char *tag_ascii, int ascii_len, char *tag_hexdigest, int d
 }
 
 #define LINE_SIZE 256
-uint8_t rfid_lookup(uint32_t tag, member_record_t *member)
+// acl_gen (optional) is set to the RTC cache's ACL generation while the
+// ACL is locked, so the decision can be cached against the list it came from
+uint8_t rfid_lookup(uint32_t tag, member_record_t *member, uint32_t *acl_gen)
 {
     char tag_ascii[32];
     char tag_sha224[65];
     char line[LINE_SIZE];
-    char *conf_acl_filename;
-
+    char acl_filename[64];
     snprintf(tag_ascii, sizeof(tag_ascii), "%10.10u", tag);
     rfid_hash_sha224(tag_ascii, strlen(tag_ascii), tag_sha224, sizeof(tag_sha224));
 
@@ -142,15 +264,16 @@ uint8_t rfid_lookup(uint32_t tag, member_record_t *member)
 
     xSemaphoreTake(g_acl_mutex, portMAX_DELAY);
 
-    acl_get_data_filename(&conf_acl_filename);
-    FILE *f = fopen(conf_acl_filename, "r");
+    if (acl_gen != NULL)
+        *acl_gen = rtc_cache_acl_gen();
+
+    acl_get_data_filename(acl_filename, sizeof(acl_filename));
+    FILE *f = fopen(acl_filename, "r");
     if (f == NULL) {
         ESP_LOGE(TAG, "Failed to open ACL file for reading!");
         xSemaphoreGive(g_acl_mutex);
-        free(conf_acl_filename);
         return 0;
     }
-    free(conf_acl_filename);
 
     uint8_t found = 0;
     while ((fgets(line, LINE_SIZE, f) != NULL) && !found) {
@@ -174,7 +297,7 @@ uint8_t rfid_lookup(uint32_t tag, member_record_t *member)
 
             ESP_LOGD(TAG, "comparing %s to %s", tag_sha224, hashed_card);
             if (strcmp(tag_sha224, hashed_card) == 0) {
-                ESP_LOGI(TAG, "found tag for user %s, access %s", username, allowed);
+                BLOG("rfid: tag %010u found in ACL", tag);
                 found = 1;
 
                 strncpy(member->name, username, FIELD_SIZE);
@@ -208,51 +331,134 @@ uint8_t rfid_lookup(uint32_t tag, member_record_t *member)
  * byte 07 ('id0') is the least significant byte.
  */
 
+void rfid_process_frame(const uint8_t *buf, int len, bool injected)
+{
+    if (len != RFID_FRAME_LEN) {
+        return;
+    }
+
+    int64_t scan_time_us = esp_timer_get_time();
+
+    uint8_t checksum_calc = 0;
+    for (uint8_t i=1; i<8; i++) checksum_calc ^= buf[i];
+
+    if (buf[0] == 0x02 && buf[9] == 0x03 && checksum_calc == buf[8]) {
+        uint32_t tag = (buf[4]<<24) | (buf[5]<<16) | (buf[6]<<8) | buf[7];
+
+        BLOG("rfid: good frame, tag %010u sum %02X", tag, buf[8]);
+
+        if (tag != 0) {
+          member_record_t *rec = injected ? &m_injected_record : &m_member_record;
+
+          if (!injected)
+            main_task_event(MAIN_EVT_RFID_PRE_SCAN);
+
+          xSemaphoreTake(m_member_record_mutex, portMAX_DELAY);
+          bzero(rec, sizeof(member_record_t));
+          uint8_t found;
+          // right after a deep sleep wake the ACL is still being hashed;
+          // let recent members in without waiting for it
+          if (!injected && !acl_is_validated() && rtc_cache_lookup(tag, rec)) {
+            BLOG("rfid: tag %010u granted from RTC cache", tag);
+            rec->from_cache = 1;
+            found = 1;
+          } else {
+            uint32_t acl_gen;
+            pm_busy_begin();
+            found = rfid_lookup(tag, rec, &acl_gen);
+            pm_busy_end();
+            if (!injected)
+              rtc_cache_store(tag, rec, found, acl_gen);
+          }
+          rec->tag = tag;
+          rec->scan_time_us = scan_time_us;
+          xSemaphoreGive(m_member_record_mutex);
+
+          perf_record(m_lookup_stat, esp_timer_get_time() - scan_time_us);
+
+          if (injected)
+            main_task_event(MAIN_EVT_INJECTED_RFID_SCAN);
+          else if (found)
+            main_task_event(MAIN_EVT_VALID_RFID_SCAN);
+          else
+            main_task_event(MAIN_EVT_INVALID_RFID_SCAN);
+        } else {
+          ESP_LOGW(TAG, "Bad RFID tag value 0, ignoring.  May indicate bad RFID module?");
+        }
+    } else {
+        BLOG("rfid: bad frame, bytes %08X sum %02X != %02X",
+             (buf[0]<<24) | (buf[1]<<16) | (buf[2]<<8) | buf[3], buf[8], checksum_calc);
+    }
+}
+
+#ifdef CONFIG_PM_ENABLE
+// The first frame after an RX wakeup usually loses its leading bytes.  The
+// checksum doesn't cover STX, so a frame missing only that byte is whole.
+static int rfid_resync_frame(uint8_t *buf, int len)
+{
+    if (len == RFID_FRAME_LEN - 1 && buf[len - 1] == 0x03) {
+        memmove(buf + 1, buf, len);
+        buf[0] = 0x02;
+        return RFID_FRAME_LEN;
+    }
+    if (len == RFID_FRAME_LEN && buf[0] != 0x02 && buf[9] == 0x03) {
+        buf[0] = 0x02;
+    }
+    return len;
+}
+#endif
+
 void rfid_task(void *pvParameters)
 {
     uint8_t* rxbuf = (uint8_t*) malloc(SER_BUF_SIZE);
+    uint8_t injected[RFID_FRAME_LEN];
+    uart_event_t event;
+#ifdef CONFIG_PM_ENABLE
+    uint8_t wake;
+#endif
 
     esp_task_wdt_add(NULL);
 
     while(1) {
         esp_task_wdt_reset();
 
-        int len = uart_read_bytes(uart_num, rxbuf, SER_BUF_SIZE, 20 / portTICK_RATE_MS);
-
-        if (len==10) {
-            uint8_t checksum_calc = 0;
-            for (uint8_t i=1; i<8; i++) checksum_calc ^= rxbuf[i];
-
-            if (rxbuf[0] == 0x02 && rxbuf[9] == 0x03 && checksum_calc == rxbuf[8]) {
-                uint32_t tag = (rxbuf[4]<<24) | (rxbuf[5]<<16) | (rxbuf[6]<<8) | rxbuf[7];
-
-                char s[80];
-                ESP_LOGD(TAG, "Good RFID tag checksum, bytes follow:");
-                snprintf(s, sizeof(s), "%10.10u %2.2X %2.2X %2.2X %2.2X [%2.2X == %2.2X]", tag, rxbuf[4], rxbuf[5], rxbuf[6], rxbuf[7], rxbuf[8], checksum_calc);
-                ESP_LOGD(TAG, "%s", s);
-
-                if (tag != 0) {
-                  main_task_event(MAIN_EVT_RFID_PRE_SCAN);
-
-                  xSemaphoreTake(m_member_record_mutex, portMAX_DELAY);
-                  bzero(&m_member_record, sizeof(m_member_record));
-                  uint8_t found = rfid_lookup(tag, &m_member_record);
-                  m_member_record.tag = tag;
-                  xSemaphoreGive(m_member_record_mutex);
-
-                  if (found)
-                    main_task_event(MAIN_EVT_VALID_RFID_SCAN);
-                  else
-                    main_task_event(MAIN_EVT_INVALID_RFID_SCAN);
-                } else {
-                  ESP_LOGW(TAG, "Bad RFID tag value 0, ignoring.  May indicate bad RFID module?");
+        QueueSetMemberHandle_t q = xQueueSelectFromSet(m_rx_set, RFID_WDT_MS / portTICK_PERIOD_MS);
+
+        if (q == m_uart_q && xQueueReceive(m_uart_q, &event, 0) == pdTRUE) {
+#ifdef CONFIG_PM_ENABLE
+            pm_ctl_hold_awake(RFID_AWAKE_MS);
+#endif
+            if (event.type == UART_DATA) {
+                // the driver posts data on the reader's inter-frame gap, so
+                // a whole frame normally arrives as one event
+                int len = uart_read_bytes(uart_num, rxbuf, event.size < SER_BUF_SIZE ? event.size : SER_BUF_SIZE, 0);
+#ifdef CONFIG_PM_ENABLE
+                if (m_rx_woke) {
+                    len = rfid_resync_frame(rxbuf, len);
+                    m_rx_woke = false;
+                }
+#endif
+                if (len == RFID_FRAME_LEN) {
+                    rfid_process_frame(rxbuf, len, false);
                 }
-            } else {
-                char s[80];
-                ESP_LOGW(TAG, "Bad RFID tag checksum, bytes follow:");
-                snprintf(s, sizeof(s), "%2.2X %2.2X %2.2X %2.2X [%2.2X != %2.2X]", rxbuf[0], rxbuf[1], rxbuf[2], rxbuf[3], rxbuf[4], checksum_calc);
-                ESP_LOGW(TAG, "%s", s);
+            } else if (event.type == UART_FIFO_OVF || event.type == UART_BUFFER_FULL) {
+                ESP_LOGW(TAG, "UART overflow, flushing");
+                uart_flush_input(uart_num);
             }
+        } else if (q == m_inject_q && xQueueReceive(m_inject_q, injected, 0) == pdTRUE) {
+            rfid_process_frame(injected, RFID_FRAME_LEN, true);
+#ifdef CONFIG_PM_ENABLE
+        } else if (q == m_wake_q && xQueueReceive(m_wake_q, &wake, 0) == pdTRUE) {
+            // the rest of this frame and the reader's next one must arrive awake
+            pm_ctl_hold_awake(RFID_AWAKE_MS);
+            m_rx_woke = true;
+            continue;
+#endif
         }
+
+#ifdef CONFIG_PM_ENABLE
+        // a frame (or nothing for RFID_WDT_MS) since the line went low
+        rfid_rx_arm();
+#endif
     }
 }
@@ -39,16 +39,24 @@
 
 #define FIELD_SIZE 32
 
+#define RFID_FRAME_LEN 10
+
 typedef struct member_record {
     char name[FIELD_SIZE];
     uint8_t allowed;
     uint32_t tag;
+    int64_t scan_time_us;   // esp_timer time the frame was picked up for processing
+    uint8_t from_cache;     // granted from the RTC hot tag cache, not the ACL
 } member_record_t;
 
 
 void rfid_init();
 void rfid_task(void *pvParameters);
 BaseType_t rfid_get_member_record(member_record_t* member);
+BaseType_t rfid_get_injected_record(member_record_t* member);
+BaseType_t rfid_inject_frame(const uint8_t *buf, size_t len);
+void rfid_process_frame(const uint8_t *buf, int len, bool injected);
+void rfid_rx_wakeup(bool enable);
 
 
 #endif
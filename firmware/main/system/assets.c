@@ -0,0 +1,416 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_spi_flash.h"
+#include "nvs_flash.h"
+#include "mbedtls/md.h"
+#include "assets.h"
+
+static const char *TAG = "assets";
+
+#define ASSETS_NVS_NAMESPACE "assets"
+#define ASSETS_NVS_KEY_SLOT  "slot"
+#define ASSETS_SECTOR_SIZE   4096
+
+static const esp_partition_t *s_part = NULL;
+static uint32_t s_slot_size = 0;
+static int s_active = -1;
+
+static const uint8_t *s_base = NULL;
+static const assets_hdr_t *s_hdr = NULL;
+static const asset_entry_t *s_entries = NULL;
+static spi_flash_mmap_handle_t s_mmap;
+static char s_hash[ASSETS_HASH_LEN] = "";
+
+// update in progress
+static int s_wr_slot = -1;
+static size_t s_wr_len = 0;
+static size_t s_wr_erased = 0;
+static mbedtls_md_context_t s_wr_md;
+
+
+static void assets_hex(const uint8_t *digest, char *hash)
+{
+  for (int i = 0; i < 224 / 8; i++) {
+    sprintf(hash + i * 2, "%2.2x", digest[i]);
+  }
+}
+
+static int assets_nvs_slot(void)
+{
+  nvs_handle_t hdl;
+  uint8_t slot = 0;
+
+  if (nvs_open(ASSETS_NVS_NAMESPACE, NVS_READONLY, &hdl) == ESP_OK) {
+    nvs_get_u8(hdl, ASSETS_NVS_KEY_SLOT, &slot);
+    nvs_close(hdl);
+  }
+  return slot ? 1 : 0;
+}
+
+static esp_err_t assets_nvs_set_slot(int slot)
+{
+  nvs_handle_t hdl;
+  esp_err_t r = nvs_open(ASSETS_NVS_NAMESPACE, NVS_READWRITE, &hdl);
+  if (r != ESP_OK) {
+    return r;
+  }
+
+  r = nvs_set_u8(hdl, ASSETS_NVS_KEY_SLOT, slot);
+  if (r == ESP_OK) {
+    r = nvs_commit(hdl);
+  }
+  nvs_close(hdl);
+  return r;
+}
+
+static bool assets_slot_header(int slot, assets_hdr_t *hdr)
+{
+  if (esp_partition_read(s_part, slot * s_slot_size, hdr, sizeof(*hdr)) != ESP_OK) {
+    return false;
+  }
+
+  return hdr->magic == ASSETS_MAGIC &&
+         hdr->version == ASSETS_VERSION &&
+         hdr->size <= s_slot_size &&
+         hdr->size >= sizeof(assets_hdr_t) + hdr->count * sizeof(asset_entry_t);
+}
+
+// RLE tokens, as ui_img.c decodes them
+#define RLE_TOK_KIND(t)   ((t) & 0xC0)
+#define RLE_TOK_COUNT(t)  (((t) & 0x3F) + 1)
+#define RLE_TOK_SKIP      0x00
+#define RLE_TOK_FILL      0x40
+
+// every row must start inside the pool and decode a full width of pixels
+// without reading past the end of it
+static bool assets_check_rle(const asset_entry_t *e, const uint16_t *rows, const uint8_t *pool, uint32_t pool_size)
+{
+  const uint32_t in_px = (e->flags & ASSET_FLAG_ALPHA) ? 3 : 2;
+
+  for (int y = 0; y < e->h; y++) {
+    uint32_t off = rows[y];
+    uint32_t pos = 0;
+
+    while (pos < e->w) {
+      if (off >= pool_size) {
+        return false;
+      }
+      uint8_t t = pool[off++];
+      uint32_t n = RLE_TOK_COUNT(t);
+      uint32_t data = (RLE_TOK_KIND(t) == RLE_TOK_SKIP) ? 0 : (RLE_TOK_KIND(t) == RLE_TOK_FILL) ? in_px : n * in_px;
+
+      if (data > pool_size - off) {
+        return false;
+      }
+      off += data;
+      pos += n;
+    }
+  }
+  return true;
+}
+
+// every entry must lie inside the blob, and images must reference a pool
+// their rows stay inside; base is the blob, mapped
+static bool assets_check_entries(const uint8_t *base)
+{
+  const assets_hdr_t *hdr = (const assets_hdr_t *) base;
+  const asset_entry_t *entries = (const asset_entry_t *) (base + sizeof(assets_hdr_t));
+
+  for (int i = 0; i < hdr->count; i++) {
+    const asset_entry_t *e = &entries[i];
+
+    if (e->name[ASSETS_NAME_MAX - 1] != '\0' || e->offset > hdr->size || e->size > hdr->size - e->offset) {
+      ESP_LOGE(TAG, "entry %d out of range", i);
+      return false;
+    }
+  }
+
+  for (int i = 0; i < hdr->count; i++) {
+    const asset_entry_t *e = &entries[i];
+
+    if (e->type != ASSET_TYPE_IMG_RLE) {
+      continue;
+    }
+    if (e->size != e->h * sizeof(uint16_t) || (e->offset & 1) ||
+        e->pool >= hdr->count || entries[e->pool].type != ASSET_TYPE_RAW ||
+        !assets_check_rle(e, (const uint16_t *) (base + e->offset),
+                          base + entries[e->pool].offset, entries[e->pool].size)) {
+      ESP_LOGE(TAG, "image %s is malformed", e->name);
+      return false;
+    }
+  }
+  return true;
+}
+
+esp_err_t assets_init(void)
+{
+  assets_hdr_t hdr;
+
+  s_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ASSETS_PARTITION_SUBTYPE, ASSETS_PARTITION_LABEL);
+  if (s_part == NULL) {
+    ESP_LOGE(TAG, "no %s partition", ASSETS_PARTITION_LABEL);
+    return ESP_ERR_NOT_FOUND;
+  }
+  s_slot_size = s_part->size / 2;
+
+  int slot = assets_nvs_slot();
+  if (!assets_slot_header(slot, &hdr)) {
+    ESP_LOGW(TAG, "slot %d has no assets, trying slot %d", slot, !slot);
+    slot = !slot;
+    if (!assets_slot_header(slot, &hdr)) {
+      ESP_LOGE(TAG, "no valid assets in either slot");
+      return ESP_ERR_NOT_FOUND;
+    }
+  }
+
+  esp_err_t r = esp_partition_mmap(s_part, slot * s_slot_size, hdr.size, SPI_FLASH_MMAP_DATA,
+                                   (const void **) &s_base, &s_mmap);
+  if (r != ESP_OK) {
+    ESP_LOGE(TAG, "can't map assets: %s", esp_err_to_name(r));
+    return r;
+  }
+
+  s_hdr = (const assets_hdr_t *) s_base;
+  s_entries = (const asset_entry_t *) (s_base + sizeof(assets_hdr_t));
+
+  if (!assets_check_entries(s_base)) {
+    spi_flash_munmap(s_mmap);
+    s_base = NULL;
+    s_hdr = NULL;
+    s_entries = NULL;
+    return ESP_ERR_INVALID_STATE;
+  }
+
+  s_active = slot;
+  ESP_LOGI(TAG, "slot %d: %d assets, %u bytes mapped at %p", slot, s_hdr->count, s_hdr->size, s_base);
+  return ESP_OK;
+}
+
+bool assets_ready(void)
+{
+  return s_base != NULL;
+}
+
+int assets_count(void)
+{
+  return s_hdr ? s_hdr->count : 0;
+}
+
+const asset_entry_t *assets_entry(int index)
+{
+  if (index < 0 || index >= assets_count()) {
+    return NULL;
+  }
+  return &s_entries[index];
+}
+
+const asset_entry_t *assets_find(const char *name)
+{
+  for (int i = 0; i < assets_count(); i++) {
+    if (strncmp(s_entries[i].name, name, ASSETS_NAME_MAX) == 0) {
+      return &s_entries[i];
+    }
+  }
+  return NULL;
+}
+
+const void *assets_data(const asset_entry_t *e)
+{
+  return s_base + e->offset;
+}
+
+// SHA-224 of the mapped blob, as the server reports it in X-Hash-SHA224;
+// empty when there are no assets so any download will differ
+esp_err_t assets_hash(char *hash)
+{
+  hash[0] = '\0';
+
+  if (s_base == NULL) {
+    return ESP_ERR_INVALID_STATE;
+  }
+
+  if (s_hash[0] == '\0') {
+    uint8_t digest[32];
+    mbedtls_md(mbedtls_md_info_from_type(MBEDTLS_MD_SHA224), s_base, s_hdr->size, digest);
+    assets_hex(digest, s_hash);
+  }
+
+  strcpy(hash, s_hash);
+  return ESP_OK;
+}
+
+esp_err_t assets_write_begin(void)
+{
+  if (s_part == NULL) {
+    return ESP_ERR_NOT_FOUND;
+  }
+
+  // never the slot the display is drawing from
+  s_wr_slot = (s_active < 0) ? 0 : !s_active;
+  s_wr_len = 0;
+  s_wr_erased = 0;
+
+  mbedtls_md_init(&s_wr_md);
+  if (mbedtls_md_setup(&s_wr_md, mbedtls_md_info_from_type(MBEDTLS_MD_SHA224), 0) != 0 ||
+      mbedtls_md_starts(&s_wr_md) != 0) {
+    mbedtls_md_free(&s_wr_md);
+    s_wr_slot = -1;
+    return ESP_FAIL;
+  }
+
+  ESP_LOGI(TAG, "writing assets to slot %d", s_wr_slot);
+  return ESP_OK;
+}
+
+esp_err_t assets_write(const void *data, size_t len)
+{
+  if (s_wr_slot < 0) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  if (s_wr_len + len > s_slot_size) {
+    ESP_LOGE(TAG, "assets don't fit in a %u byte slot", s_slot_size);
+    return ESP_ERR_INVALID_SIZE;
+  }
+
+  size_t base = s_wr_slot * s_slot_size;
+
+  // erase just ahead of the data instead of the whole slot up front
+  while (s_wr_erased < s_wr_len + len) {
+    esp_err_t r = esp_partition_erase_range(s_part, base + s_wr_erased, ASSETS_SECTOR_SIZE);
+    if (r != ESP_OK) {
+      return r;
+    }
+    s_wr_erased += ASSETS_SECTOR_SIZE;
+  }
+
+  esp_err_t r = esp_partition_write(s_part, base + s_wr_len, data, len);
+  if (r != ESP_OK) {
+    return r;
+  }
+
+  mbedtls_md_update(&s_wr_md, data, len);
+  s_wr_len += len;
+  return ESP_OK;
+}
+
+void assets_write_abort(void)
+{
+  if (s_wr_slot >= 0) {
+    mbedtls_md_free(&s_wr_md);
+    s_wr_slot = -1;
+  }
+}
+
+// check what was received against the hash the server advertised and what
+// landed in flash against what was received, check the blob's structure,
+// then make the new slot the one mapped at the next boot
+esp_err_t assets_write_end(const char *expected_hash)
+{
+  uint8_t digest[32];
+  char sent[ASSETS_HASH_LEN];
+  char stored[ASSETS_HASH_LEN];
+  assets_hdr_t hdr;
+  esp_err_t r = ESP_ERR_INVALID_STATE;
+
+  if (s_wr_slot < 0) {
+    return r;
+  }
+
+  mbedtls_md_finish(&s_wr_md, digest);
+  mbedtls_md_free(&s_wr_md);
+  assets_hex(digest, sent);
+
+  if (expected_hash == NULL || strcmp(sent, expected_hash) != 0) {
+    ESP_LOGE(TAG, "received hash %s != advertised %s", sent, expected_hash ? expected_hash : "(none)");
+    r = ESP_ERR_INVALID_CRC;
+    goto exit;
+  }
+
+  if (!assets_slot_header(s_wr_slot, &hdr) || hdr.size != s_wr_len) {
+    ESP_LOGE(TAG, "downloaded assets are not a valid blob");
+    goto exit;
+  }
+
+  mbedtls_md_context_t md;
+  uint8_t buf[256];
+  size_t base = s_wr_slot * s_slot_size;
+
+  mbedtls_md_init(&md);
+  mbedtls_md_setup(&md, mbedtls_md_info_from_type(MBEDTLS_MD_SHA224), 0);
+  mbedtls_md_starts(&md);
+  for (size_t off = 0; off < s_wr_len; off += sizeof(buf)) {
+    size_t n = (s_wr_len - off < sizeof(buf)) ? s_wr_len - off : sizeof(buf);
+    esp_partition_read(s_part, base + off, buf, n);
+    mbedtls_md_update(&md, buf, n);
+  }
+  mbedtls_md_finish(&md, digest);
+  mbedtls_md_free(&md);
+  assets_hex(digest, stored);
+
+  if (strcmp(sent, stored) != 0) {
+    ESP_LOGE(TAG, "read back hash %s != received %s", stored, sent);
+    r = ESP_ERR_INVALID_CRC;
+    goto exit;
+  }
+
+  const uint8_t *blob;
+  spi_flash_mmap_handle_t mmap;
+  r = esp_partition_mmap(s_part, base, hdr.size, SPI_FLASH_MMAP_DATA, (const void **) &blob, &mmap);
+  if (r != ESP_OK) {
+    ESP_LOGE(TAG, "can't map new assets: %s", esp_err_to_name(r));
+    goto exit;
+  }
+  bool valid = assets_check_entries(blob);
+  spi_flash_munmap(mmap);
+  if (!valid) {
+    r = ESP_ERR_INVALID_STATE;
+    goto exit;
+  }
+
+  r = assets_nvs_set_slot(s_wr_slot);
+  if (r == ESP_OK) {
+    ESP_LOGW(TAG, "assets %s (%u bytes) in slot %d, active after restart", sent, s_wr_len, s_wr_slot);
+  }
+
+exit:
+  s_wr_slot = -1;
+  return r;
+}
@@ -0,0 +1,104 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+
+#ifndef _ASSETS_H
+#define _ASSETS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+//
+// Read-only UI assets (images today) kept in their own `assets` flash
+// partition instead of the app image, so an app OTA doesn't carry them.
+// The blob is built by tools/mkassets.py and mapped with
+// esp_partition_mmap(); entries are used in place, nothing is copied.
+//
+// The partition holds two slots.  Updates are written to the slot not in
+// use and take effect on the next boot, so the mapped slot never changes
+// under the display.
+//
+#define ASSETS_PARTITION_LABEL  "assets"
+#define ASSETS_PARTITION_SUBTYPE 0x40
+#define ASSETS_MAGIC            0x41544152    // "RATA"
+#define ASSETS_VERSION          1
+#define ASSETS_NAME_MAX         20
+#define ASSETS_HASH_LEN         (224 / 8 * 2 + 1)   // SHA-224 hex + NUL
+
+typedef enum {
+  ASSET_TYPE_RAW = 0,
+  ASSET_TYPE_IMG_RLE = 1,     // u16 row offsets into the pool entry
+} asset_type_t;
+
+#define ASSET_FLAG_ALPHA 0x01
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint32_t size;
+  uint32_t reserved;
+} assets_hdr_t;
+
+typedef struct {
+  char name[ASSETS_NAME_MAX];
+  uint8_t type;
+  uint8_t flags;
+  uint16_t w;
+  uint16_t h;
+  uint16_t pool;
+  uint32_t offset;
+  uint32_t size;
+} asset_entry_t;
+
+esp_err_t assets_init(void);
+bool assets_ready(void);
+
+int assets_count(void);
+const asset_entry_t *assets_entry(int index);
+const asset_entry_t *assets_find(const char *name);
+const void *assets_data(const asset_entry_t *e);
+
+esp_err_t assets_hash(char *hash);
+
+// update of the inactive slot, fed from a download
+esp_err_t assets_write_begin(void);
+esp_err_t assets_write(const void *data, size_t len);
+esp_err_t assets_write_end(const char *expected_hash);
+void assets_write_abort(void);
+
+#endif
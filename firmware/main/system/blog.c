@@ -0,0 +1,162 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "blog.h"
+
+typedef struct blog_ring {
+  uint32_t head;      // next index to reserve, only ever increases
+  uint32_t floor;     // entries below this were discarded by blog_clear()
+  blog_entry_t entries[BLOG_ENTRIES_PER_CORE];
+} blog_ring_t;
+
+static blog_ring_t s_rings[portNUM_PROCESSORS];
+
+void blog_write(const char *fmt, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+  // each core normally writes only its own ring; the index is still reserved
+  // atomically since a task can be preempted (or migrate) between reserve and commit
+  blog_ring_t *r = &s_rings[xPortGetCoreID()];
+  uint32_t idx = __atomic_fetch_add(&r->head, 1, __ATOMIC_RELAXED);
+  blog_entry_t *e = &r->entries[idx % BLOG_ENTRIES_PER_CORE];
+
+  __atomic_store_n(&e->seq, 0, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  e->fmt = fmt;
+  e->ts_us = esp_timer_get_time();
+  e->args[0] = a0;
+  e->args[1] = a1;
+  e->args[2] = a2;
+  e->args[3] = a3;
+
+  __atomic_store_n(&e->seq, idx + 1, __ATOMIC_RELEASE);
+}
+
+// Copy entry idx out of a ring.  Returns false if it was never committed or
+// was overwritten while being copied.
+static bool blog_read(blog_ring_t *r, uint32_t idx, blog_entry_t *out)
+{
+  blog_entry_t *e = &r->entries[idx % BLOG_ENTRIES_PER_CORE];
+
+  if (__atomic_load_n(&e->seq, __ATOMIC_ACQUIRE) != idx + 1) {
+    return false;
+  }
+  memcpy(out, e, sizeof(blog_entry_t));
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  return __atomic_load_n(&e->seq, __ATOMIC_RELAXED) == idx + 1;
+}
+
+static void blog_format(const blog_entry_t *e, int core, blog_sink_t sink, void *ctx)
+{
+  char line[160];
+
+  int n = snprintf(line, sizeof(line), "[%6lld.%03lld] %d: ", e->ts_us / 1000000, (e->ts_us / 1000) % 1000, core);
+  n += snprintf(line + n, sizeof(line) - n - 1, e->fmt, e->args[0], e->args[1], e->args[2], e->args[3]);
+  if (n > sizeof(line) - 2) {
+    n = sizeof(line) - 2;
+  }
+  line[n++] = '\n';
+  line[n] = '\0';
+
+  sink(line, ctx);
+}
+
+// Format entries from all cores oldest-first, merged by timestamp.  Writers are
+// not stopped; entries overwritten while the dump is in progress are skipped.
+// max_entries limits the number of most recent entries taken from each core (0 = all).
+int blog_dump(blog_sink_t sink, void *ctx, int max_entries)
+{
+  uint32_t cur[portNUM_PROCESSORS];
+  uint32_t end[portNUM_PROCESSORS];
+  int count = 0;
+
+  for (int c = 0; c < portNUM_PROCESSORS; c++) {
+    blog_ring_t *r = &s_rings[c];
+    uint32_t limit = BLOG_ENTRIES_PER_CORE;
+    if (max_entries > 0 && max_entries < limit) {
+      limit = max_entries;
+    }
+
+    end[c] = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+    cur[c] = end[c] > limit ? end[c] - limit : 0;
+    if (cur[c] < r->floor) {
+      cur[c] = r->floor;
+    }
+  }
+
+  for (;;) {
+    blog_entry_t best, e;
+    int best_core = -1;
+
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+      // skip anything the writer has lapped since we started
+      uint32_t head = __atomic_load_n(&s_rings[c].head, __ATOMIC_ACQUIRE);
+      if (head - cur[c] > BLOG_ENTRIES_PER_CORE) {
+        cur[c] = head - BLOG_ENTRIES_PER_CORE;
+      }
+
+      while (cur[c] < end[c] && !blog_read(&s_rings[c], cur[c], &e)) {
+        cur[c]++;
+      }
+      if (cur[c] < end[c] && (best_core < 0 || e.ts_us < best.ts_us)) {
+        best = e;
+        best_core = c;
+      }
+    }
+
+    if (best_core < 0) {
+      break;
+    }
+
+    blog_format(&best, best_core, sink, ctx);
+    cur[best_core]++;
+    count++;
+  }
+
+  return count;
+}
+
+void blog_clear(void)
+{
+  for (int c = 0; c < portNUM_PROCESSORS; c++) {
+    s_rings[c].floor = __atomic_load_n(&s_rings[c].head, __ATOMIC_ACQUIRE);
+  }
+}
@@ -0,0 +1,75 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+#ifndef _BLOG_H
+#define _BLOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+//
+// Binary ring-buffer log.
+//
+// BLOG() records the format string pointer, a timestamp and up to four 32-bit
+// arguments into a per-core RAM ring; no formatting or console I/O happens at
+// the call site.  Entries are formatted only when the log is dumped.
+//
+// The format string must be a literal and every argument must fit in 32 bits.
+// %s arguments must point at storage that outlives the log (string literals,
+// static tables), since only the pointer is recorded.
+//
+
+#define BLOG_ENTRIES_PER_CORE 128
+#define BLOG_MAX_ARGS 4
+
+typedef struct blog_entry {
+  volatile uint32_t seq;      // 0 while being written, index+1 once committed
+  const char *fmt;
+  int64_t ts_us;
+  uint32_t args[BLOG_MAX_ARGS];
+} blog_entry_t;
+
+// receives one formatted, newline-terminated line per entry
+typedef void (*blog_sink_t)(const char *line, void *ctx);
+
+void blog_write(const char *fmt, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+int blog_dump(blog_sink_t sink, void *ctx, int max_entries);
+void blog_clear(void);
+
+// pads the argument list out to BLOG_MAX_ARGS with zeros
+#define _BLOG_ARGS(_, a0, a1, a2, a3, ...) (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2), (uint32_t)(a3)
+#define BLOG(fmt, ...) blog_write(fmt, _BLOG_ARGS(_, ##__VA_ARGS__, 0, 0, 0, 0))
+
+#endif
@@ -0,0 +1,104 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+#include <stdio.h>
+#include <stdbool.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "boot_prof.h"
+
+static const char *TAG = "boot";
+
+static const char *s_stage_names[BOOT_NUM_STAGES] = {
+  "app_main",
+  "system",
+  "scan_path",
+  "display",
+  "acl",
+  "tasks",
+  "rfid_wait",
+  "scan_ready",
+  "net_up",
+  "first_scan",
+};
+
+static int64_t s_stage_us[BOOT_NUM_STAGES];
+
+void boot_mark(boot_stage_t stage)
+{
+  if (stage >= BOOT_NUM_STAGES) {
+    return;
+  }
+
+  int64_t zero = 0;
+  int64_t now = esp_timer_get_time();
+  if (__atomic_compare_exchange_n(&s_stage_us[stage], &zero, now, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+    ESP_LOGI(TAG, "%s at %lld ms", s_stage_names[stage], now / 1000);
+
+    if (stage == BOOT_STAGE_SCAN_READY) {
+      ESP_LOGI(TAG, "time to first scan: %lld ms", now / 1000);
+    } else if ((stage == BOOT_STAGE_RFID_WAIT || stage == BOOT_STAGE_ACL) &&
+               __atomic_load_n(&s_stage_us[BOOT_STAGE_RFID_WAIT], __ATOMIC_SEQ_CST) &&
+               __atomic_load_n(&s_stage_us[BOOT_STAGE_ACL], __ATOMIC_SEQ_CST)) {
+      // ready for scans once both the state machine and the ACL are up, in either order
+      boot_mark(BOOT_STAGE_SCAN_READY);
+    }
+  }
+}
+
+int64_t boot_stage_time(boot_stage_t stage)
+{
+  return stage < BOOT_NUM_STAGES ? s_stage_us[stage] : 0;
+}
+
+// {"app_main": 12, "system": 140, ...} in milliseconds; stages not yet reached are omitted
+int boot_stages_json(char *buf, size_t len)
+{
+  int n = snprintf(buf, len, "{");
+  bool first = true;
+
+  for (int i = 0; i < BOOT_NUM_STAGES && n < len; i++) {
+    if (s_stage_us[i] == 0) {
+      continue;
+    }
+    n += snprintf(buf + n, len - n, "%s\"%s\": %lld", first ? "" : ", ", s_stage_names[i], s_stage_us[i] / 1000);
+    first = false;
+  }
+
+  if (n < len) {
+    n += snprintf(buf + n, len - n, "}");
+  }
+  return n;
+}
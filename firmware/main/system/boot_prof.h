@@ -0,0 +1,65 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+#ifndef _BOOT_PROF_H
+#define _BOOT_PROF_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+//
+// Boot stage timestamps, in microseconds since the app started (esp_timer
+// time; ROM and second stage bootloader time are not included).  Each stage
+// is recorded once, the first time it is marked.
+//
+typedef enum {
+  BOOT_STAGE_APP_MAIN = 0,    // app_main entered
+  BOOT_STAGE_SYSTEM,          // NVS, config and FAT mounted
+  BOOT_STAGE_SCAN_PATH,       // RFID UART, door and beep tasks running
+  BOOT_STAGE_DISPLAY,         // SPI panel and LVGL initialized
+  BOOT_STAGE_ACL,             // stored ACL hash validated
+  BOOT_STAGE_TASKS,           // all tasks created
+  BOOT_STAGE_RFID_WAIT,       // state machine waiting for RFID
+  BOOT_STAGE_SCAN_READY,      // RFID_WAIT and ACL both reached; recorded by boot_mark()
+  BOOT_STAGE_NET_UP,          // got an IP address
+  BOOT_STAGE_FIRST_SCAN,      // first RFID scan decision
+  BOOT_NUM_STAGES
+} boot_stage_t;
+
+void boot_mark(boot_stage_t stage);
+int64_t boot_stage_time(boot_stage_t stage);
+int boot_stages_json(char *buf, size_t len);
+
+#endif
@@ -0,0 +1,237 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "perf.h"
+
+static const char *TAG = "perf";
+
+static perf_stat_t *s_stats[PERF_MAX_STATS];
+static int s_num_stats = 0;
+
+// protects the registry and sample windows; record is called from several tasks
+static portMUX_TYPE s_perf_mux = portMUX_INITIALIZER_UNLOCKED;
+
+perf_stat_t *perf_register(const char *name, const char *unit)
+{
+  perf_stat_t *s = perf_find(name);
+  if (s) {
+    return s;
+  }
+
+  if (s_num_stats >= PERF_MAX_STATS) {
+    ESP_LOGE(TAG, "too many perf stats, can't register %s", name);
+    return NULL;
+  }
+
+  s = calloc(1, sizeof(perf_stat_t));
+  if (s == NULL) {
+    ESP_LOGE(TAG, "can't malloc perf stat %s", name);
+    return NULL;
+  }
+  s->name = name;
+  s->unit = unit;
+  s->min = UINT32_MAX;
+
+  portENTER_CRITICAL(&s_perf_mux);
+  s_stats[s_num_stats++] = s;
+  portEXIT_CRITICAL(&s_perf_mux);
+
+  return s;
+}
+
+perf_stat_t *perf_find(const char *name)
+{
+  for (int i = 0; i < s_num_stats; i++) {
+    if (strcmp(s_stats[i]->name, name) == 0) {
+      return s_stats[i];
+    }
+  }
+  return NULL;
+}
+
+void perf_record(perf_stat_t *s, uint32_t value)
+{
+  if (s == NULL) {
+    return;
+  }
+
+  portENTER_CRITICAL(&s_perf_mux);
+  s->window[s->count % PERF_WINDOW] = value;
+  s->count++;
+  s->sum += value;
+  if (value < s->min) s->min = value;
+  if (value > s->max) s->max = value;
+  portEXIT_CRITICAL(&s_perf_mux);
+}
+
+void perf_reset(perf_stat_t *s)
+{
+  portENTER_CRITICAL(&s_perf_mux);
+  s->count = 0;
+  s->sum = 0;
+  s->min = UINT32_MAX;
+  s->max = 0;
+  portEXIT_CRITICAL(&s_perf_mux);
+}
+
+void perf_reset_all(void)
+{
+  for (int i = 0; i < s_num_stats; i++) {
+    perf_reset(s_stats[i]);
+  }
+}
+
+static int perf_cmp(const void *a, const void *b)
+{
+  uint32_t x = *(const uint32_t *)a;
+  uint32_t y = *(const uint32_t *)b;
+  return (x > y) - (x < y);
+}
+
+// percentiles are computed over the most recent PERF_WINDOW samples
+void perf_summarize(perf_stat_t *s, perf_summary_t *sum)
+{
+  uint32_t sorted[PERF_WINDOW];
+
+  memset(sum, 0, sizeof(perf_summary_t));
+
+  portENTER_CRITICAL(&s_perf_mux);
+  uint32_t n = s->count < PERF_WINDOW ? s->count : PERF_WINDOW;
+  memcpy(sorted, s->window, n * sizeof(uint32_t));
+  sum->count = s->count;
+  sum->min = s->count ? s->min : 0;
+  sum->max = s->max;
+  sum->avg = s->count ? (uint32_t)(s->sum / s->count) : 0;
+  portEXIT_CRITICAL(&s_perf_mux);
+
+  if (n == 0) {
+    return;
+  }
+
+  qsort(sorted, n, sizeof(uint32_t), perf_cmp);
+  sum->p50 = sorted[(n * 50) / 100];
+  sum->p90 = sorted[(n * 90) / 100];
+  sum->p99 = sorted[(n * 99) / 100];
+}
+
+void perf_report(const char *label)
+{
+  perf_summary_t sum;
+
+  printf("\n%-24s %8s %8s %8s %8s %8s %8s %8s  [%s]\n", "stat", "count", "min", "avg", "p50", "p90", "p99", "max", label ? label : "");
+  for (int i = 0; i < s_num_stats; i++) {
+    perf_summarize(s_stats[i], &sum);
+    printf("%-24s %8u %8u %8u %8u %8u %8u %8u  %s\n", s_stats[i]->name,
+           sum.count, sum.min, sum.avg, sum.p50, sum.p90, sum.p99, sum.max, s_stats[i]->unit);
+  }
+}
+
+#if (configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1)
+static int perf_cpu_snapshot(TaskStatus_t *tasks, uint32_t *total)
+{
+  return uxTaskGetSystemState(tasks, PERF_CPU_MAX_TASKS, total);
+}
+
+static uint32_t perf_cpu_runtime(const TaskStatus_t *tasks, int n, TaskHandle_t h)
+{
+  for (int i = 0; i < n; i++) {
+    if (tasks[i].xHandle == h) {
+      return tasks[i].ulRunTimeCounter;
+    }
+  }
+  return 0;
+}
+
+//
+// Sample FreeRTOS run time counters over `ms` and print per-task CPU use
+// plus idle percentage per core.  The run time clock is esp_timer (us), so
+// each core has `elapsed` us available.
+//
+int perf_cpu_sample(int ms)
+{
+  TaskStatus_t *before = calloc(PERF_CPU_MAX_TASKS, sizeof(TaskStatus_t));
+  TaskStatus_t *after = calloc(PERF_CPU_MAX_TASKS, sizeof(TaskStatus_t));
+  uint32_t total;
+
+  if (!before || !after) {
+    free(before);
+    free(after);
+    return -1;
+  }
+
+  int64_t t0 = esp_timer_get_time();
+  int n0 = perf_cpu_snapshot(before, &total);
+  vTaskDelay(ms / portTICK_PERIOD_MS);
+  int n1 = perf_cpu_snapshot(after, &total);
+  uint32_t elapsed = (uint32_t) (esp_timer_get_time() - t0);
+
+  if (n0 == 0 || n1 == 0 || elapsed == 0) {
+    free(before);
+    free(after);
+    return -1;
+  }
+
+  printf("\n%-16s %10s %7s\n", "task", "us", "cpu%");
+  for (int i = 0; i < n1; i++) {
+    uint32_t run = after[i].ulRunTimeCounter - perf_cpu_runtime(before, n0, after[i].xHandle);
+    printf("%-16s %10u %6u.%u\n", after[i].pcTaskName, run,
+           (unsigned) ((uint64_t) run * 100 / elapsed), (unsigned) ((uint64_t) run * 1000 / elapsed % 10));
+  }
+
+  for (int core = 0; core < portNUM_PROCESSORS; core++) {
+    TaskHandle_t idle = xTaskGetIdleTaskHandleForCPU(core);
+    uint32_t run = perf_cpu_runtime(after, n1, idle) - perf_cpu_runtime(before, n0, idle);
+    printf("core %d idle: %u.%u%%\n", core,
+           (unsigned) ((uint64_t) run * 100 / elapsed), (unsigned) ((uint64_t) run * 1000 / elapsed % 10));
+  }
+
+  free(before);
+  free(after);
+  return 0;
+}
+#else
+int perf_cpu_sample(int ms)
+{
+  ESP_LOGW(TAG, "FreeRTOS run time stats are not enabled");
+  return -1;
+}
+#endif
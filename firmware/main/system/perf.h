@@ -0,0 +1,82 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+#ifndef _PERF_H
+#define _PERF_H
+
+#include <stdint.h>
+
+//
+// Small registry of latency/duration statistics.  Each stat keeps a
+// fixed window of the most recent samples for percentile reporting plus
+// running min/max/count since the last reset.
+//
+
+#define PERF_MAX_STATS 32
+#define PERF_WINDOW 128
+
+typedef struct perf_stat {
+  const char *name;
+  const char *unit;
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t sum;
+  uint32_t window[PERF_WINDOW];
+} perf_stat_t;
+
+typedef struct perf_summary {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint32_t avg;
+  uint32_t p50;
+  uint32_t p90;
+  uint32_t p99;
+} perf_summary_t;
+
+perf_stat_t *perf_register(const char *name, const char *unit);
+perf_stat_t *perf_find(const char *name);
+void perf_record(perf_stat_t *s, uint32_t value);
+void perf_reset(perf_stat_t *s);
+void perf_reset_all(void);
+void perf_summarize(perf_stat_t *s, perf_summary_t *sum);
+void perf_report(const char *label);
+
+#define PERF_CPU_MAX_TASKS 24
+
+int perf_cpu_sample(int ms);
+
+#endif
@@ -0,0 +1,286 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_pm.h"
+#include "system.h"
+#include "pm_ctl.h"
+
+static const char *TAG = "pm_ctl";
+
+static const uint32_t s_class_ua[] = { BATT_AWAKE_UA, PM_IDLE_UA, BATT_LIGHT_SLEEP_UA };
+static const char *s_class_names[] = { "active", "idle", "sleep" };
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static int s_state = -1;
+static pm_class_t s_class = PM_CLASS_ACTIVE;
+static int64_t s_enter_us;
+static int64_t s_res_us[PM_CTL_MAX_STATES];
+static const char *s_names[PM_CTL_MAX_STATES];
+static pm_class_t s_classes[PM_CTL_MAX_STATES];
+
+static int s_busy_depth;
+static int64_t s_busy_start_us;
+static int64_t s_busy_idle_us;      // time at full speed while in an idle state
+
+#ifdef CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t s_state_lock;
+static esp_pm_lock_handle_t s_busy_lock;
+static esp_pm_lock_handle_t s_awake_lock;
+static esp_timer_handle_t s_awake_timer;
+static bool s_state_held;
+static bool s_awake_held;
+
+static void pm_ctl_awake_expired(void *arg)
+{
+  portENTER_CRITICAL(&s_lock);
+  bool release = s_awake_held;
+  s_awake_held = false;
+  portEXIT_CRITICAL(&s_lock);
+
+  if (release) {
+    esp_pm_lock_release(s_awake_lock);
+  }
+}
+#endif
+
+
+void pm_ctl_init(void)
+{
+  s_enter_us = esp_timer_get_time();
+
+#ifdef CONFIG_PM_ENABLE
+  esp_pm_config_esp32_t cfg = {
+    .max_freq_mhz = CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ,
+    .min_freq_mhz = PM_MIN_FREQ_MHZ,
+    .light_sleep_enable = true,
+  };
+
+  esp_err_t err = esp_pm_configure(&cfg);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "esp_pm_configure failed: %s, staying at full speed", esp_err_to_name(err));
+    return;
+  }
+
+  const esp_timer_create_args_t timer_args = {
+    .callback = pm_ctl_awake_expired,
+    .name = "pm_awake",
+  };
+
+  if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "state", &s_state_lock) != ESP_OK ||
+      esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "busy", &s_busy_lock) != ESP_OK ||
+      esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "rfid_rx", &s_awake_lock) != ESP_OK ||
+      esp_timer_create(&timer_args, &s_awake_timer) != ESP_OK) {
+    ESP_LOGE(TAG, "could not create PM locks");
+    return;
+  }
+
+  // boot runs at full speed until the state machine first goes idle
+  esp_pm_lock_acquire(s_state_lock);
+  s_state_held = true;
+
+  ESP_LOGI(TAG, "%d-%d MHz, automatic light sleep when idle", PM_MIN_FREQ_MHZ, CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ);
+#endif
+}
+
+// called by the main task only
+void pm_ctl_state(int state, const char *name, pm_class_t cls)
+{
+  int64_t now = esp_timer_get_time();
+
+  portENTER_CRITICAL(&s_lock);
+  if (s_state >= 0 && s_state < PM_CTL_MAX_STATES) {
+    s_res_us[s_state] += now - s_enter_us;
+  }
+  if (s_busy_depth) {
+    if (s_class == PM_CLASS_IDLE) {
+      s_busy_idle_us += now - s_busy_start_us;
+    }
+    s_busy_start_us = now;
+  }
+  if (state >= 0 && state < PM_CTL_MAX_STATES) {
+    s_names[state] = name;
+    s_classes[state] = cls;
+  }
+  s_state = state;
+  s_class = cls;
+  s_enter_us = now;
+  portEXIT_CRITICAL(&s_lock);
+
+#ifdef CONFIG_PM_ENABLE
+  bool want = (cls == PM_CLASS_ACTIVE);
+  if (s_state_lock && want != s_state_held) {
+    if (want) {
+      esp_pm_lock_acquire(s_state_lock);
+    } else {
+      esp_pm_lock_release(s_state_lock);
+    }
+    s_state_held = want;
+  }
+#endif
+}
+
+void pm_busy_begin(void)
+{
+  int64_t now = esp_timer_get_time();
+
+  portENTER_CRITICAL(&s_lock);
+  if (s_busy_depth++ == 0) {
+    s_busy_start_us = now;
+  }
+  portEXIT_CRITICAL(&s_lock);
+
+#ifdef CONFIG_PM_ENABLE
+  if (s_busy_lock) {
+    esp_pm_lock_acquire(s_busy_lock);
+  }
+#endif
+}
+
+void pm_busy_end(void)
+{
+#ifdef CONFIG_PM_ENABLE
+  if (s_busy_lock) {
+    esp_pm_lock_release(s_busy_lock);
+  }
+#endif
+
+  int64_t now = esp_timer_get_time();
+
+  portENTER_CRITICAL(&s_lock);
+  if (s_busy_depth && --s_busy_depth == 0 && s_class == PM_CLASS_IDLE) {
+    s_busy_idle_us += now - s_busy_start_us;
+  }
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void pm_ctl_hold_awake(uint32_t ms)
+{
+#ifdef CONFIG_PM_ENABLE
+  if (!s_awake_lock) {
+    return;
+  }
+
+  portENTER_CRITICAL(&s_lock);
+  bool acquire = !s_awake_held;
+  s_awake_held = true;
+  portEXIT_CRITICAL(&s_lock);
+
+  if (acquire) {
+    esp_pm_lock_acquire(s_awake_lock);
+  }
+  esp_timer_stop(s_awake_timer);
+  esp_timer_start_once(s_awake_timer, ms * 1000ULL);
+#endif
+}
+
+// residency in ms per state, including the current one, and the time
+// weighted current estimate; returns the total time covered
+static uint64_t pm_ctl_snapshot(uint32_t *res_ms, uint64_t *avg_ua)
+{
+  int64_t now = esp_timer_get_time();
+  uint64_t total = 0, charge = 0;
+
+  portENTER_CRITICAL(&s_lock);
+  for (int i = 0; i < PM_CTL_MAX_STATES; i++) {
+    int64_t us = s_res_us[i];
+    if (i == s_state) {
+      us += now - s_enter_us;
+    }
+    res_ms[i] = us / 1000;
+  }
+  int64_t busy_idle_us = s_busy_idle_us;
+  if (s_busy_depth && s_class == PM_CLASS_IDLE) {
+    busy_idle_us += now - s_busy_start_us;
+  }
+  portEXIT_CRITICAL(&s_lock);
+
+  for (int i = 0; i < PM_CTL_MAX_STATES; i++) {
+    total += res_ms[i];
+    charge += (uint64_t) res_ms[i] * s_class_ua[s_classes[i]];
+  }
+  // busy sections inside idle states ran at full speed
+  charge += (uint64_t) (busy_idle_us / 1000) * (BATT_AWAKE_UA - PM_IDLE_UA);
+
+  *avg_ua = total ? charge / total : 0;
+  return total;
+}
+
+int pm_ctl_json(char *buf, size_t len)
+{
+  uint32_t res_ms[PM_CTL_MAX_STATES];
+  uint64_t avg_ua;
+  uint64_t total = pm_ctl_snapshot(res_ms, &avg_ua);
+  uint32_t hours = avg_ua ? (uint64_t) BATT_CAPACITY_MAH * 1000 / avg_ua : 0;
+
+  int n = snprintf(buf, len, "{\"period_s\": %u, \"avg_ua\": %u, \"batt_hours\": %u, \"residency_ms\": {",
+                   (uint32_t) (total / 1000), (uint32_t) avg_ua, hours);
+
+  bool first = true;
+  for (int i = 0; i < PM_CTL_MAX_STATES && n < (int) len; i++) {
+    if (s_names[i] && res_ms[i]) {
+      n += snprintf(buf + n, len - n, "%s\"%s\": %u", first ? "" : ", ", s_names[i], res_ms[i]);
+      first = false;
+    }
+  }
+  if (n < (int) len) {
+    n += snprintf(buf + n, len - n, "}}");
+  }
+  return n;
+}
+
+void pm_ctl_report(void)
+{
+  uint32_t res_ms[PM_CTL_MAX_STATES];
+  uint64_t avg_ua;
+  uint64_t total = pm_ctl_snapshot(res_ms, &avg_ua);
+
+  printf("%-24s %-7s %10s %6s\n", "state", "class", "ms", "%");
+  for (int i = 0; i < PM_CTL_MAX_STATES; i++) {
+    if (s_names[i] && res_ms[i]) {
+      printf("%-24s %-7s %10u %5.1f%%\n", s_names[i], s_class_names[s_classes[i]], res_ms[i],
+             total ? res_ms[i] * 100.0 / total : 0.0);
+    }
+  }
+  printf("average draw %u uA over %u s, %u h on a %u mAh battery\n", (uint32_t) avg_ua,
+         (uint32_t) (total / 1000), avg_ua ? (uint32_t) ((uint64_t) BATT_CAPACITY_MAH * 1000 / avg_ua) : 0,
+         BATT_CAPACITY_MAH);
+}
@@ -0,0 +1,79 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+
+#ifndef _PM_CTL_H
+#define _PM_CTL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//
+// Dynamic frequency scaling and automatic light sleep (CONFIG_PM_ENABLE).
+// The main state machine reports each state change with the power class
+// of the new state: while idle waiting for a scan no lock is held, so the
+// CPU drops to PM_MIN_FREQ_MHZ and light sleeps between ticks; any other
+// state holds the CPU at full speed.  Short CPU bound sections (TLS
+// handshakes, hashing, ACL lookup, LVGL rendering) take a busy lock around
+// themselves.  The reader's RX line is a level wakeup source while idle
+// (rfid_task.c); after it wakes the chip, pm_ctl_hold_awake() keeps light
+// sleep off until the reader's repeated frame is in.  Without
+// CONFIG_PM_ENABLE the locks are no-ops and only the per-state residency
+// is tracked.
+//
+
+typedef enum {
+  PM_CLASS_ACTIVE = 0,        // full speed
+  PM_CLASS_IDLE,              // low speed, automatic light sleep
+  PM_CLASS_SLEEP,             // explicit light sleep (system_sleep)
+} pm_class_t;
+
+#define PM_CTL_MAX_STATES 24
+
+void pm_ctl_init(void);
+void pm_ctl_state(int state, const char *name, pm_class_t cls);
+
+// nestable, from any task
+void pm_busy_begin(void);
+void pm_busy_end(void);
+
+// keep light sleep off for a while without raising the clock
+void pm_ctl_hold_awake(uint32_t ms);
+
+int pm_ctl_json(char *buf, size_t len);
+void pm_ctl_report(void);
+
+#endif
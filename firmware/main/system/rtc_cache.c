@@ -0,0 +1,285 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "esp_system.h"
+#include "system.h"
+#include "rtc_cache.h"
+
+static const char *TAG = "rtc_cache";
+
+typedef struct {
+  uint32_t tag;               // 0 = free slot
+  uint32_t used;              // s_rtc.seq when last scanned, for LRU
+  uint8_t allowed;
+  char name[FIELD_SIZE];
+} rtc_cache_entry_t;
+
+typedef struct {
+  uint32_t acl_gen;           // first 32 bits of the ACL hash the entries came from
+  uint32_t seq;
+  rtc_cache_entry_t entries[RTC_CACHE_ENTRIES];
+
+  uint32_t ev_pending;        // MQTT events queued and not yet published
+  uint32_t ev_lost;           // dropped on queue overflow or by deep sleep
+
+  uint32_t deep_wakes;
+  uint32_t cache_grants;      // scans answered from here before the ACL was back
+  time_t sleep_start;
+  uint32_t slept_s;           // total time in deep sleep
+
+  uint32_t light_wake_ms;     // last wake-to-decision times
+  uint32_t deep_wake_ms;
+  uint32_t deep_wake_max_ms;
+} rtc_state_t;
+
+static RTC_DATA_ATTR rtc_state_t s_rtc;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool s_deep_wake;
+
+
+void rtc_cache_init(void)
+{
+  if (esp_reset_reason() != ESP_RST_DEEPSLEEP) {
+    return;
+  }
+
+  s_deep_wake = true;
+  s_rtc.deep_wakes++;
+
+  time_t now;
+  time(&now);
+  if (s_rtc.sleep_start && now > s_rtc.sleep_start) {
+    s_rtc.slept_s += now - s_rtc.sleep_start;
+  }
+  s_rtc.sleep_start = 0;
+
+  // the offline MQTT queue went down with DRAM
+  s_rtc.ev_lost += s_rtc.ev_pending;
+  s_rtc.ev_pending = 0;
+
+  int n = 0;
+  for (int i = 0; i < RTC_CACHE_ENTRIES; i++) {
+    n += s_rtc.entries[i].tag != 0;
+  }
+
+  ESP_LOGI(TAG, "deep sleep wake #%u (cause %d), %d cached tags, acl gen %08x, %u events lost",
+           s_rtc.deep_wakes, esp_sleep_get_wakeup_cause(), n, s_rtc.acl_gen, s_rtc.ev_lost);
+}
+
+bool rtc_cache_deep_wake(void)
+{
+  return s_deep_wake;
+}
+
+static rtc_cache_entry_t *rtc_cache_find(uint32_t tag)
+{
+  for (int i = 0; i < RTC_CACHE_ENTRIES; i++) {
+    if (s_rtc.entries[i].tag == tag) {
+      return &s_rtc.entries[i];
+    }
+  }
+  return NULL;
+}
+
+// only grants are answered from the cache; anything else falls through to the full ACL
+bool rtc_cache_lookup(uint32_t tag, member_record_t *member)
+{
+  bool hit = false;
+
+  portENTER_CRITICAL(&s_lock);
+  rtc_cache_entry_t *e = rtc_cache_find(tag);
+  if (e && e->allowed && s_rtc.acl_gen) {
+    strncpy(member->name, e->name, FIELD_SIZE);
+    member->allowed = 1;
+    e->used = ++s_rtc.seq;
+    s_rtc.cache_grants++;
+    hit = true;
+  }
+  portEXIT_CRITICAL(&s_lock);
+
+  return hit;
+}
+
+void rtc_cache_store(uint32_t tag, const member_record_t *member, bool found, uint32_t acl_gen)
+{
+  portENTER_CRITICAL(&s_lock);
+  rtc_cache_entry_t *e = rtc_cache_find(tag);
+
+  if (!found) {
+    if (e) {
+      e->tag = 0;
+    }
+  } else if (s_rtc.acl_gen && acl_gen == s_rtc.acl_gen) {
+    if (e == NULL) {
+      e = &s_rtc.entries[0];
+      for (int i = 1; i < RTC_CACHE_ENTRIES && e->tag; i++) {
+        if (s_rtc.entries[i].tag == 0 || s_rtc.entries[i].used < e->used) {
+          e = &s_rtc.entries[i];
+        }
+      }
+    }
+
+    e->tag = tag;
+    e->used = ++s_rtc.seq;
+    e->allowed = member->allowed;
+    strncpy(e->name, member->name, FIELD_SIZE);
+    e->name[FIELD_SIZE - 1] = '\0';
+  }
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void rtc_cache_set_acl_gen(const char *hash)
+{
+  uint32_t gen = 0;
+  if (hash) {
+    char head[9];
+    strncpy(head, hash, 8);
+    head[8] = '\0';
+    gen = strtoul(head, NULL, 16);
+  }
+
+  portENTER_CRITICAL(&s_lock);
+  bool changed = gen != s_rtc.acl_gen;
+  if (changed) {
+    memset(s_rtc.entries, 0, sizeof(s_rtc.entries));
+    s_rtc.acl_gen = gen;
+  }
+  portEXIT_CRITICAL(&s_lock);
+
+  if (changed) {
+    ESP_LOGI(TAG, "ACL generation now %08x, cache cleared", gen);
+  }
+}
+
+uint32_t rtc_cache_acl_gen(void)
+{
+  portENTER_CRITICAL(&s_lock);
+  uint32_t gen = s_rtc.acl_gen;
+  portEXIT_CRITICAL(&s_lock);
+  return gen;
+}
+
+void rtc_cache_event_queued(void)
+{
+  portENTER_CRITICAL(&s_lock);
+  s_rtc.ev_pending++;
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void rtc_cache_event_sent(void)
+{
+  portENTER_CRITICAL(&s_lock);
+  if (s_rtc.ev_pending) {
+    s_rtc.ev_pending--;
+  }
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void rtc_cache_event_dropped(void)
+{
+  portENTER_CRITICAL(&s_lock);
+  if (s_rtc.ev_pending) {
+    s_rtc.ev_pending--;
+  }
+  s_rtc.ev_lost++;
+  portEXIT_CRITICAL(&s_lock);
+}
+
+void rtc_cache_get_events(uint32_t *pending, uint32_t *lost)
+{
+  portENTER_CRITICAL(&s_lock);
+  *pending = s_rtc.ev_pending;
+  *lost = s_rtc.ev_lost;
+  portEXIT_CRITICAL(&s_lock);
+}
+
+// esp_timer starts with the app, so a deep wake figure leaves out the ROM
+// and bootloader time (see boot_prof.h)
+void rtc_cache_wake_latency(bool deep, uint32_t ms)
+{
+  if (deep) {
+    s_rtc.deep_wake_ms = ms;
+    if (ms > s_rtc.deep_wake_max_ms) {
+      s_rtc.deep_wake_max_ms = ms;
+    }
+  } else {
+    s_rtc.light_wake_ms = ms;
+  }
+}
+
+void rtc_cache_deep_sleep(void)
+{
+  time(&s_rtc.sleep_start);
+  ESP_LOGI(TAG, "entering deep sleep with %u MQTT events unsent", s_rtc.ev_pending);
+}
+
+static void rtc_cache_print_runtime(const char *mode, uint32_t ua)
+{
+  uint32_t hours = (uint32_t)((uint64_t)BATT_CAPACITY_MAH * 1000 / ua);
+  printf("  %-12s %6u uA  %5u h (%u days)\n", mode, ua, hours, hours / 24);
+}
+
+void rtc_cache_report(void)
+{
+  int n = 0, allowed = 0;
+  for (int i = 0; i < RTC_CACHE_ENTRIES; i++) {
+    if (s_rtc.entries[i].tag) {
+      n++;
+      allowed += s_rtc.entries[i].allowed;
+    }
+  }
+
+  printf("hot tag cache: %d/%d entries (%d allowed), acl gen %08x, %u grants served\n",
+         n, RTC_CACHE_ENTRIES, allowed, s_rtc.acl_gen, s_rtc.cache_grants);
+  printf("events: %u pending, %u lost\n", s_rtc.ev_pending, s_rtc.ev_lost);
+  printf("deep sleep: %u wakes, %u s asleep\n", s_rtc.deep_wakes, s_rtc.slept_s);
+  printf("wake to decision: light %u ms, deep %u ms (max %u ms, app time only)\n",
+         s_rtc.light_wake_ms, s_rtc.deep_wake_ms, s_rtc.deep_wake_max_ms);
+
+  printf("estimated runtime on a %u mAh battery:\n", BATT_CAPACITY_MAH);
+  rtc_cache_print_runtime("awake", BATT_AWAKE_UA);
+  rtc_cache_print_runtime("light sleep", BATT_LIGHT_SLEEP_UA);
+  rtc_cache_print_runtime("deep sleep", BATT_DEEP_SLEEP_UA);
+}
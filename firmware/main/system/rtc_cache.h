@@ -0,0 +1,83 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+
+#ifndef _RTC_CACHE_H
+#define _RTC_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "rfid_task.h"
+
+//
+// State kept in RTC slow memory across deep sleep.  The bootloader reloads
+// RTC data on any other reset, so after a power-on or software reset this
+// all starts out empty.
+//
+// - a small cache of recent scan decisions, so a member who was let in
+//   before the device went to sleep is let in again straight after a deep
+//   sleep wake, before the stored ACL has been re-validated or the network
+//   is back.  It is tied to the ACL generation it was filled from and
+//   emptied whenever the ACL changes.
+// - counters for MQTT events queued while offline; the queue itself is in
+//   DRAM so whatever is still pending at deep sleep is lost and reported.
+// - wake-to-decision times for light and deep sleep wakes.
+//
+
+#define RTC_CACHE_ENTRIES 16
+
+void rtc_cache_init(void);
+bool rtc_cache_deep_wake(void);
+
+bool rtc_cache_lookup(uint32_t tag, member_record_t *member);
+// acl_gen is rtc_cache_acl_gen() read under g_acl_mutex with the lookup that
+// made the decision; grants from an older ACL are not cached
+void rtc_cache_store(uint32_t tag, const member_record_t *member, bool found, uint32_t acl_gen);
+// hash is the stored ACL's hex digest; NULL when there is no valid ACL.
+// MUST hold g_acl_mutex, so a lookup under it sees a stable generation.
+void rtc_cache_set_acl_gen(const char *hash);
+uint32_t rtc_cache_acl_gen(void);
+
+void rtc_cache_event_queued(void);
+void rtc_cache_event_sent(void);
+void rtc_cache_event_dropped(void);
+void rtc_cache_get_events(uint32_t *pending, uint32_t *lost);
+
+void rtc_cache_wake_latency(bool deep, uint32_t ms);
+void rtc_cache_deep_sleep(void);
+void rtc_cache_report(void);
+
+#endif
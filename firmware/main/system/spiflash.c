@@ -37,21 +37,73 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include "esp_vfs.h"
 #include "esp_vfs_fat.h"
 #include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#ifdef CONFIG_RATT_CONFIG_LITTLEFS
+#include "esp_littlefs.h"
+#endif
+#include "spiflash.h"
 
 static const char *TAG = "spiflash";
 
 // Handles of the wear levelling library instance
 static wl_handle_t s_config_wl_handle = WL_INVALID_HANDLE;
 
+static int64_t s_mount_us = 0;
+
 // Mount paths for the partitions
 const char *config_path = "/config";
 
 // Flash partition names, from partitions.csv
 const char *config_partition = "config";
 
+#ifdef CONFIG_RATT_CONFIG_LITTLEFS
+//
+// LittleFS manages its own wear levelling and is copy-on-write: a file
+// isn't visible to readers until it's closed, and rename() replaces an
+// existing file in one metadata commit, so a power cut leaves either the
+// old file or the new one, never a mix.
+//
+static esp_err_t spiflash_mount(const char* partition, const char* path, wl_handle_t* handle)
+{
+  const esp_vfs_littlefs_conf_t conf = {
+          .base_path = path,
+          .partition_label = partition,
+          .format_if_mount_failed = true,
+  };
+  int64_t t0 = esp_timer_get_time();
+  esp_err_t err = esp_vfs_littlefs_register(&conf);
+  s_mount_us = esp_timer_get_time() - t0;
+
+  if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Failed to mount littlefs partition %s (%s)", partition, esp_err_to_name(err));
+      return err;
+  }
+  ESP_LOGI(TAG, "Mounted littlefs partition '%s' to '%s' in %lld ms", partition, path, s_mount_us / 1000);
+
+  return ESP_OK;
+}
+
+static esp_err_t spiflash_unmount(const char* partition, const char* path, wl_handle_t* handle)
+{
+  ESP_LOGI(TAG, "Unmounting littlefs partition %s...", partition);
+  esp_err_t err = esp_vfs_littlefs_unregister(partition);
+
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to unmount littlefs partition %s (%s)", partition, esp_err_to_name(err));
+    return err;
+  }
+  ESP_LOGI(TAG, "Unmounted littlefs partition '%s'.", partition);
+  return ESP_OK;
+}
+#else
 static esp_err_t spiflash_mount(const char* partition, const char* path, wl_handle_t* handle)
 {
   // To mount device we need name of device partition, define base_path
@@ -61,23 +113,19 @@ static esp_err_t spiflash_mount(const char* partition, const char* path, wl_hand
           .format_if_mount_failed = true,
           .allocation_unit_size = CONFIG_WL_SECTOR_SIZE
   };
+  int64_t t0 = esp_timer_get_time();
   esp_err_t err = esp_vfs_fat_spiflash_mount(path, partition, &mount_config, handle);
+  s_mount_us = esp_timer_get_time() - t0;
+
   if (err != ESP_OK) {
       ESP_LOGE(TAG, "Failed to mount spiflash partition %s (%s)", partition, esp_err_to_name(err));
       return err;
   }
-  ESP_LOGI(TAG, "Mounted spiflash partition '%s' to '%s'", partition, path);
+  ESP_LOGI(TAG, "Mounted spiflash partition '%s' to '%s' in %lld ms", partition, path, s_mount_us / 1000);
 
   return ESP_OK;
 }
 
-esp_err_t spiflash_init(void)
-{
-    ESP_LOGI(TAG, "Mounting SPI Flash FAT filesystems...");
-
-    return spiflash_mount(config_partition, config_path, &s_config_wl_handle);
-}
-
 
 static esp_err_t spiflash_unmount(const char* partition, const char* path, wl_handle_t* handle)
 {
@@ -91,8 +139,95 @@ static esp_err_t spiflash_unmount(const char* partition, const char* path, wl_ha
   ESP_LOGI(TAG, "Unmounted spiflash partition '%s'.", partition);
   return ESP_OK;
 }
+#endif
+
+esp_err_t spiflash_init(void)
+{
+    ESP_LOGI(TAG, "Mounting SPI Flash %s filesystems...", SPIFLASH_FS_NAME);
+
+    return spiflash_mount(config_partition, config_path, &s_config_wl_handle);
+}
 
 esp_err_t spiflash_deinit(void)
 {
   return spiflash_unmount(config_partition, config_path, &s_config_wl_handle);
 }
+
+//
+// Move `from` over `to`.  On LittleFS this is a single atomic rename; FAT
+// can't rename over an existing file, so there `to` is unlinked first and
+// a power cut in between leaves only `from` (acl_validate() finishes the
+// ACL install from there).
+//
+esp_err_t spiflash_replace(const char *from, const char *to)
+{
+#ifndef CONFIG_RATT_CONFIG_LITTLEFS
+  struct stat st;
+  if (stat(to, &st) == 0 && unlink(to) != 0) {
+    ESP_LOGE(TAG, "Could not delete %s", to);
+    return ESP_FAIL;
+  }
+#endif
+
+  if (rename(from, to) != 0) {
+    ESP_LOGE(TAG, "Could not rename %s -> %s", from, to);
+    return ESP_FAIL;
+  }
+  return ESP_OK;
+}
+
+//
+// Rough numbers for the config filesystem: mount time (from boot), small
+// reads like the ACL hash check does, and appending small records.
+// Uses a scratch file next to the ACL.
+//
+void spiflash_bench(int n)
+{
+  char path[32];
+  char buf[64];
+  int64_t t0, t_read, t_append, t_sync;
+
+  snprintf(path, sizeof(path), "%s/bench.tmp", config_path);
+  memset(buf, 'x', sizeof(buf));
+
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC);
+  if (fd < 0) {
+    printf("can't create %s\n", path);
+    return;
+  }
+
+  t0 = esp_timer_get_time();
+  for (int i = 0; i < n; i++) {
+    if (write(fd, buf, sizeof(buf)) != sizeof(buf)) {
+      printf("write failed after %d records\n", i);
+      break;
+    }
+  }
+  t_append = esp_timer_get_time() - t0;
+  t0 = esp_timer_get_time();
+  fsync(fd);
+  close(fd);
+  t_sync = esp_timer_get_time() - t0;
+
+  // open, read one small record at a spread of offsets, close
+  t0 = esp_timer_get_time();
+  for (int i = 0; i < n; i++) {
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+      break;
+    }
+    lseek(fd, (i * 997 % n) * sizeof(buf), SEEK_SET);
+    read(fd, buf, sizeof(buf));
+    close(fd);
+  }
+  t_read = esp_timer_get_time() - t0;
+
+  unlink(path);
+
+  uint32_t bytes = n * sizeof(buf);
+  printf("\n%s on '%s':\n", SPIFLASH_FS_NAME, config_partition);
+  printf("  mount:        %lld ms (at boot)\n", s_mount_us / 1000);
+  printf("  small read:   %lld us per open/seek/read %u/close (%d runs)\n", t_read / n, sizeof(buf), n);
+  printf("  append:       %u bytes in %lld ms (%lld KB/s), fsync %lld ms\n", bytes, t_append / 1000,
+         t_append ? (int64_t) bytes * 1000000 / 1024 / t_append : 0, t_sync / 1000);
+}
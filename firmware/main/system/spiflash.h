@@ -37,8 +37,19 @@
 #ifndef _SPIFLASH_H
 #define _SPIFLASH_H
 
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef CONFIG_RATT_CONFIG_LITTLEFS
+#define SPIFLASH_FS_NAME "LittleFS"
+#else
+#define SPIFLASH_FS_NAME "FAT"
+#endif
+
 esp_err_t spiflash_init(void);
 esp_err_t spiflash_deinit(void);
+esp_err_t spiflash_replace(const char *from, const char *to);
+void spiflash_bench(int n);
 
 
 #endif
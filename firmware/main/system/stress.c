@@ -0,0 +1,167 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_tls.h"
+#include "system.h"
+#include "config.h"
+#include "net_certs.h"
+#include "rfid_task.h"
+#include "perf.h"
+#include "stress.h"
+
+//
+// Latency stress test: replays RFID frames through rfid_task while optionally
+// running back-to-back TLS handshakes on the network core, then reports the
+// scan_to_decision and rfid_lookup percentiles for each configuration.
+//
+// Replayed frames are looked up against the real ACL but never unlock the
+// door, change the UI or report over MQTT.
+//
+
+static const char *TAG = "stress";
+
+// valid frame for tag 0x000DEF80 (see the packet description in rfid_task.c)
+static const uint8_t s_replay_frame[RFID_FRAME_LEN] = { 0x02, 0x0A, 0x02, 0x11, 0x00, 0x0D, 0xEF, 0x80, 0x7B, 0x03 };
+
+static volatile bool s_replay_run;
+static volatile bool s_replay_done;
+static volatile bool s_tls_run;
+static volatile bool s_tls_done;
+static int s_replay_interval_ms;
+
+static void stress_replay_task(void *pvParameters)
+{
+  while (s_replay_run) {
+    rfid_inject_frame(s_replay_frame, sizeof(s_replay_frame));
+    vTaskDelay(s_replay_interval_ms / portTICK_PERIOD_MS);
+  }
+  s_replay_done = true;
+  vTaskDelete(NULL);
+}
+
+static void stress_tls_task(void *pvParameters)
+{
+  perf_stat_t *stat = perf_register("tls_handshake", "ms");
+  char url[160];
+
+  const config_t *cfg = config_acquire();
+  snprintf(url, sizeof(url), cfg->acl_url_fmt, cfg->acl_resource);
+  config_release(cfg);
+
+  esp_tls_cfg_t tls_cfg = {
+    .cacert_buf = (const unsigned char *)g_ca_cert,
+    .cacert_bytes = g_ca_cert ? strlen(g_ca_cert) + 1 : 0,
+    .clientcert_buf = (const unsigned char *)g_client_cert,
+    .clientcert_bytes = g_client_cert ? strlen(g_client_cert) + 1 : 0,
+    .clientkey_buf = (const unsigned char *)g_client_key,
+    .clientkey_bytes = g_client_key ? strlen(g_client_key) + 1 : 0,
+    .skip_common_name = true,
+    .timeout_ms = 5000,
+  };
+
+  int ok = 0, failed = 0;
+  while (s_tls_run) {
+    int64_t t0 = esp_timer_get_time();
+    esp_tls_t *tls = esp_tls_conn_http_new(url, &tls_cfg);
+    if (tls) {
+      perf_record(stat, (esp_timer_get_time() - t0) / 1000);
+      esp_tls_conn_delete(tls);
+      ok++;
+    } else {
+      failed++;
+      vTaskDelay(100 / portTICK_PERIOD_MS);
+    }
+    vTaskDelay(1);
+  }
+
+  ESP_LOGI(TAG, "TLS load: %d handshakes, %d failed", ok, failed);
+  s_tls_done = true;
+  vTaskDelete(NULL);
+}
+
+static void stress_phase(const char *name, int seconds)
+{
+  char label[48];
+
+  perf_reset_all();
+
+  s_replay_done = false;
+  s_replay_run = true;
+  xTaskCreatePinnedToCore(&stress_replay_task, "stress_replay", 2048, NULL, 1, NULL, TASK_CORE(CORE_APP));
+
+  vTaskDelay((seconds * 1000) / portTICK_PERIOD_MS);
+
+  s_replay_run = false;
+  while (!s_replay_done) {
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+  }
+  // let the last injected frames drain through rfid_task and main_task
+  vTaskDelay(200 / portTICK_PERIOD_MS);
+
+  snprintf(label, sizeof(label), "%s, %s", TASK_AFFINITY_NAME, name);
+  perf_report(label);
+}
+
+void stress_run(int seconds, int replay_interval_ms)
+{
+  s_replay_interval_ms = replay_interval_ms < 10 ? 10 : replay_interval_ms;
+
+  printf("\nstress: %d s per phase, replaying a frame every %d ms, tasks %s\n", seconds, s_replay_interval_ms, TASK_AFFINITY_NAME);
+
+  stress_phase("idle network", seconds);
+
+  if (g_ca_cert == NULL) {
+    printf("\nstress: certificates not loaded, skipping TLS load phase\n");
+    return;
+  }
+
+  s_tls_done = false;
+  s_tls_run = true;
+  // same placement and priority as net_task, which does the real handshakes
+  xTaskCreatePinnedToCore(&stress_tls_task, "stress_tls", 8192, NULL, TASK_PRIO_NET, NULL, TASK_CORE(CORE_NET));
+
+  stress_phase("TLS handshake load", seconds);
+
+  s_tls_run = false;
+  while (!s_tls_done) {
+    vTaskDelay(50 / portTICK_PERIOD_MS);
+  }
+}
@@ -4,10 +4,97 @@
 #define HARDWARE_REV1
 
 #define DISPLAY_ENABLED
+// display updates go through latest-value mailboxes instead of a blocking
+// queue; comment out to measure the old queue path (see "perf" display_post)
+#define DISPLAY_MAILBOX
+// display task sleeps until LVGL's next deadline instead of polling every
+// 10 ms; comment out to compare idle CPU with the "cpu" command
+#define DISPLAY_GOVERNOR
+// keep a full-screen shadow framebuffer and only send tiles that changed
+// (~36KB extra RAM); compare frame_bytes_* / frame_us_* in "perf"
+//#define DISPLAY_TILE_DIFF
+// build the splash, info and OTA screens only when shown and delete them
+// afterwards; compare lvgl_mem_used / the "free" command with it off
+#define DISPLAY_LAZY_SCREENS
 #define CONSOLE_ENABLED
 
 #define LV_LVGL_H_INCLUDE_SIMPLE
 
+// Task placement.  Wi-Fi, lwIP, the MQTT client and net_task (TLS handshakes)
+// share the protocol core; the scan path (rfid -> main -> door) and the UI run
+// on the application core so a handshake can never delay an access decision.
+// Comment out TASK_AFFINITY_ENABLED to build the unpinned configuration for
+// comparison with the console "stress" command.
+#define TASK_AFFINITY_ENABLED
+
+#define CORE_NET 0
+#define CORE_APP 1
+
+#ifdef TASK_AFFINITY_ENABLED
+#define TASK_CORE(c) (c)
+#define TASK_AFFINITY_NAME "pinned"
+#else
+#define TASK_CORE(c) tskNO_AFFINITY
+#define TASK_AFFINITY_NAME "unpinned"
+#endif
+
+// Priorities on the application core are ordered along the scan path: the
+// reader first, then the state machine, then the door actuator.  Display
+// rendering is the longest-running work on that core so it sits below them.
+#define TASK_PRIO_RFID    6
+#define TASK_PRIO_MAIN    5
+#define TASK_PRIO_DOOR    4
+#define TASK_PRIO_SYSTEM  4
+#define TASK_PRIO_DISPLAY 2
+#define TASK_PRIO_NET     2
+// boot time ACL hash; on the application core, since app_main brings the
+// panel up on the network core at priority 1 and would otherwise be preempted
+#define TASK_PRIO_ACL     2
+// background OTA download, below everything else on the network core
+#define TASK_PRIO_OTA     1
+
+// OTA download bandwidth cap, so MQTT and ACL traffic keep flowing
+#define OTA_THROTTLE_KBPS 64
+// download OTA images through a receive task -> ring buffer -> flash writer
+// pipeline; comment out to compare with esp_https_ota using "ota --bench"
+#define OTA_PIPELINE
+
+// times a download (OTA, ACL, assets, wget) is resumed with a Range request
+// after the connection drops before it gives up
+#define HTTP_RESUME_RETRIES 5
+
+// gather file downloads into whole flash sectors before writing them; comment
+// out to compare the write amplification http_get logs for ACL/wget files
+#define HTTP_WRITE_BEHIND
+
+// on battery, drop from light sleep to deep sleep after this long with no
+// wakeup; the hot tag cache and event counters survive in RTC memory (see
+// rtc_cache.h).  Comment out to stay in light sleep
+#define DEEP_SLEEP_AFTER_MIN 30
+
+// figures for the battery runtime estimates "sleep_info" prints; nominal
+// board currents, replace with measured ones
+#define BATT_CAPACITY_MAH    2000
+#define BATT_AWAKE_UA        90000
+#define BATT_LIGHT_SLEEP_UA  1500
+#define BATT_DEEP_SLEEP_UA   150
+// waiting for a scan at PM_MIN_FREQ_MHZ with automatic light sleep
+#define PM_IDLE_UA           25000
+
+// lowest CPU clock while idle (see pm_ctl.h, needs CONFIG_PM_ENABLE)
+#define PM_MIN_FREQ_MHZ 40
+// after reader traffic wakes the chip, stay out of light sleep this long so
+// the reader's next frame is received whole
+#define RFID_AWAKE_MS   1500
+
+// switch Wi-Fi power save with what the node is doing (net_wifi_ps.h);
+// comment out to stay on the driver default, WIFI_PS_MIN_MODEM
+#define WIFI_PS_ADAPTIVE
+// power save stays off this long after a scan
+#define WIFI_PS_ACTIVITY_MS      10000
+// beacons between wakeups in WIFI_PS_MAX_MODEM
+#define WIFI_PS_LISTEN_INTERVAL  3
+
 #include "gpio_map.h"
 
 #endif
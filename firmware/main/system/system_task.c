@@ -53,6 +53,14 @@
 #include "esp_sleep.h"
 #include "main_task.h"
 #include "display_lvgl.h"
+#include "display_task.h"
+#include "config.h"
+#include "assets.h"
+#include "rtc_cache.h"
+#include "pm_ctl.h"
+#include "door_task.h"
+#include "rfid_task.h"
+#include "driver/rtc_io.h"
 
 static const char *TAG = "system_task";
 
@@ -76,6 +84,12 @@ void power_mgmt_init(void)
   gpio_set_direction(GPIO_PIN_PWR_ENABLE, GPIO_MODE_OUTPUT);
   gpio_set_level(GPIO_PIN_PWR_ENABLE, 1);
 
+  // held through deep sleep; release only once driven to their run levels
+  gpio_hold_dis(GPIO_PIN_SHUTDOWN);
+  gpio_hold_dis(GPIO_PIN_PWR_ENABLE);
+  gpio_deep_sleep_hold_dis();
+  rtc_gpio_deinit(GPIO_PIN_FP_BUTTON);
+
   gpio_reset_pin(GPIO_PIN_N_PWR_LOSS);
   gpio_set_direction(GPIO_PIN_N_PWR_LOSS, GPIO_MODE_INPUT);
 
@@ -96,7 +110,12 @@ static void nvs_init(void)
 void system_init(void)
 {
   nvs_init();
+  config_init();
+#ifdef CONFIG_RATT_ASSETS_PARTITION
+  assets_init();
+#endif
   spiflash_init();
+  rtc_cache_init();
 
   m_q = xQueueCreate(SYSTEM_QUEUE_DEPTH, sizeof(system_evt_t));
   if (m_q == NULL) {
@@ -104,6 +123,7 @@ void system_init(void)
   }
 
   power_mgmt_init();
+  pm_ctl_init();
 }
 
 
@@ -125,6 +145,7 @@ void system_sleep()
   fflush(stdout);
   vTaskDelay(500/portTICK_PERIOD_MS);
 
+  rfid_rx_wakeup(false);
   gpio_set_level(GPIO_PIN_PWR_ENABLE, 0);
 
   esp_sleep_pd_config(ESP_PD_DOMAIN_VDDSDIO, ESP_PD_OPTION_ON);
@@ -136,7 +157,55 @@ void system_sleep()
 
   esp_sleep_enable_gpio_wakeup();
 
+#ifdef DEEP_SLEEP_AFTER_MIN
+  esp_sleep_enable_timer_wakeup(DEEP_SLEEP_AFTER_MIN * 60 * 1000000ULL);
+#endif
+
   esp_light_sleep_start();
+
+#ifdef DEEP_SLEEP_AFTER_MIN
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+#endif
+}
+
+// light sleep ran its full course without a button press or power coming back
+bool system_sleep_timed_out()
+{
+  return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER;
+}
+
+// Doesn't return unless main power came back.  Only RTC IO can wake deep
+// sleep: the button (ext0) and power restore (ext1) are RTC pins, the door
+// sensor on GPIO_PIN_ALARM_SCL isn't, so a door opened while in deep sleep
+// is picked up when something else wakes the device.
+void system_deep_sleep()
+{
+  if (gpio_get_level(GPIO_PIN_N_PWR_LOSS)) {
+    ESP_LOGI(TAG, "power is back, not entering deep sleep");
+    return;
+  }
+
+  rtc_cache_deep_sleep();
+  fflush(stdout);
+
+  gpio_wakeup_disable(GPIO_PIN_FP_BUTTON);
+  gpio_wakeup_disable(GPIO_PIN_N_PWR_LOSS);
+  gpio_wakeup_disable(GPIO_PIN_ALARM_SCL);
+
+  // keep the board powered and the peripheral rail off while the digital
+  // pads are unpowered
+  gpio_set_level(GPIO_PIN_PWR_ENABLE, 0);
+  gpio_hold_en(GPIO_PIN_SHUTDOWN);
+  gpio_hold_en(GPIO_PIN_PWR_ENABLE);
+  gpio_deep_sleep_hold_en();
+
+  esp_sleep_pd_config(ESP_PD_DOMAIN_VDDSDIO, ESP_PD_OPTION_AUTO);
+  esp_sleep_enable_ext0_wakeup(GPIO_PIN_FP_BUTTON, 0);
+  rtc_gpio_pullup_en(GPIO_PIN_FP_BUTTON);
+  rtc_gpio_pulldown_dis(GPIO_PIN_FP_BUTTON);
+  esp_sleep_enable_ext1_wakeup(1ULL << GPIO_PIN_N_PWR_LOSS, ESP_EXT1_WAKEUP_ANY_HIGH);
+
+  esp_deep_sleep_start();
 }
 
 void system_wake()
@@ -145,9 +214,14 @@ void system_wake()
 
   gpio_set_level(GPIO_PIN_PWR_ENABLE, 1);
 
+  // the button and door sensor were level wakeup sources while asleep
+  display_button_arm();
+  door_sensor_arm();
+  rfid_rx_wakeup(true);
   display_lvgl_disp_off(false);
 
-  vTaskDelay(500/portTICK_PERIOD_MS);
+  // short settle for the peripheral rail; the RFID reader is serviced as soon as this returns
+  vTaskDelay(50/portTICK_PERIOD_MS);
 }
 
 void system_shutdown()
@@ -173,7 +247,8 @@ void system_task(void *pvParameters)
 
     esp_task_wdt_reset();
 
-    if (xQueueReceive(m_q, &evt, (20 / portTICK_PERIOD_MS)) == pdPASS) {
+    // the power pins are debounced over seconds, no need to poll them often
+    if (xQueueReceive(m_q, &evt, (100 / portTICK_PERIOD_MS)) == pdPASS) {
       ESP_LOGI(TAG, "system task cmd=%d\n", evt.cmd);
     }
 
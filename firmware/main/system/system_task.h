@@ -37,11 +37,15 @@
 #ifndef _SYSTEM_TASK
 #define _SYSTEM_TASK
 
+#include <stdbool.h>
+
 void system_task(void *pvParameters);
 void system_init();
 
 void system_pre_sleep();
 void system_sleep();
+bool system_sleep_timed_out();
+void system_deep_sleep();
 void system_wake();
 
 #endif
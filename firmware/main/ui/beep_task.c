@@ -38,18 +38,22 @@
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/queue.h"
-#include "esp_task_wdt.h"
+#include "freertos/semphr.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "esp_log.h"
 #include "system.h"
+#include "perf.h"
 
 #include "driver/ledc.h"
 #include "beep_task.h"
+#ifdef CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
 
 static const char *TAG = "beep_task";
 
-#define BEEP_QUEUE_DEPTH 16
+#define BEEP_QUEUE_DEPTH 8
 
 const beep_t _beep_door_open[] = { {2216, 75, 1, 1}, {0, 50, 1, 1}, {1108, 75, 1, 1}, {HZ_END, 0, 0, 0} };
 const beep_t _beep_door_closed[] = { {1108, 75, 1, 1}, {0, 50, 1, 1}, {2216, 75, 1, 1}, {HZ_END, 0, 0, 0} };
@@ -88,100 +92,244 @@ ledc_channel_config_t ledc_channel = {
 };
 
 
-typedef struct beep_evt {
-  const beep_t* beeps;
-} beep_evt_t;
+//
+// Sequencer.  Notes are advanced from a one-shot esp_timer instead of a
+// task sleeping between them: each note is a sounding phase (attack plus
+// msec) followed by a decay phase, and every phase end is scheduled against
+// an absolute deadline so errors don't accumulate along a sequence.
+//
+// A sequence with a higher priority than the one playing stops it and
+// drops anything queued below it, so access feedback is heard immediately
+// instead of after a pre-scan or door chirp.  Equal or lower priorities
+// wait their turn.
+//
+typedef enum {
+  PHASE_IDLE,
+  PHASE_SOUND,
+  PHASE_DECAY
+} beep_phase_t;
+
+typedef struct {
+  const beep_t *beeps;
+  beep_prio_t prio;
+} beep_req_t;
+
+static SemaphoreHandle_t s_lock;
+static esp_timer_handle_t s_timer;
+
+static beep_req_t s_cur;
+static int s_note;
+static beep_phase_t s_phase = PHASE_IDLE;
+static int64_t s_due_us;
+
+static beep_req_t s_pending[BEEP_QUEUE_DEPTH];
+static int s_num_pending = 0;
+
+// how late each note started against its schedule
+static perf_stat_t *s_note_err_stat = NULL;
+
+// LEDC runs off the APB clock, which drops with the CPU clock while idle,
+// so a sequence holds APB at full speed (which also keeps the chip out of
+// light sleep) from its first note to the end of its last decay
+#ifdef CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t s_pm_lock;
+#endif
+static bool s_pm_held = false;
+
+// caller holds s_lock
+static void beep_hold_clock(bool hold)
+{
+  if (hold == s_pm_held)
+    return;
+  s_pm_held = hold;
+
+#ifdef CONFIG_PM_ENABLE
+  if (s_pm_lock == NULL)
+    return;
+  if (hold)
+    esp_pm_lock_acquire(s_pm_lock);
+  else
+    esp_pm_lock_release(s_pm_lock);
+#endif
+}
 
-static QueueHandle_t m_q;
 
-BaseType_t beep_queue(const beep_t* beeps)
+static void beep_start(int hz, int attack)
 {
-    beep_evt_t evt;
-    evt.beeps = beeps;
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+  if (hz > 100) {
+    ledc_set_freq(ledc_channel.speed_mode, ledc_beep.timer_num, hz);
+    ledc_set_fade_with_time(ledc_channel.speed_mode,
+            ledc_channel.channel, 900, attack);
+    ledc_fade_start(ledc_channel.speed_mode,
+            ledc_channel.channel, LEDC_FADE_NO_WAIT);
+  }
 }
 
-void bdelay(int ms)
+static void beep_stop(int decay)
 {
-    TickType_t delay = ms / portTICK_PERIOD_MS;
-    vTaskDelay(delay);
+  ledc_set_fade_with_time(ledc_channel.speed_mode,
+          ledc_channel.channel, 0, decay);
+  ledc_fade_start(ledc_channel.speed_mode,
+          ledc_channel.channel, LEDC_FADE_NO_WAIT);
 }
 
+static void beep_silence(void)
+{
+  ledc_set_duty(ledc_channel.speed_mode, ledc_channel.channel, 0);
+  ledc_update_duty(ledc_channel.speed_mode, ledc_channel.channel);
+}
 
-void beep_init(void)
+// arm the timer for the end of a phase lasting `ms` from the previous deadline
+static void beep_schedule(int ms)
 {
-  esp_log_level_set("ledc", ESP_LOG_NONE);
+  int64_t now = esp_timer_get_time();
 
-  m_q = xQueueCreate(BEEP_QUEUE_DEPTH, sizeof(beep_evt_t));
-  if (m_q == NULL) {
-      ESP_LOGE(TAG, "FATAL: Cannot create beeper queue!");
-  }
+  s_due_us += (int64_t) ms * 1000;
+  esp_timer_stop(s_timer);
+  esp_timer_start_once(s_timer, s_due_us > now ? s_due_us - now : 0);
+}
 
-  gpio_config_t beep_gpio_cfg = {
-      .pin_bit_mask = GPIO_SEL_BEEPER,
-      .mode = GPIO_MODE_OUTPUT,
-      .pull_up_en = GPIO_PULLUP_ENABLE,
-      .pull_down_en = GPIO_PULLDOWN_DISABLE,
-      .intr_type = GPIO_INTR_DISABLE
-  };
+// caller holds s_lock; start note s_note of the current sequence, or the
+// next queued sequence if this one is done
+static void beep_next_note(void)
+{
+  while (s_cur.beeps == NULL || s_cur.beeps[s_note].hz == HZ_END) {
+    if (s_num_pending == 0) {
+      s_cur.beeps = NULL;
+      s_phase = PHASE_IDLE;
+      beep_hold_clock(false);
+      return;
+    }
 
-  gpio_config(&beep_gpio_cfg);
+    s_cur = s_pending[0];
+    memmove(&s_pending[0], &s_pending[1], --s_num_pending * sizeof(beep_req_t));
+    s_note = 0;
+    s_due_us = esp_timer_get_time();
+  }
 
-  ledc_timer_config(&ledc_beep);
-  ledc_channel_config(&ledc_channel);
+  const beep_t *b = &s_cur.beeps[s_note];
+  int64_t err = esp_timer_get_time() - s_due_us;
 
-  ledc_fade_func_install(0);
+  ESP_LOGD(TAG, "beep hz=%d attack=%d msec=%d decay=%d late=%lldus", b->hz, b->attack, b->msec, b->decay, err);
+  perf_record(s_note_err_stat, err > 0 ? err : 0);
+
+  beep_hold_clock(true);
+  beep_start(b->hz, b->attack);
+  s_phase = PHASE_SOUND;
+  beep_schedule(b->msec + b->attack);
 }
 
-void beep_start(int hz, int attack)
+static void beep_timer_cb(void *arg)
 {
-  ledc_beep.freq_hz = hz;
-  ledc_timer_config(&ledc_beep);
+  xSemaphoreTake(s_lock, portMAX_DELAY);
 
-  if (hz > 100) {
-    ledc_set_fade_with_time(ledc_channel.speed_mode,
-            ledc_channel.channel, 900, attack);
-    ledc_fade_start(ledc_channel.speed_mode,
-            ledc_channel.channel, LEDC_FADE_NO_WAIT);
+  // a preempting beep_play() may have replaced the sequence after this
+  // expiry fired; its own deadline is still ahead, so leave it alone
+  if (s_phase == PHASE_IDLE || esp_timer_get_time() < s_due_us) {
+    xSemaphoreGive(s_lock);
+    return;
   }
+
+  const beep_t *b = &s_cur.beeps[s_note];
+
+  if (s_phase == PHASE_SOUND) {
+    beep_stop(b->decay);
+    s_phase = PHASE_DECAY;
+    beep_schedule(b->decay);
+  } else {
+    s_note++;
+    beep_next_note();
+  }
+
+  xSemaphoreGive(s_lock);
 }
 
-void beep_stop(int decay)
+BaseType_t beep_play(const beep_t* beeps, beep_prio_t prio)
 {
-  ledc_set_fade_with_time(ledc_channel.speed_mode,
-          ledc_channel.channel, 0, decay);
-  ledc_fade_start(ledc_channel.speed_mode,
-          ledc_channel.channel, LEDC_FADE_NO_WAIT);
+  BaseType_t r = pdTRUE;
+  beep_req_t req = { .beeps = beeps, .prio = prio };
+
+  xSemaphoreTake(s_lock, portMAX_DELAY);
+
+  if (s_phase != PHASE_IDLE && prio > s_cur.prio) {
+    // preempt: cut the current note and forget anything less important
+    int kept = 0;
+    for (int i = 0; i < s_num_pending; i++) {
+      if (s_pending[i].prio >= prio)
+        s_pending[kept++] = s_pending[i];
+    }
+    s_num_pending = kept;
+
+    esp_timer_stop(s_timer);
+    beep_silence();
+    s_phase = PHASE_IDLE;
+    s_cur.beeps = NULL;
+  }
+
+  if (s_num_pending < BEEP_QUEUE_DEPTH) {
+    // insert ahead of lower priorities
+    int i = s_num_pending;
+    while (i > 0 && s_pending[i - 1].prio < prio) {
+      s_pending[i] = s_pending[i - 1];
+      i--;
+    }
+    s_pending[i] = req;
+    s_num_pending++;
+  } else {
+    ESP_LOGW(TAG, "beep queue full, dropped");
+    r = pdFALSE;
+  }
+
+  if (s_phase == PHASE_IDLE)
+    beep_next_note();
+
+  xSemaphoreGive(s_lock);
+  return r;
 }
 
-void beep_delay(int ms)
+BaseType_t beep_queue(const beep_t* beeps)
 {
-    TickType_t delay = ms / portTICK_PERIOD_MS;
-    vTaskDelay(delay);
+  return beep_play(beeps, BEEP_PRIO_NORMAL);
 }
 
-void beep_task(void *pvParameters)
+
+void beep_init(void)
 {
-    esp_task_wdt_add(NULL);
+  esp_log_level_set("ledc", ESP_LOG_NONE);
+
+  s_lock = xSemaphoreCreateMutex();
+  if (s_lock == NULL) {
+      ESP_LOGE(TAG, "FATAL: Cannot create beeper lock!");
+  }
+
+  gpio_config_t beep_gpio_cfg = {
+      .pin_bit_mask = GPIO_SEL_BEEPER,
+      .mode = GPIO_MODE_OUTPUT,
+      .pull_up_en = GPIO_PULLUP_ENABLE,
+      .pull_down_en = GPIO_PULLDOWN_DISABLE,
+      .intr_type = GPIO_INTR_DISABLE
+  };
 
-    while(1) {
-        beep_evt_t evt;
+  gpio_config(&beep_gpio_cfg);
+
+#ifdef CONFIG_PM_ENABLE
+  if (esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "beep", &s_pm_lock) != ESP_OK) {
+      ESP_LOGE(TAG, "Cannot create beeper PM lock");
+      s_pm_lock = NULL;
+  }
+#endif
 
-        esp_task_wdt_reset();
+  ledc_timer_config(&ledc_beep);
+  ledc_channel_config(&ledc_channel);
 
-        if (xQueueReceive(m_q, &evt, (20 / portTICK_PERIOD_MS)) == pdPASS) {
-            int bidx = 0;
-            const beep_t* b = &evt.beeps[bidx];
-            while (b->hz != HZ_END) {
-              ESP_LOGD(TAG, "beep event hz=%d attack=%d msec=%d decay=%d\n", b->hz, b->attack, b->msec, b->decay);
+  ledc_fade_func_install(0);
 
-              beep_start(b->hz, b->attack);
-              beep_delay(b->msec + b->attack);
-              beep_stop(b->decay);
-              beep_delay(b->decay);
+  const esp_timer_create_args_t timer_args = {
+      .callback = beep_timer_cb,
+      .dispatch_method = ESP_TIMER_TASK,
+      .name = "beep"
+  };
+  ESP_ERROR_CHECK(esp_timer_create(&timer_args, &s_timer));
 
-              b = &evt.beeps[++bidx];
-            }
-        }
-    }
+  s_note_err_stat = perf_register("beep_note_err", "us");
 }
@@ -37,7 +37,6 @@
 #ifndef _BEEP_TASK
 #define _BEEP_TASK
 
-void beep_task(void *pvParameters);
 void beep_init();
 
 #define HZ_END -1
@@ -49,6 +48,14 @@ typedef struct beep {
   int decay;
 } beep_t;
 
+// a sequence preempts any playing or queued sequence of lower priority
+typedef enum {
+  BEEP_PRIO_LOW,      // chirps: door, button
+  BEEP_PRIO_NORMAL,
+  BEEP_PRIO_ACCESS    // access decisions
+} beep_prio_t;
+
+BaseType_t beep_play(const beep_t* beeps, beep_prio_t prio);
 BaseType_t beep_queue(const beep_t* beeps);
 
 extern const beep_t _beep_door_open[];
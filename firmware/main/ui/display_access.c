@@ -0,0 +1,219 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+#include "system.h"
+#include "perf.h"
+#include "display_lvgl.h"
+#include "display_access.h"
+
+static const char *TAG = "display_access";
+
+#define ACCESS_W 160
+#define ACCESS_H 80
+#define ACCESS_NAME_PAD 2
+
+typedef struct {
+  uint16_t count;
+  lv_color_t color;
+} access_run_t;
+
+typedef struct {
+  access_run_t *runs;
+  int num_runs;
+} access_template_t;
+
+static lv_color_t *s_frame = NULL;
+static lv_obj_t *s_scr = NULL;
+static lv_obj_t *s_canvas = NULL;
+static access_template_t s_templates[ACCESS_RESULT_MAX];
+static bool s_ready = false;
+
+static perf_stat_t *s_compose_stat;
+
+static void access_template_style(access_result_t result, lv_color_t *bg, const char **header)
+{
+  switch (result) {
+    case ACCESS_RESULT_ALLOWED:
+      *bg = lv_palette_main(LV_PALETTE_GREEN);
+      *header = LV_SYMBOL_OK " ACCESS GRANTED";
+      break;
+    case ACCESS_RESULT_UNKNOWN:
+      *bg = lv_palette_darken(LV_PALETTE_DEEP_ORANGE, 1);
+      *header = LV_SYMBOL_WARNING " UNKNOWN TAG";
+      break;
+    case ACCESS_RESULT_DENIED:
+    default:
+      *bg = lv_palette_main(LV_PALETTE_RED);
+      *header = LV_SYMBOL_CLOSE " ACCESS DENIED";
+      break;
+  }
+}
+
+// run-length encode the current frame into a template; backgrounds are
+// solid so a template is a few hundred runs instead of 25KB of pixels
+static bool access_template_encode(access_template_t *t)
+{
+  int n = 0;
+  for (int i = 0; i < ACCESS_W * ACCESS_H; n++) {
+    int j = i + 1;
+    while (j < ACCESS_W * ACCESS_H && s_frame[j].full == s_frame[i].full && j - i < UINT16_MAX)
+      j++;
+    i = j;
+  }
+
+  t->runs = malloc(n * sizeof(access_run_t));
+  if (!t->runs)
+    return false;
+
+  n = 0;
+  for (int i = 0; i < ACCESS_W * ACCESS_H; n++) {
+    int j = i + 1;
+    while (j < ACCESS_W * ACCESS_H && s_frame[j].full == s_frame[i].full && j - i < UINT16_MAX)
+      j++;
+    t->runs[n].count = j - i;
+    t->runs[n].color = s_frame[i];
+    i = j;
+  }
+  t->num_runs = n;
+  return true;
+}
+
+static void access_template_decode(const access_template_t *t)
+{
+  lv_color_t *p = s_frame;
+  for (int r = 0; r < t->num_runs; r++) {
+    lv_color_t c = t->runs[r].color;
+    for (int k = t->runs[r].count; k > 0; k--)
+      *p++ = c;
+  }
+}
+
+static void access_template_render(access_result_t result)
+{
+  lv_color_t bg;
+  const char *header;
+  lv_draw_label_dsc_t dsc;
+
+  access_template_style(result, &bg, &header);
+
+  lv_canvas_fill_bg(s_canvas, bg, LV_OPA_COVER);
+
+  lv_draw_label_dsc_init(&dsc);
+  dsc.color = lv_color_white();
+  dsc.font = &lv_font_montserrat_16;
+  dsc.align = LV_TEXT_ALIGN_CENTER;
+  lv_canvas_draw_text(s_canvas, 0, 4, ACCESS_W, &dsc, header);
+}
+
+bool display_access_init(void)
+{
+  s_frame = heap_caps_malloc(LV_CANVAS_BUF_SIZE_TRUE_COLOR(ACCESS_W, ACCESS_H), MALLOC_CAP_DMA);
+  if (!s_frame) {
+    ESP_LOGE(TAG, "no DMA memory for access frame, using LVGL access screen");
+    return false;
+  }
+
+  s_scr = lv_obj_create(NULL);
+  lv_obj_set_style_bg_color(s_scr, lv_color_black(), 0);
+  lv_obj_clear_flag(s_scr, LV_OBJ_FLAG_SCROLLABLE);
+
+  s_canvas = lv_canvas_create(s_scr);
+  lv_canvas_set_buffer(s_canvas, s_frame, ACCESS_W, ACCESS_H, LV_IMG_CF_TRUE_COLOR);
+  lv_obj_set_pos(s_canvas, 0, 0);
+
+  int bytes = 0;
+  for (int i = 0; i < ACCESS_RESULT_MAX; i++) {
+    access_template_render(i);
+    if (!access_template_encode(&s_templates[i])) {
+      ESP_LOGE(TAG, "no memory for access template %d", i);
+      return false;
+    }
+    bytes += s_templates[i].num_runs * sizeof(access_run_t);
+  }
+  ESP_LOGI(TAG, "access templates cached, %d bytes", bytes);
+
+  s_compose_stat = perf_register("access_compose", "us");
+  s_ready = true;
+
+  return true;
+}
+
+// NULL until the templates are cached; callers fall back to ui_access
+lv_obj_t *display_access_screen(void)
+{
+  return s_ready ? s_scr : NULL;
+}
+
+void display_access_show(access_result_t result, const char *name, int64_t t0)
+{
+  int64_t c0 = esp_timer_get_time();
+  lv_draw_label_dsc_t dsc;
+  lv_point_t size;
+
+  if (result >= ACCESS_RESULT_MAX)
+    result = ACCESS_RESULT_DENIED;
+
+  access_template_decode(&s_templates[result]);
+
+  // only the name is rendered per scan; fall back to a smaller, wrapping
+  // font for names that don't fit on one line
+  lv_draw_label_dsc_init(&dsc);
+  dsc.color = lv_color_white();
+  dsc.font = &lv_font_montserrat_28;
+  dsc.align = LV_TEXT_ALIGN_CENTER;
+
+  const lv_coord_t max_w = ACCESS_W - 2 * ACCESS_NAME_PAD;
+  const lv_coord_t max_h = ACCESS_H - ACCESS_HEADER_H;
+  lv_txt_get_size(&size, name, dsc.font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+  if (size.x > max_w) {
+    dsc.font = &lv_font_montserrat_16;
+    lv_txt_get_size(&size, name, dsc.font, 0, 0, max_w, LV_TEXT_FLAG_NONE);
+  }
+  lv_coord_t y = ACCESS_HEADER_H + (size.y < max_h ? (max_h - size.y) / 2 : 0);
+  lv_canvas_draw_text(s_canvas, ACCESS_NAME_PAD, y, max_w, &dsc, name);
+
+  perf_record(s_compose_stat, esp_timer_get_time() - c0);
+
+  display_lvgl_blit(s_frame, t0);
+}
@@ -0,0 +1,61 @@
+/*--------------------------------------------------------------------------
+  _____       ______________
+ |  __ \   /\|__   ____   __|
+ | |__) | /  \  | |    | |
+ |  _  / / /\ \ | |    | |
+ | | \ \/ ____ \| |    | |
+ |_|  \_\/    \_\_|    |_|    ... RFID ALL THE THINGS!
+
+ A resource access control and telemetry solution for Makerspaces
+
+ Developed at MakeIt Labs - New Hampshire's First & Largest Makerspace
+ http://www.makeitlabs.com/
+
+ Copyright 2017-2020 MakeIt Labs
+
+ Permission is hereby granted, free of charge, to any person obtaining a
+ copy of this software and associated documentation files (the "Software"),
+ to deal in the Software without restriction, including without limitation
+ the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ and/or sell copies of the Software, and to permit persons to whom the
+ Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+ --------------------------------------------------------------------------
+ Author: Steve Richardson (steve.richardson@makeitlabs.com)
+ -------------------------------------------------------------------------- */
+
+#ifndef _DISPLAY_ACCESS_H
+#define _DISPLAY_ACCESS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+#include "display_task.h"
+
+//
+// Fast path for the access result screen.  The granted/denied/unknown
+// templates are rendered once at startup and kept run-length encoded; on a
+// scan the matching template is expanded into a full-screen RGB565 frame,
+// only the name is drawn on top, and the frame goes to the panel as a
+// single DMA transfer without waiting for an LVGL refresh or screen
+// animation.  The frame also backs an LVGL canvas screen so LVGL's idea of
+// what is on the panel stays in sync for the transition back to idle.
+//
+
+#define ACCESS_HEADER_H 24
+
+bool display_access_init(void);
+lv_obj_t *display_access_screen(void);
+void display_access_show(access_result_t result, const char *name, int64_t t0);
+
+#endif
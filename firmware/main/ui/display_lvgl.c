@@ -35,6 +35,7 @@
  -------------------------------------------------------------------------- */
 
 #include <stdio.h>
+#include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_timer.h"
@@ -47,7 +48,10 @@
 #include "esp_log.h"
 #include "lvgl.h"
 #include "system.h"
+#include "perf.h"
 #include "esp_lcd_panel_st7735.h"
+#include "ui_img.h"
+#include "assets.h"
 
 static const char *TAG = "display";
 
@@ -64,34 +68,365 @@ static const char *TAG = "display";
 static esp_lcd_panel_handle_t s_panel_handle = NULL;
 esp_timer_handle_t s_lvgl_tick_timer = NULL;
 
+// render/flush accounting, only touched from the display task
+static perf_stat_t *s_flush_stat = NULL;
+static perf_stat_t *s_render_stat = NULL;
+static perf_stat_t *s_wakeup_stat = NULL;
+static uint32_t s_flush_bytes = 0;
+static uint32_t s_render_us = 0;
+static uint32_t s_wakeups = 0;
+static int64_t s_stats_start = 0;
+
+
+// direct full-frame blits bypassing LVGL, see display_lvgl_blit()
+static volatile uint32_t s_blit_pending = 0;
+static volatile int64_t s_blit_t0 = 0;
+static volatile uint32_t s_blit_latency_us = 0;
+static bool s_blit_hold = false;
+static perf_stat_t *s_pixels_stat = NULL;
+
+// per-frame SPI bytes and first-flush-to-last-transfer-done time, recorded
+// into whichever stats the display task selected for the current screen
+static perf_stat_t *s_frame_bytes_stat = NULL;
+static perf_stat_t *s_frame_time_stat = NULL;
+static int64_t s_frame_t0 = 0;
+static uint32_t s_frame_bytes = 0;
+static volatile bool s_frame_closing = false;
+static volatile uint32_t s_frame_time_us = 0;
+static uint32_t s_frame_bytes_done = 0;
+
+#ifdef DISPLAY_TILE_DIFF
+//
+// Tile-diffed pipeline.  LVGL still renders into the small draw buffers,
+// but flushes land in a full-screen shadow framebuffer.  Rows are compared
+// against the shadow a tile-column segment at a time, so a tile is only
+// marked dirty if its pixels really changed (the shadow holds the previous
+// frame, so no separate per-tile hash is needed).  At the end of a refresh
+// the dirty tiles are merged into rectangles and queued to the panel
+// through double-buffered DMA staging.
+//
+#define FB_W            LCD_V_RES
+#define FB_H            LCD_H_RES
+#define TILE            16
+#define TILES_X         (FB_W / TILE)
+#define TILES_Y         (FB_H / TILE)
+#define STAGING_PX      (FB_W * TILE)
+
+static lv_color_t *s_shadow = NULL;
+static lv_color_t *s_staging[2] = { NULL, NULL };
+static int s_stage = 0;
+static uint64_t s_dirty_tiles = 0;
+static volatile uint32_t s_tile_inflight = 0;
+// panel RAM content is unknown until everything has been sent once
+static bool s_tile_force = true;
+
+#define TILE_BIT(tx, ty) (1ULL << ((ty) * TILES_X + (tx)))
+
+// copy an area into the shadow, marking tiles whose pixels changed
+static void tile_update(const lv_area_t *area, const lv_color_t *src, int src_stride)
+{
+    for (int y = area->y1; y <= area->y2; y++) {
+        const lv_color_t *row = src + (y - area->y1) * src_stride;
+        lv_color_t *dst = s_shadow + y * FB_W;
+        int ty = y / TILE;
+
+        for (int x = area->x1; x <= area->x2; ) {
+            int tx = x / TILE;
+            int end = (tx + 1) * TILE;
+            if (end > area->x2 + 1)
+                end = area->x2 + 1;
+
+            size_t n = (end - x) * sizeof(lv_color_t);
+            if (memcmp(dst + x, row + (x - area->x1), n) != 0) {
+                memcpy(dst + x, row + (x - area->x1), n);
+                s_dirty_tiles |= TILE_BIT(tx, ty);
+            }
+            x = end;
+        }
+    }
+}
+
+static void tile_send_rect(int tx0, int ty0, int tw, int th)
+{
+    int x0 = tx0 * TILE, y0 = ty0 * TILE;
+    int w = tw * TILE, h = th * TILE;
+    lv_color_t *stage = s_staging[s_stage];
+
+    // the previous rect's DMA may still be running from the other buffer;
+    // esp_lcd waits for it before sending this rect's CASET/RASET
+    for (int y = 0; y < h; y++)
+        memcpy(stage + y * w, s_shadow + (y0 + y) * FB_W + x0, w * sizeof(lv_color_t));
+    s_stage ^= 1;
+
+    __atomic_add_fetch(&s_tile_inflight, 1, __ATOMIC_RELEASE);
+    esp_lcd_panel_draw_bitmap(s_panel_handle, x0, y0, x0 + w, y0 + h, stage);
+    s_frame_bytes += w * h * sizeof(lv_color_t);
+}
+
+// merge dirty tiles into horizontal runs per tile row, grow each run down
+// while the rows below have the same run and it still fits in staging
+static void tile_send(void)
+{
+    uint64_t dirty = s_dirty_tiles;
+    s_dirty_tiles = 0;
+
+    if (s_tile_force) {
+        dirty = (TILE_BIT(0, TILES_Y) - 1);
+        s_tile_force = false;
+    }
+
+    for (int ty = 0; ty < TILES_Y; ty++) {
+        for (int tx = 0; tx < TILES_X; tx++) {
+            if (!(dirty & TILE_BIT(tx, ty)))
+                continue;
+
+            int tw = 0;
+            uint64_t run = 0;
+            while (tx + tw < TILES_X && (dirty & TILE_BIT(tx + tw, ty)) && (tw + 1) * TILE * TILE <= STAGING_PX) {
+                run |= TILE_BIT(tx + tw, ty);
+                tw++;
+            }
+
+            int th = 1;
+            while (ty + th < TILES_Y && (tw * TILE) * ((th + 1) * TILE) <= STAGING_PX) {
+                uint64_t below = run << (th * TILES_X);
+                if ((dirty & below) != below)
+                    break;
+                dirty &= ~below;
+                th++;
+            }
+
+            dirty &= ~run;
+            tile_send_rect(tx, ty, tw, th);
+            tx += tw - 1;
+        }
+    }
+}
+
+// Arm the close before looking at the in-flight count, then let whichever
+// side takes s_frame_closing back to false (us or the completion ISR)
+// record the frame, so a last DMA finishing in between isn't missed.
+static void frame_close(void)
+{
+    s_frame_bytes_done = s_frame_bytes;
+    __atomic_store_n(&s_frame_closing, true, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&s_tile_inflight, __ATOMIC_SEQ_CST) == 0 &&
+        __atomic_exchange_n(&s_frame_closing, false, __ATOMIC_ACQ_REL)) {
+        // nothing changed on the panel, or the last transfer already finished
+        s_frame_time_us = (uint32_t) (esp_timer_get_time() - s_frame_t0) + 1;
+    }
+}
+#endif
+
 
 static bool notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
 {
+#ifdef DISPLAY_TILE_DIFF
+    // LVGL's buffers were released as soon as they were copied to the
+    // shadow, completions only close out the frame
+    if (__atomic_sub_fetch(&s_tile_inflight, 1, __ATOMIC_SEQ_CST) == 0) {
+        if (__atomic_exchange_n(&s_frame_closing, false, __ATOMIC_ACQ_REL)) {
+            s_frame_time_us = (uint32_t) (esp_timer_get_time() - s_frame_t0) + 1;
+        }
+        if (s_blit_t0) {
+            s_blit_latency_us = (uint32_t) (esp_timer_get_time() - s_blit_t0);
+            s_blit_t0 = 0;
+        }
+    }
+    return false;
+#else
+    // transfers complete in order and LVGL is idle when a blit is queued,
+    // so a pending blit owns the next completion
+    if (__atomic_load_n(&s_blit_pending, __ATOMIC_ACQUIRE)) {
+        __atomic_sub_fetch(&s_blit_pending, 1, __ATOMIC_RELEASE);
+        s_blit_latency_us = (uint32_t) (esp_timer_get_time() - s_blit_t0);
+        return false;
+    }
+
+    if (s_frame_closing) {
+        s_frame_closing = false;
+        s_frame_time_us = (uint32_t) (esp_timer_get_time() - s_frame_t0);
+    }
+
     lv_disp_drv_t *disp_driver = (lv_disp_drv_t *)user_ctx;
     lv_disp_flush_ready(disp_driver);
     return false;
+#endif
 }
 
 static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
     esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t) drv->user_data;
+
+    if (s_blit_hold) {
+        // the panel already shows these pixels from a blit
+        lv_disp_flush_ready(drv);
+        return;
+    }
+
+    if (s_frame_t0 == 0) {
+        s_frame_t0 = esp_timer_get_time();
+        s_frame_bytes = 0;
+    }
+
+#ifdef DISPLAY_TILE_DIFF
+    bool last = lv_disp_flush_is_last(drv);
+    tile_update(area, color_map, area->x2 - area->x1 + 1);
+    lv_disp_flush_ready(drv);
+
+    if (last) {
+        tile_send();
+        frame_close();
+    }
+#else
     int offsetx1 = area->x1;
     int offsetx2 = area->x2;
     int offsety1 = area->y1;
     int offsety2 = area->y2;
+    s_frame_bytes += (offsetx2 - offsetx1 + 1) * (offsety2 - offsety1 + 1) * sizeof(lv_color_t);
+    if (lv_disp_flush_is_last(drv)) {
+        s_frame_bytes_done = s_frame_bytes;
+        s_frame_closing = true;
+    }
     // copy a buffer's content to a specific area of the display
     esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_map);
+#endif
 }
 
+#ifndef CONFIG_LV_TICK_CUSTOM
 static void increase_lvgl_tick(void *arg)
 {
     /* Tell LVGL how many milliseconds has elapsed */
     lv_tick_inc(LVGL_TICK_PERIOD_MS);
 }
+#endif
+
+// Runs due LVGL timers and returns the number of ms until the next one is
+// due (LV_NO_TIMER_READY if none are running).
+uint32_t display_lvgl_periodic(void)
+{
+  int64_t t0 = esp_timer_get_time();
+  uint32_t next = lv_timer_handler();
+  s_render_us += esp_timer_get_time() - t0;
+  s_wakeups++;
+
+  if (s_blit_latency_us) {
+    perf_record(s_pixels_stat, s_blit_latency_us);
+    s_blit_latency_us = 0;
+  }
+
+  if (s_frame_time_us) {
+    if (s_frame_bytes_stat) {
+      perf_record(s_frame_bytes_stat, s_frame_bytes_done);
+      perf_record(s_frame_time_stat, s_frame_time_us);
+    }
+    s_flush_bytes += s_frame_bytes_done;
+    s_frame_time_us = 0;
+    s_frame_t0 = 0;
+  }
+  return next;
+}
 
-void display_lvgl_periodic(void)
+//
+// Push a full-screen frame straight to the panel as one DMA transfer.  LVGL
+// flushes are then dropped (display_lvgl_release() ends that) so a refresh
+// of the screen backed by the same frame doesn't send it a second time.
+// `t0` is when the event that caused the frame happened; the time until the
+// transfer completes is recorded as the "pixels" perf stat.
+//
+void display_lvgl_blit(const lv_color_t *frame, int64_t t0)
 {
-  lv_timer_handler();
+#ifdef DISPLAY_TILE_DIFF
+    // goes through the shadow like any other frame, so only tiles that
+    // differ from what is on the panel are sent
+    lv_area_t full = { 0, 0, FB_W - 1, FB_H - 1 };
+
+    s_blit_hold = true;
+    s_frame_t0 = esp_timer_get_time();
+    s_frame_bytes = 0;
+    tile_update(&full, frame, FB_W);
+    if (s_dirty_tiles) {
+        s_blit_t0 = t0;
+    } else {
+        s_blit_latency_us = (uint32_t) (esp_timer_get_time() - t0);
+    }
+    tile_send();
+    frame_close();
+#else
+    lv_disp_t *disp = lv_disp_get_default();
+
+    // let an in-flight LVGL flush finish so its completion isn't taken
+    // for ours
+    while (disp->driver->draw_buf->flushing) {
+        vTaskDelay(1);
+    }
+
+    s_blit_hold = true;
+    s_blit_t0 = t0;
+    __atomic_add_fetch(&s_blit_pending, 1, __ATOMIC_RELEASE);
+    esp_lcd_panel_draw_bitmap(s_panel_handle, 0, 0, LCD_V_RES, LCD_H_RES, frame);
+    s_flush_bytes += LCD_V_RES * LCD_H_RES * sizeof(lv_color_t);
+#endif
+}
+
+// select the stats per-frame bytes/time are recorded into, typically one
+// pair per screen so idle/access/OTA costs can be compared
+void display_lvgl_frame_stats(perf_stat_t *bytes, perf_stat_t *time)
+{
+    s_frame_bytes_stat = bytes;
+    s_frame_time_stat = time;
+}
+
+void display_lvgl_release(void)
+{
+    s_blit_hold = false;
+}
+
+// Called about once a second; records SPI bytes flushed, time spent in
+// lv_timer_handler() and display loop wakeups per second of wall time.
+void display_lvgl_sample_stats(void)
+{
+  int64_t now = esp_timer_get_time();
+  int64_t elapsed = now - s_stats_start;
+
+  if (elapsed <= 0 || s_flush_stat == NULL)
+    return;
+
+  uint32_t bytes_per_sec = (uint32_t) ((int64_t) s_flush_bytes * 1000000 / elapsed);
+  uint32_t render_per_sec = (uint32_t) ((int64_t) s_render_us * 1000000 / elapsed);
+
+  perf_record(s_flush_stat, bytes_per_sec);
+  perf_record(s_render_stat, render_per_sec);
+  perf_record(s_wakeup_stat, (uint32_t) ((int64_t) s_wakeups * 1000000 / elapsed));
+
+  ESP_LOGV(TAG, "flush %u B/s, render %u us/s, %u wakeups", bytes_per_sec, render_per_sec, s_wakeups);
+
+  s_flush_bytes = 0;
+  s_render_us = 0;
+  s_wakeups = 0;
+  s_stats_start = now;
+}
+
+// register the UI's images, mapped in place from the assets partition
+// when it's enabled, otherwise the copies compiled into the app
+static void display_lvgl_add_images(void)
+{
+#ifdef CONFIG_RATT_ASSETS_PARTITION
+    int n = 0;
+
+    for (int i = 0; i < assets_count(); i++) {
+        const asset_entry_t *e = assets_entry(i);
+        if (e->type != ASSET_TYPE_IMG_RLE)
+            continue;
+
+        ui_img_add_rle(e->name, e->w, e->h, e->flags & ASSET_FLAG_ALPHA,
+                       assets_data(assets_entry(e->pool)), assets_data(e));
+        n++;
+    }
+    ESP_LOGI(TAG, "%d images from the assets partition", n);
+#else
+    ui_img_add_builtin();
+#endif
 }
 
 lv_obj_t *display_lvgl_init_scr(void)
@@ -113,7 +448,8 @@ lv_obj_t *display_lvgl_init_scr(void)
         .miso_io_num = -1,
         .quadwp_io_num = -1,
         .quadhd_io_num = -1,
-        .max_transfer_sz = LCD_H_RES * 80 * sizeof(uint16_t),
+        // large enough for a full-frame blit
+        .max_transfer_sz = LCD_H_RES * LCD_V_RES * sizeof(uint16_t),
     };
     ESP_ERROR_CHECK(spi_bus_initialize(LCD_SPI_HOST, &buscfg, SPI_DMA_CH_AUTO));
 
@@ -154,6 +490,8 @@ lv_obj_t *display_lvgl_init_scr(void)
 
     ESP_LOGI(TAG, "Initialize LVGL library");
     lv_init();
+    ui_img_init();
+    display_lvgl_add_images();
     // alloc draw buffers used by LVGL
     // it's recommended to choose the size of the draw buffer(s) to be at least 1/10 screen sized
     lv_color_t *buf1 = heap_caps_malloc(LCD_H_RES * 40 * sizeof(lv_color_t), MALLOC_CAP_DMA);
@@ -163,6 +501,14 @@ lv_obj_t *display_lvgl_init_scr(void)
     // initialize LVGL draw buffers
     lv_disp_draw_buf_init(&disp_buf, buf1, buf2, LCD_H_RES * 40);
 
+#ifdef DISPLAY_TILE_DIFF
+    s_shadow = heap_caps_calloc(FB_W * FB_H, sizeof(lv_color_t), MALLOC_CAP_8BIT);
+    s_staging[0] = heap_caps_malloc(STAGING_PX * sizeof(lv_color_t), MALLOC_CAP_DMA);
+    s_staging[1] = heap_caps_malloc(STAGING_PX * sizeof(lv_color_t), MALLOC_CAP_DMA);
+    assert(s_shadow && s_staging[0] && s_staging[1]);
+    ESP_LOGI(TAG, "Tile-diff shadow framebuffer %dx%d, %dpx tiles", FB_W, FB_H, TILE);
+#endif
+
     ESP_LOGI(TAG, "Register display driver to LVGL");
     lv_disp_drv_init(&disp_drv);
     disp_drv.hor_res = LCD_H_RES;
@@ -173,6 +519,7 @@ lv_obj_t *display_lvgl_init_scr(void)
     disp_drv.user_data = panel_handle;
     lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
 
+#ifndef CONFIG_LV_TICK_CUSTOM
     ESP_LOGI(TAG, "Install LVGL tick timer");
     // Tick interface for LVGL (using esp_timer to generate 2ms periodic event)
     const esp_timer_create_args_t lvgl_tick_timer_args = {
@@ -181,12 +528,19 @@ lv_obj_t *display_lvgl_init_scr(void)
     };
     ESP_ERROR_CHECK(esp_timer_create(&lvgl_tick_timer_args, &s_lvgl_tick_timer));
     ESP_ERROR_CHECK(esp_timer_start_periodic(s_lvgl_tick_timer, LVGL_TICK_PERIOD_MS * 1000));
+#endif
 
     lv_obj_t *scr = lv_disp_get_scr_act(disp);
     ESP_LOGI(TAG, "LVGL screen created.");
 
     s_panel_handle = panel_handle;
 
+    s_flush_stat = perf_register("disp_flush", "B/s");
+    s_render_stat = perf_register("disp_render", "us/s");
+    s_wakeup_stat = perf_register("disp_wakeups", "/s");
+    s_pixels_stat = perf_register("access_pixels", "us");
+    s_stats_start = esp_timer_get_time();
+
     return scr;
 }
 
@@ -202,10 +556,14 @@ void display_lvgl_disp_off(bool off)
   }
 
   if (off) {
+#ifndef CONFIG_LV_TICK_CUSTOM
     ESP_ERROR_CHECK(esp_timer_stop(s_lvgl_tick_timer));
+#endif
     vTaskSuspend(display_task);
   } else {
+#ifndef CONFIG_LV_TICK_CUSTOM
     ESP_ERROR_CHECK(esp_timer_start_periodic(s_lvgl_tick_timer, LVGL_TICK_PERIOD_MS * 1000));
+#endif
     vTaskResume(display_task);
   }
 }
@@ -2,9 +2,14 @@
 #define _DISPLAY_LVGL_H
 
 #include "lvgl.h"
+#include "perf.h"
 
 lv_obj_t *display_lvgl_init_scr(void);
-void display_lvgl_periodic(void);
+uint32_t display_lvgl_periodic(void);
+void display_lvgl_sample_stats(void);
+void display_lvgl_blit(const lv_color_t *frame, int64_t t0);
+void display_lvgl_release(void);
+void display_lvgl_frame_stats(perf_stat_t *bytes, perf_stat_t *time);
 
 void display_lvgl_disp_off(bool off);
 
@@ -44,8 +44,12 @@
 #include "esp_system.h"
 #include "esp_log.h"
 #include "esp_task_wdt.h"
+#include "esp_timer.h"
 #include "system.h"
+#include "perf.h"
+#include "pm_ctl.h"
 #include "display_lvgl.h"
+#include "display_access.h"
 #include "lvgl.h"
 #include "main_task.h"
 #include "beep_task.h"
@@ -61,6 +65,8 @@ static const char *TAG = "display_task";
 
 #define DISPLAY_QUEUE_DEPTH 4
 #define DISPLAY_EVT_BUF_SIZE 32
+#define DISPLAY_POLL_MS 10
+#define DISPLAY_BUTTON_DEBOUNCE_MS 30
 
 typedef enum {
     DISP_CMD_OTA_STATUS,
@@ -73,6 +79,7 @@ typedef enum {
     DISP_CMD_ALLOWED_MSG,
     DISP_CMD_DOOR_STATE,
     DISP_CMD_SHOW_SCREEN,
+    DISP_CMD_MAX
 } display_cmd_t;
 
 typedef struct display_evt {
@@ -94,12 +101,91 @@ typedef struct display_evt {
     union {
         int progress;
         lv_scr_load_anim_t anim;
+        int64_t time_us;
     } extparams;
 } display_evt_t;
 
 static lv_obj_t *s_scr = NULL;
 
+//
+// Screens.  Idle, access and blank are up most of the time and stay
+// resident.  With DISPLAY_LAZY_SCREENS the others are built when first
+// shown and deleted once a load animation has taken them off the panel,
+// so the 16K LVGL heap isn't spent on objects shown a few seconds a day.
+// What those screens display lives in plain structs in their ui_*.c, so
+// a rebuilt screen comes up current.
+//
+typedef struct {
+    lv_obj_t *(*create)(void);
+    bool lazy;
+    lv_obj_t *scr;
+} display_screen_t;
+
+static display_screen_t s_screens[SCREEN_MAX] = {
+    [SCREEN_BLANK]  = { ui_blank_create,  false },
+    [SCREEN_SPLASH] = { ui_splash_create, true },
+    [SCREEN_IDLE]   = { ui_idle_create,   false },
+    [SCREEN_ACCESS] = { ui_access_create, false },
+    [SCREEN_INFO]   = { ui_info_create,   true },
+    [SCREEN_OTA]    = { ui_ota_create,    true },
+};
+
+static display_mem_t s_mem;
+static perf_stat_t *s_mem_stat = NULL;
+
 static QueueHandle_t m_q;
+
+//
+// Latest-value mailboxes.  Each status type has one slot holding the most
+// recent event; posting overwrites the slot, sets its dirty bit and notifies
+// the display task, so senders never block and rapid updates (ACL download
+// progress, MQTT activity, RSSI) coalesce into a single render.  The network
+// status has two independent values (MAC and IP) so it gets two slots.
+//
+#define DISP_SLOT_NET_IP DISP_CMD_MAX
+#define DISP_NUM_SLOTS (DISP_CMD_MAX + 1)
+
+static display_evt_t s_slots[DISP_NUM_SLOTS];
+static uint32_t s_dirty = 0;
+static portMUX_TYPE s_slots_mux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t s_display_task = NULL;
+
+// time senders spend handing an update to the display task
+static perf_stat_t *s_post_stat;
+
+static inline int display_slot(const display_evt_t *evt)
+{
+    if (evt->cmd == DISP_CMD_NET_STATUS && evt->params.net_status == NET_STATUS_CUR_IP)
+        return DISP_SLOT_NET_IP;
+    return evt->cmd;
+}
+
+static void display_slot_put(const display_evt_t *evt)
+{
+    int slot = display_slot(evt);
+
+    portENTER_CRITICAL(&s_slots_mux);
+    memcpy(&s_slots[slot], evt, sizeof(display_evt_t));
+    s_dirty |= (1 << slot);
+    portEXIT_CRITICAL(&s_slots_mux);
+}
+
+static BaseType_t display_post(const display_evt_t *evt)
+{
+    BaseType_t r = pdTRUE;
+    int64_t t0 = esp_timer_get_time();
+
+#ifdef DISPLAY_MAILBOX
+    display_slot_put(evt);
+    if (s_display_task)
+        xTaskNotifyGive(s_display_task);
+#else
+    r = xQueueSendToBack(m_q, evt, 250 / portTICK_PERIOD_MS);
+#endif
+
+    perf_record(s_post_stat, esp_timer_get_time() - t0);
+    return r;
+}
 #endif
 
 
@@ -110,7 +196,7 @@ BaseType_t display_ota_status(ota_status_t status, int progress)
     evt.cmd = DISP_CMD_OTA_STATUS;
     evt.params.ota_status = status;
     evt.extparams.progress = progress;
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return display_post(&evt);
 }
 #else
 { return -1; }
@@ -123,7 +209,7 @@ BaseType_t display_wifi_status(wifi_status_t status)
     evt.cmd = DISP_CMD_WIFI_STATUS;
     evt.params.wifi_status = status;
 
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return display_post(&evt);
 }
 #else
 { return -1; }
@@ -137,7 +223,7 @@ BaseType_t display_net_status(net_status_t status, char* buf)
     evt.params.net_status = status;
     strncpy(evt.buf, buf, DISPLAY_EVT_BUF_SIZE);
 
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return display_post(&evt);
 }
 #else
 { return -1; }
@@ -150,7 +236,7 @@ BaseType_t display_wifi_rssi(int16_t rssi)
     display_evt_t evt;
     evt.cmd = DISP_CMD_WIFI_RSSI;
     evt.params.rssi = rssi;
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return display_post(&evt);
 }
 #else
 { return -1; }
@@ -163,7 +249,7 @@ BaseType_t display_power_status(power_status_t status)
     display_evt_t evt;
     evt.cmd = DISP_CMD_POWER_STATUS;
     evt.params.power_status = status;
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return display_post(&evt);
 }
 #else
 { return -1; }
@@ -177,7 +263,7 @@ BaseType_t display_acl_status(acl_status_t status, int progress)
     evt.cmd = DISP_CMD_ACL_STATUS;
     evt.params.acl_status = status;
     evt.extparams.progress = progress;
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return display_post(&evt);
 }
 #else
 { return -1; }
@@ -190,21 +276,23 @@ BaseType_t display_mqtt_status(mqtt_status_t status)
     display_evt_t evt;
     evt.cmd = DISP_CMD_MQTT_STATUS;
     evt.params.mqtt_status = status;
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return display_post(&evt);
 }
 #else
 { return -1; }
 #endif
 
-BaseType_t display_allowed_msg(char *msg, uint8_t allowed)
+BaseType_t display_allowed_msg(char *msg, access_result_t result)
 #ifdef DISPLAY_ENABLED
 {
     display_evt_t evt;
     evt.cmd = DISP_CMD_ALLOWED_MSG;
-    evt.params.allowed = allowed;
-    strncpy(evt.buf, msg, DISPLAY_EVT_BUF_SIZE);
+    evt.params.allowed = result;
+    evt.extparams.time_us = esp_timer_get_time();
+    strncpy(evt.buf, msg, DISPLAY_EVT_BUF_SIZE - 1);
+    evt.buf[DISPLAY_EVT_BUF_SIZE - 1] = '\0';
 
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return display_post(&evt);
 }
 #else
 { return -1; }
@@ -217,7 +305,7 @@ BaseType_t display_door_state(bool door_open)
     display_evt_t evt;
     evt.cmd = DISP_CMD_DOOR_STATE;
     evt.params.door_open = door_open;
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return display_post(&evt);
 }
 #else
 { return -1; }
@@ -232,24 +320,80 @@ BaseType_t display_show_screen(screen_t screen, lv_scr_load_anim_t anim)
     evt.extparams.anim = anim;
     evt.cmd = DISP_CMD_SHOW_SCREEN;
 
-    return xQueueSendToBack(m_q, &evt, 250 / portTICK_PERIOD_MS);
+    return display_post(&evt);
 }
 #else
 { return -1; }
 #endif
 
 
+void display_get_mem(display_mem_t *mem)
+#ifdef DISPLAY_ENABLED
+{
+    *mem = s_mem;
+}
+#else
+{ memset(mem, 0, sizeof(*mem)); }
+#endif
+
+
+#ifdef DISPLAY_ENABLED
+// front panel button edges wake the display task instead of it polling
+static void IRAM_ATTR display_button_isr(void *arg)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (s_display_task)
+        vTaskNotifyGiveFromISR(s_display_task, &woken);
+    if (woken)
+        portYIELD_FROM_ISR();
+}
+#endif
+
+// (re)arm the button edge interrupt; light sleep repurposes the pin as a
+// level wakeup source, so this is also called on wake
+void display_button_arm()
+#ifdef DISPLAY_ENABLED
+{
+    gpio_wakeup_disable(GPIO_PIN_FP_BUTTON);
+    gpio_set_intr_type(GPIO_PIN_FP_BUTTON, GPIO_INTR_ANYEDGE);
+    gpio_intr_enable(GPIO_PIN_FP_BUTTON);
+}
+#else
+{ }
+#endif
+
 void display_init()
 #ifdef DISPLAY_ENABLED
 {
     gpio_set_direction(GPIO_PIN_FP_BUTTON, GPIO_MODE_INPUT);
     gpio_pullup_en(GPIO_PIN_FP_BUTTON);
 
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG, "Could not install GPIO ISR service: %s", esp_err_to_name(err));
+    }
+    gpio_isr_handler_add(GPIO_PIN_FP_BUTTON, display_button_isr, NULL);
+    display_button_arm();
+
+#ifndef DISPLAY_MAILBOX
     m_q = xQueueCreate(DISPLAY_QUEUE_DEPTH, sizeof(display_evt_t));
     if (m_q == NULL) {
         ESP_LOGE(TAG, "FATAL: Cannot create display queue!");
     }
+#endif
 
+    s_post_stat = perf_register("display_post", "us");
+}
+#else
+{ }
+#endif
+
+// SPI panel and LVGL bring-up, kept separate from display_init() so the
+// queue exists early and this slower stage can overlap ACL validation
+void display_init_panel()
+#ifdef DISPLAY_ENABLED
+{
     display_lvgl_init_scr();
 }
 #else
@@ -257,120 +401,287 @@ void display_init()
 #endif
 
 
+#ifdef DISPLAY_ENABLED
+// per-frame SPI cost is tracked separately for the screens that matter
+typedef enum {
+    FRAME_STATS_IDLE,
+    FRAME_STATS_ACCESS,
+    FRAME_STATS_OTA,
+    FRAME_STATS_OTHER,
+    FRAME_STATS_MAX
+} frame_stats_t;
+
+static const char *s_frame_bytes_names[FRAME_STATS_MAX] = {
+    "frame_bytes_idle", "frame_bytes_access", "frame_bytes_ota", "frame_bytes_other"
+};
+static const char *s_frame_time_names[FRAME_STATS_MAX] = {
+    "frame_us_idle", "frame_us_access", "frame_us_ota", "frame_us_other"
+};
+
+static void display_select_frame_stats(lv_obj_t *scr)
+{
+    frame_stats_t i = FRAME_STATS_OTHER;
+
+    if (scr == s_screens[SCREEN_IDLE].scr)
+        i = FRAME_STATS_IDLE;
+    else if (scr == s_screens[SCREEN_ACCESS].scr || scr == display_access_screen())
+        i = FRAME_STATS_ACCESS;
+    else if (scr == s_screens[SCREEN_OTA].scr)
+        i = FRAME_STATS_OTA;
+
+    display_lvgl_frame_stats(perf_register(s_frame_bytes_names[i], "B"),
+                             perf_register(s_frame_time_names[i], "us"));
+}
+
+static void display_mem_sample(bool steady)
+{
+    lv_mem_monitor_t mon;
+    uint8_t screens = 0;
+
+    lv_mem_monitor(&mon);
+    for (int i = 0; i < SCREEN_MAX; i++) {
+        if (s_screens[i].scr)
+            screens++;
+    }
+
+    s_mem.total = mon.total_size;
+    s_mem.used = mon.total_size - mon.free_size;
+    s_mem.peak = mon.max_used;
+    s_mem.frag_pct = mon.frag_pct;
+    s_mem.screens = screens;
+    if (steady)
+        s_mem.steady = s_mem.used;
+}
+
+static lv_obj_t *display_screen(screen_t id)
+{
+    display_screen_t *s = &s_screens[id];
+
+    if (s->scr == NULL) {
+        s->scr = s->create();
+        display_mem_sample(false);
+        ESP_LOGD(TAG, "built screen %d, LVGL heap %u used, peak %u", id, s_mem.used, s_mem.peak);
+    }
+    return s->scr;
+}
+
+#ifdef DISPLAY_LAZY_SCREENS
+// delete lazily built screens that are no longer shown; wait for any load
+// animation to finish since it still draws the outgoing screen
+static void display_reap_screens(void)
+{
+    lv_obj_t *act = lv_scr_act();
+    bool reaped = false;
+    bool shown = false;
+
+    if (lv_disp_get_default()->prev_scr != NULL)
+        return;
+
+    for (int i = 0; i < SCREEN_MAX; i++) {
+        display_screen_t *s = &s_screens[i];
+
+        if (!s->lazy || s->scr == NULL)
+            continue;
+
+        if (s->scr == act) {
+            shown = true;
+        } else {
+            lv_obj_del(s->scr);
+            s->scr = NULL;
+            reaped = true;
+        }
+    }
+
+    if (reaped) {
+        // only the resident screens left: that's the steady state
+        display_mem_sample(!shown);
+        ESP_LOGD(TAG, "deleted hidden screens, LVGL heap %u used", s_mem.used);
+    }
+}
+#endif
+
+static void display_load_screen(lv_obj_t *scr, lv_scr_load_anim_t anim)
+{
+    if (scr == s_screens[SCREEN_ACCESS].scr && display_access_screen())
+      scr = display_access_screen();
+
+    if (s_scr != scr) {
+      // leaving a blitted access frame, LVGL owns the panel again
+      display_lvgl_release();
+      display_select_frame_stats(scr);
+      lv_scr_load_anim(scr, anim, anim == LV_SCR_LOAD_ANIM_NONE ? 0 : 500, 0, false);
+      s_scr = scr;
+      if (scr == s_screens[SCREEN_SPLASH].scr)
+        ui_splash_reset();
+    }
+}
+
+static void display_apply(const display_evt_t *evt)
+{
+    switch(evt->cmd) {
+    case DISP_CMD_OTA_STATUS:
+        ui_ota_set_status(evt->params.ota_status);
+        if (evt->params.ota_status == OTA_STATUS_DOWNLOADING)
+          ui_ota_set_download_progress(evt->extparams.progress);
+        break;
+    case DISP_CMD_WIFI_STATUS:
+        ui_idle_set_wifi_status(evt->params.wifi_status);
+        break;
+    case DISP_CMD_WIFI_RSSI:
+        ui_idle_set_rssi(evt->params.rssi);
+        break;
+    case DISP_CMD_NET_STATUS:
+        ui_info_set_status(evt->params.net_status, (char *)evt->buf);
+        break;
+    case DISP_CMD_ACL_STATUS:
+        ui_idle_set_acl_status(evt->params.acl_status);
+        if (evt->params.acl_status == ACL_STATUS_DOWNLOADING)
+          ui_idle_set_acl_download_progress(evt->extparams.progress);
+        break;
+    case DISP_CMD_MQTT_STATUS:
+        ui_idle_set_mqtt_status(evt->params.mqtt_status);
+        break;
+    case DISP_CMD_POWER_STATUS:
+        ui_idle_set_power_status(evt->params.power_status);
+        break;
+    case DISP_CMD_ALLOWED_MSG:
+        if (display_access_screen()) {
+            // load first (releases any earlier hold), then blit over it
+            display_load_screen(display_access_screen(), LV_SCR_LOAD_ANIM_NONE);
+            display_access_show(evt->params.allowed, (char *)evt->buf, evt->extparams.time_us);
+        } else {
+            ui_access_set_user((char *)evt->buf, evt->params.allowed == ACCESS_RESULT_ALLOWED);
+            display_load_screen(display_screen(SCREEN_ACCESS), LV_SCR_LOAD_ANIM_NONE);
+        }
+        break;
+    case DISP_CMD_DOOR_STATE:
+        ui_idle_set_door_state(evt->params.door_open);
+        break;
+    case DISP_CMD_SHOW_SCREEN:
+        if (evt->params.screen < SCREEN_MAX)
+            display_load_screen(display_screen(evt->params.screen), evt->extparams.anim);
+        break;
+    default:
+        break;
+    }
+}
+
+// Status slots first, then the access message, then the screen change, so a
+// newly loaded screen never shows stale content for a frame.
+static const uint8_t s_slot_order[DISP_NUM_SLOTS] = {
+    DISP_CMD_OTA_STATUS,
+    DISP_CMD_WIFI_STATUS,
+    DISP_CMD_WIFI_RSSI,
+    DISP_CMD_NET_STATUS,
+    DISP_SLOT_NET_IP,
+    DISP_CMD_ACL_STATUS,
+    DISP_CMD_MQTT_STATUS,
+    DISP_CMD_POWER_STATUS,
+    DISP_CMD_DOOR_STATE,
+    DISP_CMD_ALLOWED_MSG,
+    DISP_CMD_SHOW_SCREEN,
+};
+
+static void display_process_slots(void)
+{
+    display_evt_t slots[DISP_NUM_SLOTS];
+    uint32_t dirty;
+
+    portENTER_CRITICAL(&s_slots_mux);
+    dirty = s_dirty;
+    s_dirty = 0;
+    for (int i = 0; i < DISP_NUM_SLOTS; i++) {
+        if (dirty & (1 << i))
+            memcpy(&slots[i], &s_slots[i], sizeof(display_evt_t));
+    }
+    portEXIT_CRITICAL(&s_slots_mux);
+
+    for (int i = 0; i < DISP_NUM_SLOTS; i++) {
+        int slot = s_slot_order[i];
+        if (dirty & (1 << slot))
+            display_apply(&slots[slot]);
+    }
+}
+
+#endif
+
+#ifdef DISPLAY_ENABLED
+//
+// Display frame-rate governor.  lv_timer_handler() reports how long until
+// its next timer (refresh, animation, blink) is due; when nothing on screen
+// is changing LVGL pauses its refresh and animation timers and that can be
+// "never".  The task then sleeps until that deadline or the 1 s heartbeat,
+// and anything that changes the UI (display_post, button ISR) wakes it with
+// a task notification.  Without DISPLAY_GOVERNOR the old fixed 10 ms poll
+// is used, for before/after comparison with the "cpu" console command.
+//
+static TickType_t display_wait_ticks(uint32_t next_ms, portTickType last_heartbeat_tick, bool button_pending)
+{
+    const TickType_t heartbeat = 1000 / portTICK_PERIOD_MS;
+    TickType_t elapsed = xTaskGetTickCount() - last_heartbeat_tick;
+    TickType_t wait = (elapsed >= heartbeat) ? 0 : heartbeat - elapsed;
+
+#ifdef DISPLAY_GOVERNOR
+    if (next_ms / portTICK_PERIOD_MS < wait)
+        wait = next_ms / portTICK_PERIOD_MS;
+#else
+    if (wait > DISPLAY_POLL_MS / portTICK_PERIOD_MS)
+        wait = DISPLAY_POLL_MS / portTICK_PERIOD_MS;
+#endif
+
+    if (button_pending && wait > DISPLAY_BUTTON_DEBOUNCE_MS / portTICK_PERIOD_MS)
+        wait = DISPLAY_BUTTON_DEBOUNCE_MS / portTICK_PERIOD_MS;
+
+    // always block for at least a tick so lower priority tasks get to run
+    return wait ? wait : 1;
+}
+#endif
+
 void display_task(void *pvParameters)
 #ifdef DISPLAY_ENABLED
 {
     portTickType init_tick = xTaskGetTickCount();
     portTickType last_heartbeat_tick = init_tick;
+    portTickType last_button_tick = init_tick;
     int button=0, last_button=0;
 
-    lv_obj_t *scr_splash = ui_splash_create();
+    for (int i = 0; i < SCREEN_MAX; i++) {
+#ifdef DISPLAY_LAZY_SCREENS
+        if (s_screens[i].lazy)
+            continue;
+#endif
+        display_screen(i);
+    }
+    display_access_init();
+
+    display_mem_sample(true);
+    s_mem_stat = perf_register("lvgl_mem_used", "B");
+    ESP_LOGI(TAG, "screens built, LVGL heap %u of %u used", s_mem.used, s_mem.total);
 
-    lv_obj_t *scr_blank = ui_blank_create();
-    lv_obj_t *scr_idle = ui_idle_create();
-    lv_obj_t *scr_access = ui_access_create();
-    lv_obj_t *scr_info = ui_info_create();
-    lv_obj_t *scr_ota = ui_ota_create();
+    s_display_task = xTaskGetCurrentTaskHandle();
 
     esp_task_wdt_add(NULL);
 
     while(1) {
-        display_evt_t evt;
-
+        portTickType now = xTaskGetTickCount();
+        bool button_pending = false;
         button = gpio_get_level(GPIO_PIN_FP_BUTTON);
 
         if (button != last_button) {
-            ESP_LOGD(TAG, "Button now=%d", button);
-            if (button == 0) {
-              main_task_event(MAIN_EVT_UI_BUTTON_PRESS);
-            }
-        }
-
-        last_button = button;
-
-        esp_task_wdt_reset();
-
-        display_lvgl_periodic();
-
-        if (xQueueReceive(m_q, &evt, (10 / portTICK_PERIOD_MS)) == pdPASS) {
-            switch(evt.cmd) {
-            case DISP_CMD_OTA_STATUS:
-                ui_ota_set_status(evt.params.ota_status);
-                if (evt.params.ota_status == OTA_STATUS_DOWNLOADING)
-                  ui_ota_set_download_progress(evt.extparams.progress);
-                break;
-            case DISP_CMD_WIFI_STATUS:
-                ui_idle_set_wifi_status(evt.params.wifi_status);
-                break;
-            case DISP_CMD_WIFI_RSSI:
-                ui_idle_set_rssi(evt.params.rssi);
-                break;
-            case DISP_CMD_NET_STATUS:
-                ui_info_set_status(evt.params.net_status, evt.buf);
-                break;
-            case DISP_CMD_ACL_STATUS:
-                ui_idle_set_acl_status(evt.params.acl_status);
-                if (evt.params.acl_status == ACL_STATUS_DOWNLOADING)
-                  ui_idle_set_acl_download_progress(evt.extparams.progress);
-                break;
-            case DISP_CMD_MQTT_STATUS:
-                ui_idle_set_mqtt_status(evt.params.mqtt_status);
-                break;
-            case DISP_CMD_POWER_STATUS:
-                ui_idle_set_power_status(evt.params.power_status);
-                break;
-            case DISP_CMD_ALLOWED_MSG:
-                ui_access_set_user(evt.buf, evt.params.allowed);
-                break;
-            case DISP_CMD_DOOR_STATE:
-                ui_idle_set_door_state(evt.params.door_open);
-                break;
-            case DISP_CMD_SHOW_SCREEN:
-                switch (evt.params.screen) {
-                  case SCREEN_BLANK:
-                    if (s_scr != scr_blank) {
-                      lv_scr_load_anim(scr_blank, evt.extparams.anim, 500, 0, false);
-                      s_scr = scr_blank;
-                    }
-                    break;
-                  case SCREEN_SPLASH:
-                    if (s_scr != scr_splash) {
-                      lv_scr_load_anim(scr_splash, evt.extparams.anim, 500, 0, false);
-                      s_scr = scr_splash;
-                      ui_splash_reset();
-                    }
-                    break;
-                  case SCREEN_IDLE:
-                    if (s_scr != scr_idle) {
-                      lv_scr_load_anim(scr_idle, evt.extparams.anim, 500, 0, false);
-                      s_scr = scr_idle;
-                    }
-                    break;
-                  case SCREEN_ACCESS:
-                    if (s_scr != scr_access) {
-                      lv_scr_load_anim(scr_access, evt.extparams.anim, 500, 0, false);
-                      s_scr = scr_access;
-                    }
-                    break;
-                  case SCREEN_INFO:
-                    if (s_scr != scr_info) {
-                      lv_scr_load_anim(scr_info, evt.extparams.anim, 500, 0, false);
-                      s_scr = scr_info;
-                    }
-                    break;
-                  case SCREEN_OTA:
-                    if (s_scr != scr_ota) {
-                      lv_scr_load_anim(scr_ota, evt.extparams.anim, 500, 0, false);
-                      s_scr = scr_ota;
-                    }
-                    break;
+            if (now - last_button_tick >= DISPLAY_BUTTON_DEBOUNCE_MS / portTICK_PERIOD_MS) {
+                ESP_LOGD(TAG, "Button now=%d", button);
+                if (button == 0) {
+                  main_task_event(MAIN_EVT_UI_BUTTON_PRESS);
                 }
-                break;
+                last_button = button;
+                last_button_tick = now;
+            } else {
+                // still bouncing, look again once the debounce window ends
+                button_pending = true;
             }
         }
 
-        portTickType now = xTaskGetTickCount();
-
+        esp_task_wdt_reset();
 
         if (now - last_heartbeat_tick >= (1000/portTICK_PERIOD_MS)) {
             // heartbeat
@@ -379,17 +690,48 @@ void display_task(void *pvParameters)
             time_t tnow;
             struct tm timeinfo;
 
+            // TZ is set once by the config subsystem, not on every tick
             time(&tnow);
-            setenv("TZ", "EST5EDT,M3.2.0/2,M11.1.0", 1);
-            tzset();
             localtime_r(&tnow, &timeinfo);
             strftime(strftime_buf, sizeof(strftime_buf), "%l:%M", &timeinfo);
 
             ui_idle_set_time(strftime_buf);
 
+            display_lvgl_sample_stats();
+            display_mem_sample(false);
+            perf_record(s_mem_stat, s_mem.used);
+
             // strftime_buf is time
             last_heartbeat_tick = now;
         }
+
+        // rendering at full speed; the idle clock would stretch each frame
+        pm_busy_begin();
+        display_process_slots();
+        uint32_t next_ms = display_lvgl_periodic();
+        pm_busy_end();
+#ifdef DISPLAY_LAZY_SCREENS
+        display_reap_screens();
+#endif
+
+        // sleep until LVGL's next timer is due, a UI update or button edge
+        // notifies us, or the next heartbeat is due
+        TickType_t wait = display_wait_ticks(next_ms, last_heartbeat_tick, button_pending);
+
+#ifdef DISPLAY_MAILBOX
+        ulTaskNotifyTake(pdTRUE, wait);
+#else
+        // legacy path: drain the queue into the slots, then render the same
+        // way; button edges only wake the mailbox path, so keep polling
+        display_evt_t evt;
+        if (wait > DISPLAY_POLL_MS / portTICK_PERIOD_MS)
+            wait = DISPLAY_POLL_MS / portTICK_PERIOD_MS;
+        if (xQueueReceive(m_q, &evt, wait) == pdPASS) {
+            do {
+                display_slot_put(&evt);
+            } while (xQueueReceive(m_q, &evt, 0) == pdPASS);
+        }
+#endif
     }
 }
 #else
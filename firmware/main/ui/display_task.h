@@ -47,10 +47,19 @@ typedef int BaseType_t;
 
 void display_task(void *pvParameters);
 void display_init();
+void display_init_panel();
+void display_button_arm();
 
 BaseType_t display_wifi_msg(char *msg);
 BaseType_t display_wifi_rssi(int16_t rssi);
-BaseType_t display_allowed_msg(char *msg, uint8_t allowed);
+typedef enum {
+    ACCESS_RESULT_DENIED,
+    ACCESS_RESULT_ALLOWED,
+    ACCESS_RESULT_UNKNOWN,
+    ACCESS_RESULT_MAX
+} access_result_t;
+
+BaseType_t display_allowed_msg(char *msg, access_result_t result);
 
 typedef enum {
     SCREEN_BLANK,
@@ -58,11 +67,24 @@ typedef enum {
     SCREEN_IDLE,
     SCREEN_ACCESS,
     SCREEN_INFO,
-    SCREEN_OTA
+    SCREEN_OTA,
+    SCREEN_MAX
 } screen_t;
 
 BaseType_t display_show_screen(screen_t screen, lv_scr_load_anim_t anim);
 
+// LVGL heap usage, sampled by the display task
+typedef struct {
+    uint32_t total;
+    uint32_t used;          // at the last heartbeat
+    uint32_t peak;          // high-water mark since boot
+    uint32_t steady;        // with only the resident screens built
+    uint8_t frag_pct;
+    uint8_t screens;        // screens currently built
+} display_mem_t;
+
+void display_get_mem(display_mem_t *mem);
+
 
 typedef enum {
     OTA_STATUS_INIT,
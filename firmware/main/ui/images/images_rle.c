@@ -0,0 +1,897 @@
+// Generated by tools/mkimages.py from the PNGs in this directory, do not edit.
+// See ui/ui_img.h for the format.
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+#include "../ui_img.h"
+
+static const uint8_t s_row_pool[11140] = {
+  0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x46, 0xff, 0xff, 0x86,
+  0xf8, 0xf6, 0x8e, 0xed, 0xc9, 0xe4, 0x87, 0xe4, 0x0a, 0xed, 0x12, 0xf6, 0xde, 0xff, 0x7f, 0xff,
+  0xff, 0x51, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x45, 0xff, 0xff, 0x80, 0xf1, 0xed, 0x45, 0x25, 0xe4,
+  0x81, 0x87, 0xe4, 0x3a, 0xf7, 0x7f, 0xff, 0xff, 0x50, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x44, 0xff,
+  0xff, 0x80, 0x75, 0xf6, 0x48, 0x25, 0xe4, 0x80, 0x7c, 0xff, 0x7f, 0xff, 0xff, 0x4f, 0xff, 0xff,
+  0x6b, 0xff, 0xff, 0x81, 0x7e, 0xef, 0xbe, 0xf7, 0x55, 0xff, 0xff, 0x81, 0xde, 0xff, 0x45, 0xe4,
+  0x48, 0x25, 0xe4, 0x80, 0x2b, 0xed, 0x52, 0xff, 0xff, 0x80, 0xbd, 0xff, 0x5a, 0xff, 0xff, 0x80,
+  0xbd, 0xff, 0x5f, 0xff, 0xff, 0x47, 0xff, 0xff, 0x85, 0x7e, 0xef, 0x37, 0x7c, 0x35, 0x53, 0x15,
+  0x53, 0x55, 0x5b, 0x9a, 0xad, 0x45, 0xff, 0xff, 0x84, 0x78, 0x84, 0x35, 0x5b, 0x15, 0x53, 0x55,
+  0x5b, 0x19, 0x95, 0x51, 0xff, 0xff, 0x83, 0x3b, 0xbe, 0xf2, 0x29, 0x33, 0x32, 0xbc, 0xd6, 0x54,
+  0xff, 0xff, 0x80, 0x54, 0xf6, 0x4a, 0x25, 0xe4, 0x80, 0x7b, 0xff, 0x41, 0xff, 0xff, 0x82, 0x1d,
+  0xdf, 0xf7, 0x73, 0x98, 0x8c, 0x4a, 0xff, 0xff, 0x83, 0x7b, 0xff, 0xa7, 0xe4, 0x25, 0xe4, 0xf1,
+  0xed, 0x58, 0xff, 0xff, 0x82, 0xd0, 0xed, 0x25, 0xe4, 0x2b, 0xed, 0x5e, 0xff, 0xff, 0x47, 0xff,
+  0xff, 0x80, 0x57, 0x84, 0x44, 0xf2, 0x29, 0x80, 0x7e, 0xef, 0x43, 0xff, 0xff, 0x80, 0xfb, 0xb5,
+  0x44, 0xf2, 0x29, 0x80, 0x9c, 0xce, 0x50, 0xff, 0xff, 0x80, 0x55, 0x5b, 0x41, 0xf2, 0x29, 0x80,
+  0x57, 0x7c, 0x54, 0xff, 0xff, 0x80, 0x8e, 0xed, 0x4a, 0x25, 0xe4, 0x80, 0x94, 0xfe, 0x41, 0xff,
+  0xff, 0x80, 0x76, 0x63, 0x41, 0xf2, 0x29, 0x80, 0xba, 0xad, 0x49, 0xff, 0xff, 0x80, 0x12, 0xee,
+  0x42, 0x25, 0xe4, 0x80, 0xde, 0xff, 0x57, 0xff, 0xff, 0x80, 0x45, 0xe4, 0x41, 0x25, 0xe4, 0x80,
+  0x5b, 0xff, 0x5d, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0xf7, 0x73, 0x44, 0xf2, 0x29, 0x80, 0x9a,
+  0xad, 0x43, 0xff, 0xff, 0x80, 0xf7, 0x73, 0x44, 0xf2, 0x29, 0x80, 0xdb, 0xb5, 0x50, 0xff, 0xff,
+  0x80, 0x96, 0x63, 0x41, 0xf2, 0x29, 0x80, 0x78, 0x84, 0x54, 0xff, 0xff, 0x80, 0x6d, 0xed, 0x4a,
+  0x25, 0xe4, 0x80, 0x73, 0xfe, 0x41, 0xff, 0xff, 0x80, 0xf5, 0x4a, 0x41, 0xf2, 0x29, 0x80, 0xd8,
+  0x94, 0x49, 0xff, 0xff, 0x80, 0xf1, 0xed, 0x42, 0x25, 0xe4, 0x80, 0x7c, 0xff, 0x56, 0xff, 0xff,
+  0x81, 0xde, 0xff, 0x87, 0xe4, 0x41, 0x25, 0xe4, 0x80, 0x5b, 0xff, 0x5d, 0xff, 0xff, 0x47, 0xff,
+  0xff, 0x80, 0x37, 0x7c, 0x44, 0xf2, 0x29, 0x80, 0x37, 0x7c, 0x43, 0xff, 0xff, 0x80, 0x94, 0x42,
+  0x44, 0xf2, 0x29, 0x80, 0x1b, 0xbe, 0x50, 0xff, 0xff, 0x80, 0xb6, 0x6b, 0x41, 0xf2, 0x29, 0x80,
+  0x98, 0x84, 0x54, 0xff, 0xff, 0x80, 0xf1, 0xed, 0x4a, 0x25, 0xe4, 0x80, 0x38, 0xff, 0x41, 0xff,
+  0xff, 0x80, 0x35, 0x5b, 0x41, 0xf2, 0x29, 0x80, 0x39, 0x9d, 0x49, 0xff, 0xff, 0x80, 0x11, 0xee,
+  0x42, 0x25, 0xe4, 0x80, 0x9c, 0xff, 0x56, 0xff, 0xff, 0x81, 0xde, 0xff, 0x87, 0xe4, 0x41, 0x25,
+  0xe4, 0x80, 0x5b, 0xff, 0x5d, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0x37, 0x7c, 0x41, 0xf2, 0x29,
+  0x83, 0x53, 0x3a, 0x33, 0x32, 0xf2, 0x29, 0x94, 0x42, 0x42, 0xff, 0xff, 0x80, 0xfd, 0xde, 0x41,
+  0xf2, 0x29, 0x41, 0x33, 0x32, 0x41, 0xf2, 0x29, 0x80, 0x1b, 0xbe, 0x44, 0xff, 0xff, 0x85, 0xdf,
+  0xf7, 0xbc, 0xd6, 0x3b, 0xc6, 0x3b, 0xbe, 0x5c, 0xc6, 0x1d, 0xdf, 0x45, 0xff, 0xff, 0x80, 0xb6,
+  0x6b, 0x41, 0xf2, 0x29, 0x80, 0x98, 0x84, 0x43, 0xff, 0xff, 0x81, 0xbc, 0xce, 0x7c, 0xc6, 0x45,
+  0xff, 0xff, 0x84, 0xdf, 0xf7, 0xbc, 0xce, 0x3b, 0xbe, 0x3b, 0xc6, 0xfd, 0xde, 0x43, 0xff, 0xff,
+  0x80, 0x7b, 0xff, 0x49, 0x25, 0xe4, 0x80, 0xa6, 0xec, 0x41, 0xff, 0xff, 0x81, 0xdf, 0xf7, 0x35,
+  0x53, 0x41, 0xf2, 0x29, 0x81, 0xf9, 0x94, 0xbf, 0xf7, 0x48, 0xff, 0xff, 0x80, 0x11, 0xee, 0x42,
+  0x25, 0xe4, 0x80, 0x9c, 0xff, 0x4c, 0xff, 0xff, 0x85, 0x7b, 0xff, 0xf8, 0xf6, 0xd7, 0xf6, 0xf8,
+  0xf6, 0x3a, 0xf7, 0xde, 0xff, 0x43, 0xff, 0xff, 0x81, 0xde, 0xff, 0x87, 0xe4, 0x41, 0x25, 0xe4,
+  0x85, 0x7c, 0xff, 0xff, 0xff, 0xde, 0xff, 0x39, 0xf7, 0x19, 0xf7, 0x5b, 0xff, 0x48, 0xff, 0xff,
+  0x83, 0x3a, 0xf7, 0xd7, 0xf6, 0xf8, 0xf6, 0x5b, 0xff, 0x4b, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80,
+  0x37, 0x7c, 0x41, 0xf2, 0x29, 0x81, 0xb6, 0x6b, 0x35, 0x5b, 0x41, 0xf2, 0x29, 0x80, 0x1d, 0xdf,
+  0x41, 0xff, 0xff, 0x80, 0x7a, 0xa5, 0x41, 0xf2, 0x29, 0x81, 0x96, 0x63, 0x15, 0x53, 0x41, 0xf2,
+  0x29, 0x80, 0x1b, 0xbe, 0x43, 0xff, 0xff, 0x81, 0x98, 0x84, 0x53, 0x3a, 0x44, 0xf2, 0x29, 0x81,
+  0xf4, 0x4a, 0x5b, 0xc6, 0x43, 0xff, 0xff, 0x80, 0xb6, 0x6b, 0x41, 0xf2, 0x29, 0x80, 0x98, 0x84,
+  0x42, 0xff, 0xff, 0x80, 0x5a, 0xa5, 0x41, 0xf2, 0x29, 0x80, 0x5a, 0xa5, 0x43, 0xff, 0xff, 0x81,
+  0xb8, 0x8c, 0x53, 0x3a, 0x43, 0xf2, 0x29, 0x81, 0x15, 0x53, 0x3b, 0xc6, 0x42, 0xff, 0xff, 0x80,
+  0xaf, 0xed, 0x48, 0x25, 0xe4, 0x83, 0xd6, 0xfe, 0xff, 0xff, 0xfb, 0x8c, 0x53, 0x3a, 0x42, 0xf2,
+  0x29, 0x83, 0x12, 0x2a, 0x13, 0x32, 0x15, 0x53, 0xbe, 0xf7, 0x46, 0xff, 0xff, 0x80, 0x11, 0xee,
+  0x42, 0x25, 0xe4, 0x80, 0x9c, 0xff, 0x4a, 0xff, 0xff, 0x81, 0xb6, 0xf6, 0xe9, 0xe4, 0x44, 0x25,
+  0xe4, 0x81, 0x66, 0xe4, 0xf1, 0xed, 0x42, 0xff, 0xff, 0x86, 0xde, 0xff, 0x87, 0xe4, 0x25, 0xe4,
+  0x46, 0xe4, 0xde, 0xff, 0x75, 0xf6, 0x66, 0xe4, 0x42, 0x25, 0xe4, 0x81, 0xc9, 0xe4, 0xd7, 0xf6,
+  0x44, 0xff, 0xff, 0x81, 0x33, 0xf6, 0x87, 0xe4, 0x43, 0x25, 0xe4, 0x81, 0x87, 0xe4, 0x12, 0xee,
+  0x49, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0x37, 0x7c, 0x41, 0xf2, 0x29, 0x41, 0x98, 0x84, 0x41,
+  0xf2, 0x29, 0x80, 0x7a, 0xa5, 0x41, 0xff, 0xff, 0x80, 0xd6, 0x6b, 0x41, 0xf2, 0x29, 0x81, 0x19,
+  0x95, 0x55, 0x5b, 0x41, 0xf2, 0x29, 0x80, 0x1b, 0xbe, 0x41, 0xff, 0xff, 0x81, 0xdf, 0xf7, 0xf5,
+  0x52, 0x43, 0xf2, 0x29, 0x80, 0x13, 0x32, 0x43, 0xf2, 0x29, 0x80, 0xfd, 0xde, 0x42, 0xff, 0xff,
+  0x80, 0xb6, 0x6b, 0x41, 0xf2, 0x29, 0x80, 0x98, 0x84, 0x41, 0xff, 0xff, 0x80, 0x9a, 0xad, 0x42,
+  0xf2, 0x29, 0x80, 0x19, 0x95, 0x42, 0xff, 0xff, 0x80, 0x15, 0x53, 0x42, 0xf2, 0x29, 0x80, 0x13,
+  0x32, 0x43, 0xf2, 0x29, 0x80, 0x9b, 0xad, 0x42, 0xff, 0xff, 0x80, 0x67, 0xe4, 0x46, 0x25, 0xe4,
+  0x80, 0xad, 0xf5, 0x41, 0xff, 0xff, 0x80, 0x77, 0x5b, 0x46, 0xf2, 0x29, 0x80, 0x7e, 0xef, 0x46,
+  0xff, 0xff, 0x80, 0x11, 0xee, 0x42, 0x25, 0xe4, 0x80, 0x9c, 0xff, 0x49, 0xff, 0xff, 0x80, 0x54,
+  0xf6, 0x43, 0x25, 0xe4, 0x80, 0x46, 0xe4, 0x43, 0x25, 0xe4, 0x80, 0xf1, 0xed, 0x41, 0xff, 0xff,
+  0x84, 0xde, 0xff, 0x87, 0xe4, 0x25, 0xe4, 0x66, 0xe4, 0x0a, 0xed, 0x46, 0x25, 0xe4, 0x80, 0xd7,
+  0xf6, 0x42, 0xff, 0xff, 0x80, 0xf1, 0xed, 0x42, 0x25, 0xe4, 0x81, 0xe9, 0xe4, 0xa8, 0xe4, 0x42,
+  0x25, 0xe4, 0x80, 0x6d, 0xed, 0x48, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0x37, 0x7c, 0x41, 0xf2,
+  0x29, 0x81, 0xd8, 0x8c, 0x3b, 0xc6, 0x41, 0xf2, 0x29, 0x80, 0xb6, 0x6b, 0x41, 0xff, 0xff, 0x80,
+  0x33, 0x32, 0x41, 0xf2, 0x29, 0x81, 0x7c, 0xc6, 0xf4, 0x4a, 0x41, 0xf2, 0x29, 0x80, 0x1b, 0xbe,
+  0x41, 0xff, 0xff, 0x80, 0x59, 0xa5, 0x41, 0xf2, 0x29, 0x85, 0x33, 0x32, 0x1b, 0xbe, 0x9e, 0xef,
+  0xbe, 0xf7, 0x9c, 0xce, 0x53, 0x3a, 0x41, 0xf2, 0x29, 0x80, 0x37, 0x7c, 0x42, 0xff, 0xff, 0x80,
+  0xb6, 0x6b, 0x41, 0xf2, 0x29, 0x82, 0x98, 0x8c, 0xff, 0xff, 0xdb, 0xb5, 0x42, 0xf2, 0x29, 0x80,
+  0xd6, 0x6b, 0x42, 0xff, 0xff, 0x80, 0x37, 0x7c, 0x41, 0xf2, 0x29, 0x84, 0x33, 0x32, 0x1b, 0xbe,
+  0xbe, 0xf7, 0x3e, 0xe7, 0x57, 0x7c, 0x42, 0xf2, 0x29, 0x80, 0x5e, 0xe7, 0x41, 0xff, 0xff, 0x80,
+  0xb6, 0xf6, 0x45, 0x25, 0xe4, 0x80, 0x46, 0xe4, 0x42, 0xff, 0xff, 0x82, 0xbf, 0xf7, 0xfb, 0xb5,
+  0xb4, 0x4a, 0x41, 0xf2, 0x29, 0x82, 0xd6, 0x6b, 0xdb, 0xb5, 0x3d, 0xdf, 0x47, 0xff, 0xff, 0x80,
+  0x11, 0xee, 0x42, 0x25, 0xe4, 0x80, 0x9c, 0xff, 0x48, 0xff, 0xff, 0x80, 0x9d, 0xff, 0x42, 0x25,
+  0xe4, 0x84, 0xf1, 0xed, 0x7c, 0xff, 0xde, 0xff, 0x9c, 0xff, 0x6d, 0xed, 0x41, 0x25, 0xe4, 0x84,
+  0x45, 0xe4, 0xde, 0xff, 0xff, 0xff, 0xde, 0xff, 0x87, 0xe4, 0x42, 0x25, 0xe4, 0x84, 0x66, 0xe4,
+  0x95, 0xf6, 0x3a, 0xf7, 0x95, 0xf6, 0x45, 0xe4, 0x41, 0x25, 0xe4, 0x83, 0x45, 0xe4, 0xde, 0xff,
+  0xff, 0xff, 0x9c, 0xff, 0x41, 0x25, 0xe4, 0x81, 0x87, 0xe4, 0x7b, 0xff, 0x41, 0xff, 0xff, 0x80,
+  0x95, 0xf6, 0x42, 0x25, 0xe4, 0x80, 0x5b, 0xff, 0x47, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0x37,
+  0x7c, 0x41, 0xf2, 0x29, 0x81, 0x77, 0x84, 0xdf, 0xff, 0x41, 0xf2, 0x29, 0x82, 0x53, 0x32, 0xff,
+  0xff, 0xfd, 0xde, 0x41, 0xf2, 0x29, 0x82, 0x35, 0x53, 0xdf, 0xf7, 0x73, 0x3a, 0x41, 0xf2, 0x29,
+  0x80, 0x1b, 0xbe, 0x41, 0xff, 0xff, 0x80, 0x19, 0x95, 0x41, 0xf2, 0x29, 0x80, 0x9c, 0xce, 0x43,
+  0xff, 0xff, 0x80, 0x9a, 0xad, 0x41, 0xf2, 0x29, 0x80, 0x35, 0x53, 0x42, 0xff, 0xff, 0x80, 0xb6,
+  0x6b, 0x41, 0xf2, 0x29, 0x81, 0xba, 0xad, 0x1d, 0xdf, 0x42, 0xf2, 0x29, 0x80, 0x17, 0x7c, 0x42,
+  0xff, 0xff, 0x80, 0x5e, 0xe7, 0x42, 0xf2, 0x29, 0x80, 0x3b, 0xbe, 0x43, 0xff, 0xff, 0x80, 0x15,
+  0x53, 0x41, 0xf2, 0x29, 0x80, 0x78, 0x84, 0x42, 0xff, 0xff, 0x80, 0x87, 0xe4, 0x44, 0x25, 0xe4,
+  0x80, 0xf0, 0xed, 0x44, 0xff, 0xff, 0x80, 0x76, 0x63, 0x41, 0xf2, 0x29, 0x80, 0x9a, 0xad, 0x49,
+  0xff, 0xff, 0x80, 0x11, 0xee, 0x42, 0x25, 0xe4, 0x80, 0x9c, 0xff, 0x48, 0xff, 0xff, 0x80, 0x7c,
+  0xff, 0x41, 0x25, 0xe4, 0x80, 0x8f, 0xed, 0x44, 0xff, 0xff, 0x80, 0x45, 0xe4, 0x41, 0x25, 0xe4,
+  0x83, 0x5a, 0xff, 0xff, 0xff, 0xde, 0xff, 0x87, 0xe4, 0x41, 0x25, 0xe4, 0x81, 0x45, 0xe4, 0x9c,
+  0xff, 0x42, 0xff, 0xff, 0x80, 0x19, 0xf7, 0x42, 0x25, 0xe4, 0x82, 0x74, 0xf6, 0xff, 0xff, 0xf8,
+  0xf6, 0x41, 0x25, 0xe4, 0x80, 0xa8, 0xe4, 0x43, 0xff, 0xff, 0x83, 0x95, 0xf6, 0x87, 0xe4, 0xea,
+  0xec, 0xbd, 0xff, 0x47, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0x37, 0x7c, 0x41, 0xf2, 0x29, 0x82,
+  0xf6, 0x73, 0xff, 0xff, 0xb4, 0x4a, 0x41, 0xf2, 0x29, 0x81, 0xdf, 0xf7, 0xfb, 0xb5, 0x41, 0xf2,
+  0x29, 0x82, 0xb8, 0x8c, 0xff, 0xff, 0x33, 0x32, 0x41, 0xf2, 0x29, 0x80, 0x1b, 0xbe, 0x41, 0xff,
+  0xff, 0x82, 0xdf, 0xf7, 0x59, 0xa5, 0x7c, 0xc6, 0x42, 0xff, 0xff, 0x82, 0x7e, 0xef, 0x1b, 0xbe,
+  0xf6, 0x73, 0x41, 0xf2, 0x29, 0x80, 0xf4, 0x4a, 0x42, 0xff, 0xff, 0x80, 0xb6, 0x6b, 0x41, 0xf2,
+  0x29, 0x81, 0x55, 0x5b, 0x53, 0x3a, 0x41, 0xf2, 0x29, 0x80, 0x96, 0x63, 0x43, 0xff, 0xff, 0x80,
+  0x9a, 0xad, 0x41, 0xf2, 0x29, 0x80, 0xb4, 0x42, 0x44, 0xff, 0xff, 0x80, 0xba, 0xb5, 0x41, 0xf2,
+  0x29, 0x80, 0xf4, 0x52, 0x42, 0xff, 0xff, 0x80, 0x8e, 0xed, 0x44, 0x25, 0xe4, 0x80, 0x7b, 0xff,
+  0x44, 0xff, 0xff, 0x80, 0x35, 0x5b, 0x41, 0xf2, 0x29, 0x80, 0x19, 0x95, 0x49, 0xff, 0xff, 0x80,
+  0x11, 0xee, 0x42, 0x25, 0xe4, 0x80, 0x9c, 0xff, 0x49, 0xff, 0xff, 0x81, 0xf7, 0xf6, 0x74, 0xf6,
+  0x43, 0xff, 0xff, 0x82, 0x39, 0xf7, 0x33, 0xf6, 0x45, 0xe4, 0x41, 0x25, 0xe4, 0x83, 0x19, 0xf7,
+  0xff, 0xff, 0xde, 0xff, 0x87, 0xe4, 0x41, 0x25, 0xe4, 0x80, 0xaf, 0xed, 0x44, 0xff, 0xff, 0x80,
+  0x2b, 0xed, 0x41, 0x25, 0xe4, 0x82, 0x8e, 0xed, 0xff, 0xff, 0x9d, 0xff, 0x42, 0x25, 0xe4, 0x83,
+  0xa7, 0xe4, 0xf1, 0xed, 0xf8, 0xf6, 0xde, 0xff, 0x4b, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0x37,
+  0x7c, 0x41, 0xf2, 0x29, 0x82, 0xb6, 0x63, 0xff, 0xff, 0x37, 0x7c, 0x41, 0xf2, 0x29, 0x81, 0xdb,
+  0xb5, 0xb8, 0x8c, 0x41, 0xf2, 0x29, 0x82, 0x3b, 0xbe, 0xff, 0xff, 0x33, 0x32, 0x41, 0xf2, 0x29,
+  0x80, 0x1b, 0xbe, 0x44, 0xff, 0xff, 0x82, 0x7a, 0xa5, 0x37, 0x7c, 0xf5, 0x52, 0x44, 0xf2, 0x29,
+  0x80, 0xf5, 0x52, 0x42, 0xff, 0xff, 0x80, 0xb6, 0x6b, 0x45, 0xf2, 0x29, 0x81, 0x94, 0x42, 0x7e,
+  0xef, 0x42, 0xff, 0xff, 0x80, 0xb8, 0x8c, 0x41, 0xf2, 0x29, 0x81, 0x53, 0x3a, 0x35, 0x5b, 0x43,
+  0x15, 0x53, 0x80, 0xb4, 0x4a, 0x41, 0xf2, 0x29, 0x80, 0x94, 0x42, 0x42, 0xff, 0xff, 0x80, 0x12,
+  0xf6, 0x43, 0x25, 0xe4, 0x80, 0xa8, 0xe4, 0x45, 0xff, 0xff, 0x80, 0x35, 0x5b, 0x41, 0xf2, 0x29,
+  0x80, 0x19, 0x95, 0x49, 0xff, 0xff, 0x80, 0x11, 0xee, 0x42, 0x25, 0xe4, 0x80, 0x9c, 0xff, 0x4b,
+  0xff, 0xff, 0x83, 0xf8, 0xf6, 0xf1, 0xed, 0x2c, 0xed, 0x46, 0xe4, 0x44, 0x25, 0xe4, 0x83, 0x19,
+  0xf7, 0xff, 0xff, 0xde, 0xff, 0x87, 0xe4, 0x41, 0x25, 0xe4, 0x80, 0x96, 0xf6, 0x44, 0xff, 0xff,
+  0x80, 0xf1, 0xed, 0x41, 0x25, 0xe4, 0x80, 0x2c, 0xed, 0x41, 0xff, 0xff, 0x80, 0x74, 0xf6, 0x44,
+  0x25, 0xe4, 0x82, 0x66, 0xe4, 0x4c, 0xed, 0xf8, 0xf6, 0x49, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80,
+  0x37, 0x7c, 0x41, 0xf2, 0x29, 0x82, 0x96, 0x63, 0xff, 0xff, 0x9a, 0xad, 0x41, 0xf2, 0x29, 0x81,
+  0xd4, 0x4a, 0xb4, 0x42, 0x41, 0xf2, 0x29, 0x82, 0x9e, 0xef, 0xff, 0xff, 0x33, 0x32, 0x41, 0xf2,
+  0x29, 0x80, 0x1b, 0xbe, 0x42, 0xff, 0xff, 0x80, 0xf7, 0x73, 0x43, 0xf2, 0x29, 0x82, 0x12, 0x32,
+  0xb6, 0x6b, 0xd6, 0x6b, 0x41, 0xf2, 0x29, 0x80, 0xf4, 0x4a, 0x42, 0xff, 0xff, 0x80, 0xb6, 0x6b,
+  0x46, 0xf2, 0x29, 0x80, 0x55, 0x5b, 0x42, 0xff, 0xff, 0x80, 0x98, 0x8c, 0x49, 0xf2, 0x29, 0x81,
+  0x53, 0x3a, 0x9a, 0xad, 0x42, 0xff, 0xff, 0x80, 0xd0, 0xed, 0x43, 0x25, 0xe4, 0x80, 0x66, 0xe4,
+  0x45, 0xff, 0xff, 0x80, 0x35, 0x5b, 0x41, 0xf2, 0x29, 0x80, 0x19, 0x95, 0x49, 0xff, 0xff, 0x80,
+  0x11, 0xee, 0x42, 0x25, 0xe4, 0x80, 0x9c, 0xff, 0x49, 0xff, 0xff, 0x81, 0x95, 0xf6, 0x66, 0xe4,
+  0x43, 0x25, 0xe4, 0x82, 0xea, 0xec, 0xaf, 0xed, 0x66, 0xe4, 0x41, 0x25, 0xe4, 0x83, 0x19, 0xf7,
+  0xff, 0xff, 0xde, 0xff, 0x87, 0xe4, 0x41, 0x25, 0xe4, 0x80, 0xd7, 0xf6, 0x44, 0xff, 0xff, 0x80,
+  0x12, 0xee, 0x41, 0x25, 0xe4, 0x80, 0x2b, 0xed, 0x42, 0xff, 0xff, 0x82, 0x3a, 0xf7, 0x4d, 0xed,
+  0x45, 0xe4, 0x44, 0x25, 0xe4, 0x80, 0x4c, 0xed, 0x48, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0x37,
+  0x7c, 0x41, 0xf2, 0x29, 0x82, 0x96, 0x63, 0xff, 0xff, 0x1d, 0xdf, 0x44, 0xf2, 0x29, 0x83, 0x94,
+  0x42, 0xff, 0xff, 0xdf, 0xf7, 0x33, 0x32, 0x41, 0xf2, 0x29, 0x80, 0x1b, 0xbe, 0x41, 0xff, 0xff,
+  0x80, 0x37, 0x7c, 0x41, 0xf2, 0x29, 0x85, 0x33, 0x32, 0x19, 0x9d, 0xbc, 0xce, 0xdf, 0xff, 0xff,
+  0xff, 0x7c, 0xce, 0x41, 0xf2, 0x29, 0x80, 0x35, 0x53, 0x42, 0xff, 0xff, 0x80, 0xb6, 0x6b, 0x42,
+  0xf2, 0x29, 0x81, 0xdb, 0xb5, 0xdd, 0xd6, 0x42, 0xf2, 0x29, 0x80, 0xdb, 0xb5, 0x41, 0xff, 0xff,
+  0x80, 0xf9, 0x94, 0x41, 0xf2, 0x29, 0x81, 0xf5, 0x52, 0x5e, 0xe7, 0x44, 0x1d, 0xdf, 0x80, 0xbf,
+  0xf7, 0x44, 0xff, 0xff, 0x81, 0xf8, 0xf6, 0xf1, 0xed, 0x41, 0x12, 0xee, 0x81, 0xd0, 0xed, 0x53,
+  0xf6, 0x45, 0xff, 0xff, 0x80, 0x35, 0x5b, 0x41, 0xf2, 0x29, 0x80, 0x19, 0x95, 0x49, 0xff, 0xff,
+  0x80, 0x11, 0xee, 0x42, 0x25, 0xe4, 0x80, 0x9c, 0xff, 0x48, 0xff, 0xff, 0x80, 0x19, 0xf7, 0x42,
+  0x25, 0xe4, 0x82, 0x8e, 0xed, 0xd7, 0xf6, 0xbd, 0xff, 0x41, 0xff, 0xff, 0x80, 0x66, 0xe4, 0x41,
+  0x25, 0xe4, 0x83, 0x3a, 0xf7, 0xff, 0xff, 0xde, 0xff, 0x87, 0xe4, 0x41, 0x25, 0xe4, 0x80, 0x75,
+  0xf6, 0x44, 0xff, 0xff, 0x80, 0xaf, 0xed, 0x41, 0x25, 0xe4, 0x80, 0x4d, 0xed, 0x44, 0xff, 0xff,
+  0x83, 0xbd, 0xff, 0xb6, 0xf6, 0xd0, 0xed, 0x87, 0xe4, 0x42, 0x25, 0xe4, 0x80, 0xf1, 0xed, 0x47,
+  0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0x37, 0x7c, 0x41, 0xf2, 0x29, 0x80, 0x96, 0x63, 0x41, 0xff,
+  0xff, 0x80, 0x94, 0x42, 0x43, 0xf2, 0x29, 0x83, 0x57, 0x7c, 0xff, 0xff, 0x7e, 0xef, 0x33, 0x32,
+  0x41, 0xf2, 0x29, 0x82, 0x1b, 0xbe, 0xff, 0xff, 0x7e, 0xef, 0x42, 0xf2, 0x29, 0x80, 0x3b, 0xc6,
+  0x43, 0xff, 0xff, 0x80, 0xb8, 0x8c, 0x41, 0xf2, 0x29, 0x80, 0x55, 0x5b, 0x42, 0xff, 0xff, 0x80,
+  0xb6, 0x6b, 0x41, 0xf2, 0x29, 0x80, 0xf7, 0x73, 0x41, 0xff, 0xff, 0x80, 0xd6, 0x6b, 0x41, 0xf2,
+  0x29, 0x83, 0x12, 0x32, 0xdf, 0xf7, 0xff, 0xff, 0x3b, 0xbe, 0x41, 0xf2, 0x29, 0x80, 0x53, 0x3a,
+  0x45, 0xff, 0xff, 0x82, 0x7e, 0xef, 0xf9, 0x94, 0xbc, 0xd6, 0x42, 0xff, 0xff, 0x83, 0xbd, 0xff,
+  0xf8, 0xf6, 0x32, 0xf6, 0xaf, 0xed, 0x41, 0x8e, 0xed, 0x80, 0x7c, 0xff, 0x44, 0xff, 0xff, 0x80,
+  0x35, 0x53, 0x41, 0xf2, 0x29, 0x80, 0x39, 0x9d, 0x49, 0xff, 0xff, 0x80, 0x11, 0xee, 0x42, 0x25,
+  0xe4, 0x49, 0xff, 0xff, 0x80, 0x6d, 0xed, 0x41, 0x25, 0xe4, 0x80, 0x6e, 0xed, 0x43, 0xff, 0xff,
+  0x80, 0x7c, 0xff, 0x42, 0x25, 0xe4, 0x83, 0x5b, 0xff, 0xff, 0xff, 0xde, 0xff, 0x87, 0xe4, 0x41,
+  0x25, 0xe4, 0x80, 0x4c, 0xed, 0x44, 0xff, 0xff, 0x80, 0x87, 0xe4, 0x41, 0x25, 0xe4, 0x82, 0xf1,
+  0xed, 0xff, 0xff, 0x9c, 0xff, 0x41, 0xea, 0xec, 0x44, 0xff, 0xff, 0x80, 0x6d, 0xed, 0x41, 0x25,
+  0xe4, 0x80, 0xe9, 0xec, 0x47, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0x37, 0x7c, 0x41, 0xf2, 0x29,
+  0x80, 0x96, 0x63, 0x41, 0xff, 0xff, 0x80, 0x37, 0x7c, 0x43, 0xf2, 0x29, 0x83, 0xba, 0xb5, 0xff,
+  0xff, 0x7e, 0xef, 0x33, 0x32, 0x41, 0xf2, 0x29, 0x82, 0x1b, 0xbe, 0xff, 0xff, 0x1d, 0xdf, 0x42,
+  0xf2, 0x29, 0x80, 0x5c, 0xc6, 0x42, 0xff, 0xff, 0x81, 0x3d, 0xe7, 0x33, 0x32, 0x41, 0xf2, 0x29,
+  0x80, 0x94, 0x42, 0x42, 0xff, 0xff, 0x80, 0xb6, 0x6b, 0x41, 0xf2, 0x29, 0x80, 0xf9, 0x94, 0x41,
+  0xff, 0xff, 0x80, 0xbe, 0xf7, 0x42, 0xf2, 0x29, 0x83, 0xd6, 0x6b, 0xff, 0xff, 0xdf, 0xff, 0x33,
+  0x32, 0x41, 0xf2, 0x29, 0x80, 0x37, 0x7c, 0x43, 0xff, 0xff, 0x80, 0x3b, 0xc6, 0x41, 0xf2, 0x29,
+  0x80, 0x75, 0x63, 0x42, 0xff, 0xff, 0x82, 0xaf, 0xed, 0x2c, 0xed, 0x8e, 0xed, 0x41, 0xd0, 0xed,
+  0x81, 0x11, 0xee, 0xbd, 0xff, 0x44, 0xff, 0xff, 0x80, 0x55, 0x5b, 0x41, 0xf2, 0x29, 0x80, 0xb8,
+  0x8c, 0x49, 0xff, 0xff, 0x80, 0xf1, 0xed, 0x42, 0x25, 0xe4, 0x80, 0x74, 0xf6, 0x45, 0xb6, 0xf6,
+  0x80, 0xd7, 0xf6, 0x41, 0xff, 0xff, 0x80, 0x2b, 0xed, 0x41, 0x25, 0xe4, 0x80, 0x6e, 0xed, 0x43,
+  0xff, 0xff, 0x80, 0x4d, 0xed, 0x42, 0x25, 0xe4, 0x83, 0xf8, 0xf6, 0xff, 0xff, 0xde, 0xff, 0x87,
+  0xe4, 0x42, 0x25, 0xe4, 0x80, 0x74, 0xf6, 0x42, 0xff, 0xff, 0x80, 0x8e, 0xed, 0x42, 0x25, 0xe4,
+  0x82, 0x5a, 0xf7, 0xff, 0xff, 0x74, 0xf6, 0x41, 0x25, 0xe4, 0x80, 0x6d, 0xed, 0x43, 0xff, 0xff,
+  0x80, 0x74, 0xf6, 0x41, 0x25, 0xe4, 0x80, 0x2b, 0xed, 0x47, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80,
+  0xf7, 0x73, 0x41, 0xf2, 0x29, 0x80, 0x76, 0x63, 0x41, 0xff, 0xff, 0x80, 0x9a, 0xad, 0x43, 0xf2,
+  0x29, 0x83, 0x3d, 0xe7, 0xff, 0xff, 0x7e, 0xef, 0x12, 0x2a, 0x41, 0xf2, 0x29, 0x80, 0xdb, 0xb5,
+  0x41, 0xff, 0xff, 0x80, 0x94, 0x42, 0x41, 0xf2, 0x29, 0x83, 0x73, 0x3a, 0x9a, 0xad, 0x3b, 0xbe,
+  0xf9, 0x94, 0x44, 0xf2, 0x29, 0x80, 0xbc, 0xd6, 0x41, 0xff, 0xff, 0x80, 0x76, 0x63, 0x41, 0xf2,
+  0x29, 0x80, 0x57, 0x84, 0x42, 0xff, 0xff, 0x80, 0x5a, 0xa5, 0x42, 0xf2, 0x29, 0x82, 0x3b, 0xc6,
+  0xff, 0xff, 0x3b, 0xbe, 0x42, 0xf2, 0x29, 0x83, 0xd6, 0x6b, 0xfb, 0xb5, 0xfb, 0xbd, 0x37, 0x7c,
+  0x42, 0xf2, 0x29, 0x80, 0x1b, 0xbe, 0x42, 0xff, 0xff, 0x82, 0xb6, 0xf6, 0xaf, 0xed, 0x8e, 0xed,
+  0x42, 0x6d, 0xed, 0x80, 0xde, 0xff, 0x44, 0xff, 0xff, 0x80, 0xb6, 0x6b, 0x41, 0xf2, 0x29, 0x84,
+  0x33, 0x32, 0xf7, 0x73, 0x35, 0x53, 0x96, 0x63, 0x9e, 0xf7, 0x45, 0xff, 0xff, 0x80, 0xf0, 0xed,
+  0x4a, 0x25, 0xe4, 0x82, 0xea, 0xec, 0xff, 0xff, 0x54, 0xf6, 0x42, 0x25, 0xe4, 0x83, 0xd0, 0xed,
+  0xd7, 0xf6, 0x95, 0xf6, 0xea, 0xec, 0x43, 0x25, 0xe4, 0x85, 0xd0, 0xed, 0xff, 0xff, 0xde, 0xff,
+  0x87, 0xe4, 0x25, 0xe4, 0x45, 0xe4, 0x41, 0x25, 0xe4, 0x82, 0xea, 0xec, 0x8e, 0xed, 0xc8, 0xe4,
+  0x42, 0x25, 0xe4, 0x80, 0x6d, 0xed, 0x41, 0xff, 0xff, 0x80, 0x7b, 0xff, 0x42, 0x25, 0xe4, 0x84,
+  0x4d, 0xed, 0xb6, 0xf6, 0xf8, 0xf6, 0x53, 0xf6, 0x66, 0xe4, 0x41, 0x25, 0xe4, 0x80, 0x95, 0xf6,
+  0x47, 0xff, 0xff, 0x47, 0xff, 0xff, 0x80, 0x37, 0x7c, 0x41, 0xf2, 0x29, 0x80, 0x55, 0x5b, 0x41,
+  0xff, 0xff, 0x80, 0x5e, 0xe7, 0x42, 0xf2, 0x29, 0x80, 0xb4, 0x42, 0x41, 0xff, 0xff, 0x80, 0xbf,
+  0xf7, 0x42, 0xf2, 0x29, 0x80, 0x7c, 0xce, 0x41, 0xff, 0xff, 0x80, 0x9c, 0xce, 0x46, 0xf2, 0x29,
+  0x81, 0x9a, 0xad, 0xd4, 0x4a, 0x41, 0xf2, 0x29, 0x80, 0x59, 0xa5, 0x41, 0xff, 0xff, 0x80, 0x76,
+  0x63, 0x41, 0xf2, 0x29, 0x80, 0x98, 0x8c, 0x43, 0xff, 0xff, 0x80, 0xd4, 0x4a, 0x41, 0xf2, 0x29,
+  0x80, 0x98, 0x8c, 0x41, 0xff, 0xff, 0x80, 0x7a, 0xa5, 0x47, 0xf2, 0x29, 0x80, 0x39, 0x9d, 0x43,
+  0xff, 0xff, 0x85, 0x12, 0xf6, 0x2b, 0xed, 0x12, 0xee, 0x74, 0xf6, 0x12, 0xee, 0x7c, 0xff, 0x45,
+  0xff, 0xff, 0x80, 0xdb, 0xb5, 0x45, 0xf2, 0x29, 0x80, 0x3d, 0xdf, 0x45, 0xff, 0xff, 0x80, 0x96,
+  0xf6, 0x4b, 0x25, 0xe4, 0x41, 0xff, 0xff, 0x80, 0xe9, 0xec, 0x45, 0x25, 0xe4, 0x81, 0x12, 0xee,
+  0x11, 0xee, 0x41, 0x25, 0xe4, 0x80, 0xc8, 0xe4, 0x41, 0xff, 0xff, 0x80, 0x45, 0xe4, 0x41, 0x25,
+  0xe4, 0x81, 0x96, 0xf6, 0x66, 0xe4, 0x44, 0x25, 0xe4, 0x80, 0x0a, 0xed, 0x43, 0xff, 0xff, 0x80,
+  0xb6, 0xf6, 0x47, 0x25, 0xe4, 0x80, 0x8e, 0xed, 0x48, 0xff, 0xff, 0x47, 0xff, 0xff, 0x83, 0x1d,
+  0xdf, 0x15, 0x53, 0xd4, 0x4a, 0x9c, 0xce, 0x42, 0xff, 0xff, 0x83, 0x9a, 0xad, 0xb4, 0x4a, 0xf5,
+  0x4a, 0xbc, 0xd6, 0x42, 0xff, 0xff, 0x82, 0x7a, 0xa5, 0xb4, 0x4a, 0x17, 0x74, 0x43, 0xff, 0xff,
+  0x8b, 0xbc, 0xd6, 0xf6, 0x6b, 0xb4, 0x4a, 0xb4, 0x42, 0x35, 0x5b, 0x19, 0x95, 0x9e, 0xef, 0xff,
+  0xff, 0x1d, 0xdf, 0xf4, 0x4a, 0x35, 0x53, 0x5e, 0xe7, 0x41, 0xff, 0xff, 0x83, 0x9c, 0xce, 0xd4,
+  0x4a, 0x35, 0x53, 0x7e, 0xef, 0x43, 0xff, 0xff, 0x83, 0x3d, 0xe7, 0xd4, 0x4a, 0xf5, 0x52, 0x3d,
+  0xe7, 0x42, 0xff, 0xff, 0x82, 0x1d, 0xdf, 0x98, 0x8c, 0x35, 0x5b, 0x41, 0xb4, 0x42, 0x82, 0x35,
+  0x53, 0x98, 0x84, 0xfd, 0xde, 0x45, 0xff, 0xff, 0x84, 0x5b, 0xff, 0xea, 0xec, 0x25, 0xe4, 0x0b,
+  0xed, 0xde, 0xff, 0x46, 0xff, 0xff, 0x85, 0x7a, 0xa5, 0x35, 0x5b, 0xb4, 0x42, 0xb4, 0x4a, 0x76,
+  0x63, 0xfb, 0xb5, 0x47, 0xff, 0xff, 0x81, 0x74, 0xf6, 0x8f, 0xed, 0x47, 0x8e, 0xed, 0x81, 0xaf,
+  0xed, 0x39, 0xf7, 0x42, 0xff, 0xff, 0x85, 0xf1, 0xed, 0xea, 0xec, 0xa8, 0xe4, 0xc9, 0xe4, 0x8e,
+  0xed, 0x19, 0xf7, 0x41, 0xff, 0xff, 0x82, 0x8e, 0xed, 0xc9, 0xe4, 0xb6, 0xf6, 0x41, 0xff, 0xff,
+  0x89, 0x54, 0xf6, 0xc8, 0xe4, 0xd0, 0xed, 0xff, 0xff, 0x9d, 0xff, 0xaf, 0xed, 0xc9, 0xe4, 0xa8,
+  0xe4, 0x0b, 0xed, 0x53, 0xf6, 0x45, 0xff, 0xff, 0x82, 0x7c, 0xff, 0xf1, 0xed, 0x0a, 0xed, 0x41,
+  0xa8, 0xe4, 0x82, 0xe9, 0xec, 0x8e, 0xed, 0xd7, 0xf6, 0x49, 0xff, 0xff, 0x48, 0xff, 0xff, 0x81,
+  0xdd, 0xd6, 0x9c, 0xce, 0x44, 0xff, 0xff, 0x81, 0x9c, 0xce, 0xdc, 0xd6, 0x44, 0xff, 0xff, 0x81,
+  0x9c, 0xce, 0x9e, 0xef, 0x44, 0xff, 0xff, 0x83, 0x9e, 0xef, 0x9c, 0xce, 0x7c, 0xce, 0x1d, 0xdf,
+  0x43, 0xff, 0xff, 0x81, 0xbc, 0xd6, 0xfd, 0xde, 0x43, 0xff, 0xff, 0x81, 0x9c, 0xce, 0xfd, 0xde,
+  0x45, 0xff, 0xff, 0x81, 0xbc, 0xd6, 0xdc, 0xd6, 0x45, 0xff, 0xff, 0x80, 0x1d, 0xdf, 0x41, 0x7c,
+  0xce, 0x80, 0xfd, 0xde, 0x47, 0xff, 0xff, 0x83, 0x7b, 0xff, 0x4d, 0xed, 0x4c, 0xed, 0xf8, 0xf6,
+  0x48, 0xff, 0xff, 0x83, 0xfd, 0xde, 0x7c, 0xce, 0x9c, 0xce, 0x3e, 0xe7, 0x4a, 0xff, 0xff, 0x47,
+  0xde, 0xff, 0x45, 0xff, 0xff, 0x83, 0x5a, 0xf7, 0x18, 0xf7, 0x3a, 0xf7, 0xde, 0xff, 0x42, 0xff,
+  0xff, 0x81, 0xbd, 0xff, 0x19, 0xf7, 0x43, 0xff, 0xff, 0x81, 0x19, 0xf7, 0xde, 0xff, 0x42, 0xff,
+  0xff, 0x82, 0x3a, 0xf7, 0x18, 0xf7, 0x7b, 0xff, 0x48, 0xff, 0xff, 0x84, 0x7b, 0xff, 0x19, 0xf7,
+  0x18, 0xf7, 0x5a, 0xf7, 0xde, 0xff, 0x4a, 0xff, 0xff, 0x79, 0xff, 0xff, 0x82, 0xbe, 0xf7, 0x9d,
+  0xef, 0xbe, 0xf7, 0x4e, 0xff, 0xff, 0x83, 0xbe, 0xf7, 0xfb, 0xde, 0x5c, 0xe7, 0xbe, 0xf7, 0x7f,
+  0xff, 0xff, 0x4f, 0xff, 0xff, 0x4a, 0xff, 0xff, 0x59, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x85, 0xbe,
+  0xf7, 0xb6, 0xb5, 0x2c, 0x63, 0x04, 0x21, 0xaa, 0x52, 0x5c, 0xe7, 0x4c, 0xff, 0xff, 0x86, 0xbe,
+  0xf7, 0x0c, 0x63, 0x62, 0x10, 0xc3, 0x18, 0x49, 0x4a, 0x75, 0xad, 0xde, 0xf7, 0x7f, 0xff, 0xff,
+  0x4d, 0xff, 0xff, 0x48, 0xff, 0xff, 0x81, 0x7d, 0xef, 0xb2, 0x94, 0x58, 0xef, 0x7b, 0x86, 0x10,
+  0x84, 0x71, 0x8c, 0x14, 0xa5, 0xd7, 0xbd, 0xba, 0xd6, 0x3c, 0xe7, 0x9d, 0xef, 0x4a, 0xff, 0xff,
+  0x82, 0xdf, 0xff, 0xb6, 0xb5, 0xc7, 0x39, 0x43, 0x00, 0x00, 0x81, 0x8e, 0x73, 0xdf, 0xff, 0x4b,
+  0xff, 0xff, 0x80, 0xb2, 0x94, 0x44, 0x00, 0x00, 0x81, 0xcb, 0x5a, 0x5d, 0xef, 0x43, 0xff, 0xff,
+  0x82, 0xbe, 0xf7, 0x9a, 0xd6, 0x75, 0xad, 0x58, 0x14, 0xa5, 0x82, 0xf7, 0xbd, 0xba, 0xd6, 0x34,
+  0xa5, 0x5d, 0x14, 0xa5, 0x82, 0x96, 0xb5, 0xfb, 0xde, 0xdf, 0xff, 0x48, 0xff, 0xff, 0x47, 0xff,
+  0xff, 0x81, 0xba, 0xd6, 0x49, 0x4a, 0x5e, 0x00, 0x00, 0x84, 0x04, 0x21, 0x8a, 0x52, 0xb2, 0x94,
+  0x9a, 0xd6, 0xbe, 0xf7, 0x47, 0xff, 0xff, 0x81, 0x92, 0x94, 0x20, 0x00, 0x44, 0x00, 0x00, 0x81,
+  0xe4, 0x20, 0x59, 0xce, 0x4a, 0xff, 0xff, 0x81, 0x9d, 0xef, 0xa3, 0x18, 0x45, 0x00, 0x00, 0x81,
+  0x0c, 0x63, 0xde, 0xf7, 0x41, 0xff, 0xff, 0x81, 0xbe, 0xf7, 0xef, 0x7b, 0x5a, 0x00, 0x00, 0x81,
+  0x08, 0x42, 0x51, 0x8c, 0x5f, 0x00, 0x00, 0x82, 0x62, 0x10, 0x92, 0x94, 0xdb, 0xde, 0x47, 0xff,
+  0xff, 0x47, 0xff, 0xff, 0x81, 0xf3, 0x9c, 0x62, 0x10, 0x61, 0x00, 0x00, 0x82, 0x82, 0x10, 0x6d,
+  0x6b, 0x79, 0xce, 0x45, 0xff, 0xff, 0x81, 0x55, 0xad, 0x61, 0x08, 0x41, 0x00, 0x00, 0x82, 0x41,
+  0x08, 0x0c, 0x63, 0xc3, 0x18, 0x41, 0x00, 0x00, 0x82, 0x0c, 0x63, 0xdb, 0xde, 0xbe, 0xf7, 0x46,
+  0xff, 0xff, 0x82, 0xbe, 0xf7, 0x1c, 0xe7, 0x0c, 0x63, 0x41, 0x00, 0x00, 0x82, 0x41, 0x08, 0xe7,
+  0x39, 0x41, 0x08, 0x42, 0x00, 0x00, 0x80, 0x96, 0xb5, 0x41, 0xff, 0xff, 0x81, 0xba, 0xd6, 0x41,
+  0x08, 0x5a, 0x00, 0x00, 0x82, 0x49, 0x4a, 0xd3, 0x9c, 0x61, 0x08, 0x60, 0x00, 0x00, 0x80, 0x8e,
+  0x73, 0x47, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x14, 0xa5, 0xa2, 0x10, 0x63, 0x00, 0x00, 0x81,
+  0x24, 0x21, 0x75, 0xad, 0x43, 0xff, 0xff, 0x81, 0x7d, 0xef, 0xc7, 0x39, 0x42, 0x00, 0x00, 0x82,
+  0x92, 0x94, 0xff, 0xff, 0x92, 0x94, 0x42, 0x00, 0x00, 0x8a, 0xa6, 0x31, 0x0c, 0x63, 0xcf, 0x7b,
+  0x71, 0x8c, 0xf3, 0x9c, 0x14, 0xa5, 0xf3, 0x9c, 0x71, 0x8c, 0xcf, 0x7b, 0x0c, 0x63, 0x08, 0x42,
+  0x41, 0x00, 0x00, 0x84, 0x21, 0x08, 0x2c, 0x63, 0x9e, 0xf7, 0x71, 0x8c, 0x82, 0x10, 0x41, 0x00,
+  0x00, 0x84, 0x86, 0x31, 0xbe, 0xf7, 0xff, 0xff, 0xba, 0xd6, 0x61, 0x08, 0x5a, 0x00, 0x00, 0x82,
+  0x69, 0x4a, 0xf3, 0x9c, 0x62, 0x10, 0x60, 0x00, 0x00, 0x80, 0xaa, 0x52, 0x47, 0xff, 0xff, 0x47,
+  0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x64, 0x00, 0x00, 0x81, 0x41, 0x08, 0x96, 0xb5, 0x42,
+  0xff, 0xff, 0x81, 0x55, 0xad, 0x61, 0x08, 0x41, 0x00, 0x00, 0x80, 0xcf, 0x7b, 0x41, 0xff, 0xff,
+  0x81, 0xfb, 0xde, 0x24, 0x21, 0x4e, 0x00, 0x00, 0x81, 0xc3, 0x18, 0x1b, 0xdf, 0x41, 0xff, 0xff,
+  0x81, 0xd3, 0x9c, 0xa2, 0x10, 0x41, 0x00, 0x00, 0x83, 0x79, 0xce, 0xff, 0xff, 0xdb, 0xde, 0xc3,
+  0x18, 0x5a, 0x00, 0x00, 0x82, 0x49, 0x4a, 0xb2, 0x94, 0x41, 0x08, 0x60, 0x00, 0x00, 0x80, 0x0c,
+  0x63, 0x47, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x82,
+  0xa2, 0x10, 0x8e, 0x73, 0xd3, 0x9c, 0x52, 0x92, 0x94, 0x85, 0x71, 0x8c, 0x30, 0x84, 0xcf, 0x7b,
+  0xec, 0x62, 0xc7, 0x39, 0x20, 0x00, 0x45, 0x00, 0x00, 0x81, 0x24, 0x21, 0x7d, 0xef, 0x41, 0xff,
+  0xff, 0x80, 0x10, 0x84, 0x41, 0x00, 0x00, 0x81, 0x86, 0x31, 0xbe, 0xf7, 0x41, 0xff, 0xff, 0x81,
+  0x5c, 0xe7, 0x69, 0x4a, 0x4e, 0x00, 0x00, 0x80, 0x24, 0x21, 0x43, 0xff, 0xff, 0x80, 0xcb, 0x5a,
+  0x41, 0x00, 0x00, 0x84, 0x51, 0x8c, 0xff, 0xff, 0xbe, 0xf7, 0x92, 0x94, 0x62, 0x10, 0x59, 0x00,
+  0x00, 0x81, 0xe7, 0x39, 0x71, 0x8c, 0x5f, 0x00, 0x00, 0x82, 0xe3, 0x18, 0x51, 0x8c, 0x9a, 0xd6,
+  0x47, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x25,
+  0x29, 0x9a, 0xd6, 0x56, 0xff, 0xff, 0x83, 0x9e, 0xf7, 0x1b, 0xdf, 0x18, 0xc6, 0xaa, 0x52, 0x44,
+  0x00, 0x00, 0x81, 0x20, 0x00, 0xb2, 0x94, 0x41, 0xff, 0xff, 0x80, 0x8e, 0x73, 0x41, 0x00, 0x00,
+  0x80, 0xf3, 0x9c, 0x42, 0xff, 0xff, 0x81, 0x99, 0xce, 0x82, 0x10, 0x41, 0x00, 0x00, 0x83, 0x41,
+  0x08, 0x2c, 0x63, 0x8e, 0x73, 0x04, 0x21, 0x42, 0x00, 0x00, 0x83, 0xa2, 0x10, 0x0c, 0x63, 0x8e,
+  0x73, 0x62, 0x10, 0x41, 0x00, 0x00, 0x81, 0xc3, 0x18, 0x79, 0xce, 0x42, 0xff, 0xff, 0x80, 0x30,
+  0x84, 0x41, 0x00, 0x00, 0x80, 0xeb, 0x5a, 0x41, 0xff, 0xff, 0x82, 0xde, 0xf7, 0x79, 0xce, 0xb6,
+  0xb5, 0x48, 0x55, 0xad, 0x82, 0x96, 0xb5, 0xae, 0x73, 0x62, 0x10, 0x43, 0x00, 0x00, 0x82, 0x66,
+  0x31, 0x34, 0xa5, 0x75, 0xad, 0x45, 0x55, 0xad, 0x82, 0x18, 0xc6, 0xfb, 0xde, 0x75, 0xad, 0x47,
+  0x55, 0xad, 0x81, 0xb6, 0xb5, 0xcb, 0x5a, 0x44, 0x00, 0x00, 0x81, 0x28, 0x42, 0xd6, 0xb5, 0x4c,
+  0x55, 0xad, 0x81, 0xd6, 0xb5, 0xba, 0xd6, 0x49, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5,
+  0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x04, 0x21, 0x58, 0xc6, 0x59, 0xff, 0xff, 0x81, 0x9d, 0xef,
+  0x2c, 0x63, 0x44, 0x00, 0x00, 0x80, 0xcb, 0x5a, 0x41, 0xff, 0xff, 0x80, 0xef, 0x7b, 0x41, 0x00,
+  0x00, 0x80, 0x14, 0xa5, 0x41, 0xff, 0xff, 0x81, 0xde, 0xf7, 0xef, 0x7b, 0x42, 0x00, 0x00, 0x80,
+  0x55, 0xad, 0x41, 0xbe, 0xf7, 0x88, 0x1b, 0xdf, 0xb6, 0xb5, 0xd3, 0x9c, 0x96, 0xb5, 0xfb, 0xde,
+  0x9e, 0xf7, 0xbe, 0xf7, 0x79, 0xce, 0xa2, 0x10, 0x41, 0x00, 0x00, 0x80, 0xec, 0x62, 0x42, 0xff,
+  0xff, 0x80, 0x8e, 0x73, 0x41, 0x00, 0x00, 0x80, 0x8a, 0x52, 0x4e, 0xff, 0xff, 0x81, 0xf7, 0xbd,
+  0xa3, 0x18, 0x43, 0x00, 0x00, 0x80, 0x8a, 0x52, 0x53, 0xff, 0xff, 0x81, 0x92, 0x94, 0x20, 0x00,
+  0x43, 0x00, 0x00, 0x80, 0x6d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3,
+  0x18, 0x43, 0x00, 0x00, 0x81, 0x04, 0x21, 0x38, 0xc6, 0x5a, 0xff, 0xff, 0x81, 0x34, 0xa5, 0x41,
+  0x08, 0x43, 0x00, 0x00, 0x80, 0x49, 0x4a, 0x41, 0xff, 0xff, 0x87, 0xd3, 0x9c, 0x20, 0x00, 0x00,
+  0x00, 0xa6, 0x31, 0x7d, 0xef, 0xff, 0xff, 0x59, 0xce, 0x21, 0x08, 0x41, 0x00, 0x00, 0x80, 0xae,
+  0x73, 0x4a, 0xff, 0xff, 0x87, 0xb2, 0x94, 0x20, 0x00, 0x00, 0x00, 0x82, 0x10, 0x75, 0xad, 0xff,
+  0xff, 0xbe, 0xf7, 0x08, 0x42, 0x41, 0x00, 0x00, 0x80, 0xec, 0x62, 0x4e, 0xff, 0xff, 0x81, 0x96,
+  0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51,
+  0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5,
+  0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x04, 0x21, 0x38, 0xc6, 0x5a, 0xff, 0xff, 0x81, 0x54, 0xa5,
+  0x62, 0x10, 0x43, 0x00, 0x00, 0x80, 0x49, 0x4a, 0x41, 0xff, 0xff, 0x81, 0x59, 0xce, 0x24, 0x21,
+  0x41, 0x00, 0x00, 0x82, 0xef, 0x7b, 0x3c, 0xe7, 0x08, 0x42, 0x41, 0x00, 0x00, 0x81, 0x45, 0x29,
+  0x9a, 0xd6, 0x4b, 0xff, 0xff, 0x80, 0xa6, 0x31, 0x41, 0x00, 0x00, 0x83, 0x08, 0x42, 0xff, 0xff,
+  0x96, 0xb5, 0x82, 0x10, 0x41, 0x00, 0x00, 0x80, 0x71, 0x8c, 0x4e, 0xff, 0xff, 0x81, 0x96, 0xb5,
+  0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c,
+  0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3,
+  0x18, 0x43, 0x00, 0x00, 0x81, 0x04, 0x21, 0x38, 0xc6, 0x5a, 0xff, 0xff, 0x81, 0x34, 0xa5, 0x61,
+  0x08, 0x43, 0x00, 0x00, 0x80, 0x49, 0x4a, 0x42, 0xff, 0xff, 0x80, 0x69, 0x4a, 0x42, 0x00, 0x00,
+  0x80, 0x49, 0x4a, 0x41, 0x00, 0x00, 0x81, 0x41, 0x08, 0xd3, 0x9c, 0x4c, 0xff, 0xff, 0x85, 0x38,
+  0xc6, 0x20, 0x00, 0x00, 0x00, 0x41, 0x08, 0xb2, 0x94, 0x0c, 0x63, 0x41, 0x00, 0x00, 0x81, 0x20,
+  0x00, 0xdb, 0xde, 0x4e, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49,
+  0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59,
+  0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x04, 0x21,
+  0x38, 0xc6, 0x5a, 0xff, 0xff, 0x81, 0x34, 0xa5, 0x61, 0x08, 0x43, 0x00, 0x00, 0x80, 0x49, 0x4a,
+  0x42, 0xff, 0xff, 0x81, 0xf3, 0x9c, 0x21, 0x08, 0x44, 0x00, 0x00, 0x81, 0x69, 0x4a, 0x9e, 0xf7,
+  0x4c, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x0c, 0x63, 0x41, 0x00, 0x00, 0x81, 0x20, 0x00, 0x21, 0x08,
+  0x41, 0x00, 0x00, 0x81, 0x2c, 0x63, 0xde, 0xf7, 0x4e, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10,
+  0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00,
+  0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43,
+  0x00, 0x00, 0x81, 0x04, 0x21, 0x38, 0xc6, 0x5a, 0xff, 0xff, 0x81, 0x55, 0xad, 0x62, 0x10, 0x43,
+  0x00, 0x00, 0x80, 0x49, 0x4a, 0x42, 0xff, 0xff, 0x81, 0xbe, 0xf7, 0x28, 0x42, 0x43, 0x00, 0x00,
+  0x81, 0x82, 0x10, 0xf7, 0xbd, 0x4e, 0xff, 0xff, 0x81, 0x1b, 0xdf, 0xa3, 0x18, 0x43, 0x00, 0x00,
+  0x81, 0x66, 0x31, 0x3c, 0xe7, 0x4f, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00,
+  0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d,
+  0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x81,
+  0x04, 0x21, 0x38, 0xc6, 0x5a, 0xff, 0xff, 0x81, 0x92, 0x94, 0x20, 0x00, 0x43, 0x00, 0x00, 0x80,
+  0x69, 0x4a, 0x43, 0xff, 0xff, 0x81, 0x59, 0xce, 0xa3, 0x18, 0x42, 0x00, 0x00, 0x80, 0x4d, 0x6b,
+  0x4f, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x92, 0x94, 0x42, 0x00, 0x00, 0x81, 0x41, 0x08, 0xf7, 0xbd,
+  0x50, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff,
+  0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47,
+  0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x45, 0x29, 0xba, 0xd6, 0x59,
+  0xff, 0xff, 0x81, 0x34, 0xa5, 0x24, 0x21, 0x44, 0x00, 0x00, 0x80, 0x6d, 0x6b, 0x43, 0xff, 0xff,
+  0x81, 0xba, 0xd6, 0xc3, 0x18, 0x41, 0x00, 0x00, 0x81, 0xe4, 0x20, 0x1c, 0xe7, 0x50, 0xff, 0xff,
+  0x81, 0x7d, 0xef, 0xe7, 0x39, 0x41, 0x00, 0x00, 0x81, 0x21, 0x08, 0xf7, 0xbd, 0x50, 0xff, 0xff,
+  0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff,
+  0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81,
+  0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x82, 0xe4, 0x20, 0x13, 0x9d, 0x79, 0xce, 0x53, 0x58,
+  0xc6, 0x85, 0x18, 0xc6, 0xd6, 0xb5, 0x14, 0xa5, 0xef, 0x7b, 0x49, 0x4a, 0x82, 0x10, 0x44, 0x00,
+  0x00, 0x81, 0x61, 0x08, 0x38, 0xc6, 0x43, 0xff, 0xff, 0x80, 0x8a, 0x52, 0x41, 0x00, 0x00, 0x81,
+  0x41, 0x08, 0xd3, 0x9c, 0x43, 0xff, 0xff, 0x81, 0x3c, 0xe7, 0xdb, 0xde, 0x46, 0xff, 0xff, 0x81,
+  0xba, 0xd6, 0xfb, 0xde, 0x43, 0xff, 0xff, 0x81, 0x75, 0xad, 0x20, 0x00, 0x41, 0x00, 0x00, 0x81,
+  0xa6, 0x31, 0x7d, 0xef, 0x4f, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81,
+  0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b,
+  0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x20,
+  0x00, 0xa2, 0x10, 0x55, 0xc3, 0x18, 0x81, 0xa2, 0x10, 0x62, 0x10, 0x47, 0x00, 0x00, 0x80, 0xeb,
+  0x5a, 0x43, 0xff, 0xff, 0x81, 0x34, 0xa5, 0x41, 0x08, 0x41, 0x00, 0x00, 0x81, 0xa7, 0x39, 0xdf,
+  0xff, 0x42, 0xff, 0xff, 0x83, 0x14, 0xa5, 0x24, 0x21, 0xe4, 0x20, 0xd3, 0x9c, 0x44, 0xff, 0xff,
+  0x83, 0xcf, 0x7b, 0xe3, 0x18, 0x04, 0x21, 0xd7, 0xbd, 0x42, 0xff, 0xff, 0x81, 0xde, 0xf7, 0x4d,
+  0x6b, 0x42, 0x00, 0x00, 0x80, 0x75, 0xad, 0x4f, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43,
+  0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00,
+  0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x64, 0x00,
+  0x00, 0x81, 0x69, 0x4a, 0xbe, 0xf7, 0x43, 0xff, 0xff, 0x80, 0x8a, 0x52, 0x41, 0x00, 0x00, 0x81,
+  0x21, 0x08, 0x59, 0xce, 0x42, 0xff, 0xff, 0x81, 0xbe, 0xf7, 0x49, 0x4a, 0x41, 0x00, 0x00, 0x81,
+  0xa2, 0x10, 0xbe, 0xf7, 0x42, 0xff, 0xff, 0x81, 0x79, 0xce, 0x24, 0x21, 0x41, 0x00, 0x00, 0x81,
+  0x69, 0x4a, 0xde, 0xf7, 0x42, 0xff, 0xff, 0x81, 0xda, 0xd6, 0xa6, 0x31, 0x41, 0x00, 0x00, 0x81,
+  0x65, 0x29, 0x9e, 0xf7, 0x4e, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81,
+  0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b,
+  0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x61, 0x00, 0x00, 0x83, 0x20,
+  0x00, 0x82, 0x10, 0xef, 0x7b, 0xbe, 0xf7, 0x43, 0xff, 0xff, 0x81, 0x38, 0xc6, 0x04, 0x21, 0x41,
+  0x00, 0x00, 0x80, 0x2c, 0x63, 0x44, 0xff, 0xff, 0x80, 0xcb, 0x5a, 0x41, 0x00, 0x00, 0x81, 0x86,
+  0x31, 0xde, 0xf7, 0x42, 0xff, 0xff, 0x81, 0x1b, 0xdf, 0x08, 0x42, 0x41, 0x00, 0x00, 0x81, 0xae,
+  0x73, 0xdf, 0xff, 0x43, 0xff, 0xff, 0x81, 0xf3, 0x9c, 0x41, 0x08, 0x41, 0x00, 0x00, 0x80, 0x38,
+  0xc6, 0x4e, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf,
+  0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff,
+  0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x5e, 0x00, 0x00, 0x84, 0x41, 0x08, 0xc3, 0x18,
+  0xa6, 0x31, 0xcf, 0x7b, 0xdb, 0xde, 0x45, 0xff, 0xff, 0x80, 0xb2, 0x94, 0x41, 0x00, 0x00, 0x81,
+  0x82, 0x10, 0x3c, 0xe7, 0x44, 0xff, 0xff, 0x83, 0x9a, 0xd6, 0xcb, 0x5a, 0x49, 0x4a, 0x79, 0xce,
+  0x44, 0xff, 0xff, 0x83, 0x18, 0xc6, 0xab, 0x5a, 0x2c, 0x63, 0x7d, 0xef, 0x45, 0xff, 0xff, 0x80,
+  0xaa, 0x52, 0x41, 0x00, 0x00, 0x80, 0xef, 0x7b, 0x4e, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10,
+  0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00,
+  0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x4f,
+  0x00, 0x00, 0x84, 0x61, 0x08, 0x08, 0x42, 0x8a, 0x52, 0x69, 0x4a, 0x08, 0x42, 0x46, 0xe7, 0x39,
+  0x84, 0x49, 0x4a, 0xcb, 0x5a, 0xae, 0x73, 0xd2, 0x94, 0x38, 0xc6, 0x48, 0xff, 0xff, 0x80, 0x51,
+  0x8c, 0x41, 0x00, 0x00, 0x81, 0x30, 0x84, 0xdf, 0xff, 0x57, 0xff, 0xff, 0x83, 0xd2, 0x94, 0x41,
+  0x08, 0x00, 0x00, 0x0c, 0x63, 0x4e, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00,
+  0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d,
+  0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x82,
+  0xa3, 0x18, 0x49, 0x4a, 0x45, 0x29, 0x48, 0x00, 0x00, 0x82, 0x21, 0x08, 0x49, 0x4a, 0x75, 0xad,
+  0x56, 0xff, 0xff, 0x80, 0x71, 0x8c, 0x41, 0x00, 0x00, 0x80, 0x17, 0xbe, 0x58, 0xff, 0xff, 0x83,
+  0x75, 0xad, 0x82, 0x10, 0x00, 0x00, 0x6d, 0x6b, 0x4e, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10,
+  0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00,
+  0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43,
+  0x00, 0x00, 0x84, 0x45, 0x29, 0xba, 0xd6, 0x9a, 0xd6, 0xae, 0x73, 0xa6, 0x31, 0x48, 0x00, 0x00,
+  0x83, 0x41, 0x08, 0x08, 0x42, 0x51, 0x8c, 0x38, 0xc6, 0x53, 0xff, 0xff, 0x80, 0x6d, 0x6b, 0x41,
+  0x00, 0x00, 0x80, 0x10, 0x84, 0x58, 0xff, 0xff, 0x83, 0x10, 0x84, 0x21, 0x08, 0x00, 0x00, 0x8a,
+  0x52, 0x4e, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf,
+  0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff,
+  0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x04, 0x21, 0x58, 0xc6,
+  0x41, 0xff, 0xff, 0x82, 0xdb, 0xde, 0xd3, 0x9c, 0x49, 0x4a, 0x49, 0x00, 0x00, 0x83, 0x04, 0x21,
+  0xeb, 0x5a, 0x55, 0xad, 0xde, 0xf7, 0x4d, 0xff, 0xff, 0x83, 0xdf, 0xff, 0xd7, 0xbd, 0xef, 0x7b,
+  0xc3, 0x18, 0x41, 0x00, 0x00, 0x83, 0x82, 0x10, 0x6d, 0x6b, 0xb2, 0x94, 0xd3, 0x9c, 0x41, 0xb2,
+  0x94, 0x81, 0x75, 0xad, 0x7d, 0xef, 0x4a, 0xff, 0xff, 0x81, 0xbe, 0xf7, 0x75, 0xad, 0x41, 0xb2,
+  0x94, 0x83, 0xd3, 0x9c, 0xd2, 0x94, 0xae, 0x73, 0xe3, 0x18, 0x41, 0x00, 0x00, 0x83, 0x41, 0x08,
+  0x4d, 0x6b, 0x96, 0xb5, 0xbe, 0xf7, 0x4b, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00,
+  0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80,
+  0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00,
+  0x81, 0x04, 0x21, 0x38, 0xc6, 0x43, 0xff, 0xff, 0x83, 0x3c, 0xe7, 0xd7, 0xbd, 0x0c, 0x63, 0x41,
+  0x08, 0x48, 0x00, 0x00, 0x83, 0x82, 0x10, 0xe7, 0x39, 0x51, 0x8c, 0x3c, 0xe7, 0x4b, 0xff, 0xff,
+  0x81, 0x96, 0xb5, 0xc3, 0x18, 0x45, 0x00, 0x00, 0x86, 0x21, 0x08, 0x41, 0x08, 0x20, 0x00, 0x21,
+  0x08, 0xa2, 0x10, 0x8e, 0x73, 0x9d, 0xef, 0x49, 0xff, 0xff, 0x81, 0xcf, 0x7b, 0xa2, 0x10, 0x41,
+  0x21, 0x08, 0x81, 0x41, 0x08, 0x21, 0x08, 0x45, 0x00, 0x00, 0x81, 0xa2, 0x10, 0x51, 0x8c, 0x4b,
+  0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52,
+  0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff,
+  0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x04, 0x21, 0x38, 0xc6, 0x45, 0xff,
+  0xff, 0x83, 0x9e, 0xf7, 0x9a, 0xd6, 0x30, 0x84, 0xe4, 0x20, 0x48, 0x00, 0x00, 0x83, 0x21, 0x08,
+  0x24, 0x21, 0x4d, 0x6b, 0x59, 0xce, 0x49, 0xff, 0xff, 0x80, 0x14, 0xa5, 0x4b, 0x00, 0x00, 0x81,
+  0x49, 0x4a, 0x5d, 0xef, 0x49, 0xff, 0xff, 0x80, 0x65, 0x29, 0x4b, 0x00, 0x00, 0x80, 0x8e, 0x73,
+  0x4b, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff,
+  0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47,
+  0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x04, 0x21, 0x38, 0xc6, 0x47,
+  0xff, 0xff, 0x83, 0xdf, 0xff, 0x5c, 0xe7, 0x34, 0xa5, 0xc7, 0x39, 0x49, 0x00, 0x00, 0x83, 0x82,
+  0x10, 0x69, 0x4a, 0x96, 0xb5, 0xdf, 0xff, 0x46, 0xff, 0xff, 0x89, 0x7d, 0xef, 0x51, 0x8c, 0x49,
+  0x4a, 0x29, 0x4a, 0x28, 0x42, 0xc7, 0x39, 0x86, 0x31, 0xc7, 0x39, 0x66, 0x31, 0x21, 0x08, 0x42,
+  0x00, 0x00, 0x81, 0x69, 0x4a, 0x5c, 0xe7, 0x49, 0xff, 0xff, 0x80, 0xa6, 0x31, 0x41, 0x00, 0x00,
+  0x83, 0x61, 0x08, 0x82, 0x10, 0x04, 0x21, 0x86, 0x31, 0x41, 0xa6, 0x31, 0x84, 0x86, 0x31, 0xa7,
+  0x39, 0x08, 0x42, 0xef, 0x7b, 0x5d, 0xef, 0x4b, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43,
+  0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00,
+  0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00,
+  0x00, 0x81, 0x04, 0x21, 0x38, 0xc6, 0x4a, 0xff, 0xff, 0x83, 0xbe, 0xf7, 0xd7, 0xbd, 0xcb, 0x5a,
+  0x62, 0x10, 0x48, 0x00, 0x00, 0x84, 0x21, 0x08, 0x65, 0x29, 0x92, 0x94, 0x3c, 0xe7, 0xde, 0xf7,
+  0x45, 0xff, 0xff, 0x80, 0xde, 0xf7, 0x41, 0xdf, 0xff, 0x41, 0xff, 0xff, 0x83, 0xde, 0xf7, 0xbe,
+  0xf7, 0xfb, 0xde, 0x69, 0x4a, 0x41, 0x00, 0x00, 0x81, 0x08, 0x42, 0x3c, 0xe7, 0x49, 0xff, 0xff,
+  0x87, 0xe7, 0x39, 0x00, 0x00, 0x20, 0x00, 0x2d, 0x6b, 0x1b, 0xdf, 0x9e, 0xf7, 0xde, 0xf7, 0xff,
+  0xff, 0x43, 0xdf, 0xff, 0x4d, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81,
+  0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b,
+  0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x04,
+  0x21, 0x38, 0xc6, 0x4d, 0xff, 0xff, 0x83, 0x9a, 0xd6, 0x8e, 0x73, 0x24, 0x21, 0x41, 0x08, 0x48,
+  0x00, 0x00, 0x83, 0xa3, 0x18, 0x8e, 0x73, 0x99, 0xce, 0x9d, 0xef, 0x44, 0xff, 0xff, 0x87, 0xde,
+  0xf7, 0x7d, 0xef, 0x3c, 0xe7, 0xda, 0xd6, 0x96, 0xb5, 0x71, 0x8c, 0xae, 0x73, 0xc7, 0x39, 0x41,
+  0x00, 0x00, 0x81, 0x04, 0x21, 0xba, 0xd6, 0x42, 0xff, 0xff, 0x82, 0xde, 0xf7, 0x3c, 0xe7, 0xbe,
+  0xf7, 0x43, 0xff, 0xff, 0x80, 0x45, 0x29, 0x41, 0x00, 0x00, 0x88, 0x41, 0x08, 0xe7, 0x39, 0x10,
+  0x84, 0xd6, 0xb5, 0xdb, 0xde, 0x3c, 0xe7, 0x7d, 0xef, 0x9e, 0xf7, 0xde, 0xf7, 0x4d, 0xff, 0xff,
+  0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff,
+  0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81,
+  0x34, 0xa5, 0xa3, 0x18, 0x43, 0x00, 0x00, 0x81, 0x04, 0x21, 0x38, 0xc6, 0x4f, 0xff, 0xff, 0x83,
+  0x9e, 0xf7, 0x71, 0x8c, 0xe8, 0x41, 0xa2, 0x10, 0x49, 0x00, 0x00, 0x81, 0xaa, 0x52, 0x79, 0xce,
+  0x41, 0xff, 0xff, 0x84, 0x9e, 0xf7, 0x75, 0xad, 0xcf, 0x7b, 0x69, 0x4a, 0x04, 0x21, 0x47, 0x00,
+  0x00, 0x80, 0xf7, 0xbd, 0x41, 0xff, 0xff, 0x84, 0x9e, 0xf7, 0xef, 0x7b, 0x66, 0x31, 0xcf, 0x7b,
+  0x7d, 0xef, 0x41, 0xff, 0xff, 0x81, 0x79, 0xce, 0x82, 0x10, 0x46, 0x00, 0x00, 0x84, 0x04, 0x21,
+  0x08, 0x42, 0xeb, 0x5a, 0x10, 0x84, 0xbe, 0xf7, 0x4c, 0xff, 0xff, 0x81, 0x96, 0xb5, 0xa2, 0x10,
+  0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x51, 0x8c, 0x44, 0x00,
+  0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81, 0xf3, 0x9c, 0xa2, 0x10, 0x43,
+  0x00, 0x00, 0x81, 0xe4, 0x20, 0x18, 0xc6, 0x52, 0xff, 0xff, 0x82, 0x75, 0xad, 0xaa, 0x52, 0x04,
+  0x21, 0x48, 0x00, 0x00, 0x83, 0xe3, 0x18, 0x3c, 0xe7, 0xff, 0xff, 0x18, 0xc6, 0x4b, 0x00, 0x00,
+  0x80, 0xae, 0x73, 0x41, 0xff, 0xff, 0x80, 0x96, 0xb5, 0x42, 0x00, 0x00, 0x80, 0xb2, 0x94, 0x41,
+  0xff, 0xff, 0x81, 0xcf, 0x7b, 0x21, 0x08, 0x4a, 0x00, 0x00, 0x80, 0xd7, 0xbd, 0x4c, 0xff, 0xff,
+  0x81, 0x96, 0xb5, 0xa2, 0x10, 0x43, 0x00, 0x00, 0x81, 0x49, 0x4a, 0xdf, 0xff, 0x52, 0xff, 0xff,
+  0x80, 0x51, 0x8c, 0x44, 0x00, 0x00, 0x80, 0x4d, 0x6b, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x81,
+  0x14, 0xa5, 0x21, 0x08, 0x43, 0x00, 0x00, 0x81, 0xc3, 0x18, 0x18, 0xc6, 0x54, 0xff, 0xff, 0x82,
+  0x38, 0xc6, 0xcf, 0x7b, 0xa6, 0x31, 0x47, 0x00, 0x00, 0x83, 0x59, 0xce, 0xff, 0xff, 0x79, 0xce,
+  0xa3, 0x18, 0x41, 0x00, 0x00, 0x86, 0x61, 0x08, 0x04, 0x21, 0x86, 0x31, 0x08, 0x42, 0x8a, 0x52,
+  0x0c, 0x63, 0x45, 0x29, 0x41, 0x00, 0x00, 0x83, 0x82, 0x10, 0x59, 0xce, 0xff, 0xff, 0xb6, 0xb5,
+  0x42, 0x00, 0x00, 0x83, 0xb2, 0x94, 0xff, 0xff, 0xba, 0xd6, 0xe3, 0x18, 0x41, 0x00, 0x00, 0x86,
+  0xc3, 0x18, 0x2c, 0x63, 0x8a, 0x52, 0xe7, 0x39, 0x45, 0x29, 0xa3, 0x18, 0x21, 0x08, 0x41, 0x00,
+  0x00, 0x81, 0x62, 0x10, 0x18, 0xc6, 0x4c, 0xff, 0xff, 0x81, 0x55, 0xad, 0x82, 0x10, 0x43, 0x00,
+  0x00, 0x81, 0x28, 0x42, 0xbe, 0xf7, 0x52, 0xff, 0xff, 0x80, 0x10, 0x84, 0x44, 0x00, 0x00, 0x80,
+  0x0c, 0x63, 0x59, 0xff, 0xff, 0x47, 0xff, 0xff, 0x82, 0x1c, 0xe7, 0x6d, 0x6b, 0x21, 0x08, 0x42,
+  0x00, 0x00, 0x81, 0xcb, 0x5a, 0x5d, 0xef, 0x56, 0xff, 0xff, 0x83, 0xdb, 0xde, 0xf3, 0x9c, 0x49,
+  0x4a, 0x41, 0x08, 0x42, 0x00, 0x00, 0x8f, 0x41, 0x08, 0xeb, 0x5a, 0x9e, 0xf7, 0xff, 0xff, 0xdf,
+  0xff, 0xf7, 0xbd, 0x30, 0x84, 0xf3, 0x9c, 0xb6, 0xb5, 0x38, 0xc6, 0xba, 0xd6, 0x3c, 0xe7, 0xbe,
+  0xf7, 0xff, 0xff, 0xf7, 0xbd, 0xc3, 0x18, 0x41, 0x00, 0x00, 0x88, 0xc7, 0x39, 0x79, 0xce, 0xff,
+  0xff, 0x92, 0x94, 0x8a, 0x52, 0x51, 0x8c, 0xff, 0xff, 0xdb, 0xde, 0xe7, 0x39, 0x42, 0x00, 0x00,
+  0x8a, 0xd7, 0xbd, 0xff, 0xff, 0x9e, 0xf7, 0x1b, 0xdf, 0x79, 0xce, 0xf7, 0xbd, 0x75, 0xad, 0x14,
+  0xa5, 0x71, 0x8c, 0x75, 0xad, 0xde, 0xf7, 0x4c, 0xff, 0xff, 0x81, 0xb6, 0xb5, 0x41, 0x08, 0x43,
+  0x00, 0x00, 0x81, 0x08, 0x42, 0xdf, 0xff, 0x52, 0xff, 0xff, 0x80, 0x30, 0x84, 0x44, 0x00, 0x00,
+  0x80, 0x0c, 0x63, 0x59, 0xff, 0xff, 0x48, 0xff, 0xff, 0x85, 0xbe, 0xf7, 0xf7, 0xbd, 0x34, 0xa5,
+  0xf3, 0x9c, 0x55, 0xad, 0x1c, 0xe7, 0x59, 0xff, 0xff, 0x86, 0x3c, 0xe7, 0xf7, 0xbd, 0x34, 0xa5,
+  0xf3, 0x9c, 0x54, 0xa5, 0x17, 0xbe, 0x9d, 0xef, 0x4c, 0xff, 0xff, 0x81, 0x14, 0xa5, 0x62, 0x10,
+  0x41, 0x00, 0x00, 0x86, 0x25, 0x29, 0xef, 0x7b, 0xfb, 0xde, 0xdb, 0xde, 0xba, 0xd6, 0x30, 0x84,
+  0x66, 0x31, 0x42, 0x00, 0x00, 0x80, 0x92, 0x94, 0x57, 0xff, 0xff, 0x82, 0x9d, 0xef, 0x2c, 0x63,
+  0x82, 0x10, 0x41, 0x00, 0x00, 0x81, 0xe4, 0x20, 0x34, 0xa5, 0x53, 0xff, 0xff, 0x82, 0xfb, 0xde,
+  0x49, 0x4a, 0x41, 0x08, 0x41, 0x00, 0x00, 0x81, 0x86, 0x31, 0x59, 0xce, 0x59, 0xff, 0xff, 0x7d,
+  0xff, 0xff, 0x81, 0x13, 0x9d, 0x62, 0x10, 0x42, 0x00, 0x00, 0x82, 0x04, 0x21, 0x86, 0x31, 0x24,
+  0x21, 0x43, 0x00, 0x00, 0x80, 0x51, 0x8c, 0x59, 0xff, 0xff, 0x81, 0x7d, 0xef, 0x9a, 0xd6, 0x41,
+  0x79, 0xce, 0x81, 0xdb, 0xde, 0xdf, 0xff, 0x54, 0xff, 0xff, 0x81, 0x3c, 0xe7, 0x9a, 0xd6, 0x41,
+  0x79, 0xce, 0x80, 0xfb, 0xde, 0x5a, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x81, 0x17, 0xbe, 0xa6, 0x31,
+  0x46, 0x00, 0x00, 0x81, 0x24, 0x21, 0x96, 0xb5, 0x7f, 0xff, 0xff, 0x55, 0xff, 0xff, 0x7f, 0xff,
+  0xff, 0x88, 0xbe, 0xf7, 0x14, 0xa5, 0x49, 0x4a, 0xa2, 0x10, 0x00, 0x00, 0x61, 0x08, 0xc7, 0x39,
+  0x71, 0x8c, 0x3c, 0xe7, 0x7f, 0xff, 0xff, 0x56, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x87, 0xff, 0xff,
+  0xde, 0xf7, 0x96, 0xb5, 0xcf, 0x7b, 0x0c, 0x63, 0x8e, 0x73, 0x34, 0xa5, 0x5d, 0xef, 0x7f, 0xff,
+  0xff, 0x57, 0xff, 0xff, 0x1f, 0x0e, 0x88, 0xff, 0xff, 0x41, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xc3,
+  0xff, 0xff, 0xe1, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xaf, 0xff, 0xff, 0x70, 0xff,
+  0xff, 0x19, 0x07, 0x0c, 0x81, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xd5, 0x42, 0xff, 0xff, 0xff, 0x82,
+  0xff, 0xff, 0xeb, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xf8, 0x41, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff,
+  0xfb, 0xff, 0xff, 0x9b, 0xff, 0xff, 0x16, 0x05, 0x0a, 0x81, 0xff, 0xff, 0x07, 0xff, 0xff, 0x9d,
+  0x41, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xb0, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0f, 0x02, 0x85,
+  0xff, 0xff, 0x28, 0xff, 0xff, 0x76, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff,
+  0xff, 0x44, 0x04, 0x09, 0x84, 0xff, 0xff, 0x05, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd9, 0xff, 0xff, 0x35, 0x01, 0x84, 0xff, 0xff, 0x18, 0xff, 0xff, 0x46, 0xff, 0xff, 0x53, 0xff,
+  0xff, 0x35, 0xff, 0xff, 0x06, 0x00, 0x84, 0xff, 0xff, 0x06, 0xff, 0xff, 0x80, 0xff, 0xff, 0xfc,
+  0xff, 0xff, 0xfa, 0xff, 0xff, 0x4e, 0x03, 0x09, 0x83, 0xff, 0xff, 0x96, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xc2, 0xff, 0xff, 0x0e, 0x00, 0x81, 0xff, 0xff, 0x46, 0xff, 0xff, 0xc6, 0x43, 0xff, 0xff,
+  0xff, 0x82, 0xff, 0xff, 0xf2, 0xff, 0xff, 0x93, 0xff, 0xff, 0x13, 0x00, 0x83, 0xff, 0xff, 0x4e,
+  0xff, 0xff, 0xfa, 0xff, 0xff, 0xf5, 0xff, 0xff, 0x2b, 0x02, 0x08, 0x85, 0xff, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x11, 0xff, 0xff, 0x01, 0xff, 0xff, 0x90, 0x41, 0xff,
+  0xff, 0xff, 0x87, 0xff, 0xff, 0xc8, 0xff, 0xff, 0x8c, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xa2, 0xff,
+  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0x36, 0x00, 0x83, 0xff, 0xff, 0x65,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0x01, 0x01, 0x08, 0x82, 0xff, 0xff, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x47, 0x00, 0x83, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+  0xff, 0xff, 0x3c, 0x03, 0x84, 0xff, 0xff, 0x09, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xee, 0xff, 0xff, 0x23, 0x00, 0x82, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x01,
+  0x07, 0x82, 0xff, 0xff, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x00, 0x83, 0xff, 0xff, 0x32,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xe6, 0xff, 0xff, 0x1c, 0x06, 0x82, 0xff, 0xff, 0x75, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xbd, 0x00, 0x82, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x01,
+  0x07, 0x82, 0xff, 0xff, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x82, 0xff, 0xff, 0xa3,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x07, 0x83, 0xff, 0xff, 0x01, 0xff, 0xff, 0xcc, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x2e, 0x00, 0x82, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xfa, 0xff, 0xff, 0x04, 0x00,
+  0x06, 0x83, 0xff, 0xff, 0x15, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xed, 0xff, 0xff, 0x07, 0x00, 0x82,
+  0xff, 0xff, 0xeb, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x04, 0x08, 0x82, 0xff, 0xff, 0x6d, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x77, 0x00, 0x82, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x00,
+  0x06, 0x82, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x82, 0xff, 0xff, 0x09,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x09, 0x82, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x94, 0x00, 0x82, 0xff, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0x00, 0x05, 0x83, 0xff,
+  0xff, 0x03, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x21, 0x00, 0x82, 0xff, 0xff, 0x05,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x09, 0x82, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x90, 0x00, 0x82, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0x00, 0x05, 0x82, 0xff,
+  0xff, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x02, 0x82, 0xff, 0xff, 0xde, 0xff, 0xff, 0xfb,
+  0xff, 0xff, 0x0f, 0x08, 0x82, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x69, 0x00, 0x82,
+  0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0x00, 0x05, 0x82, 0xff, 0xff, 0xc4, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x44, 0x02, 0x82, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a,
+  0x07, 0x86, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x1c, 0xff, 0xff,
+  0x05, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xee, 0x01, 0x04, 0x82, 0xff, 0xff, 0x32, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xd4, 0x03, 0x83, 0xff, 0xff, 0x1a, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf9, 0xff, 0xff,
+  0x3c, 0x05, 0x83, 0xff, 0xff, 0x03, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x00,
+  0x82, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x01, 0x04, 0x82, 0xff, 0xff, 0x9f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x04, 0x84, 0xff, 0xff, 0x57, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xf8, 0xff, 0xff, 0x78, 0xff, 0xff, 0x0c, 0x02, 0x88, 0xff, 0xff, 0x31, 0xff, 0xff, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x0d, 0xff, 0xff, 0x05, 0xff, 0xff, 0xd7, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x35, 0x01, 0x03, 0x83, 0xff, 0xff, 0x14, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xea,
+  0xff, 0xff, 0x07, 0x05, 0x86, 0xff, 0xff, 0x55, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xf7, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xdd, 0x41, 0xff, 0xff, 0xff, 0x81, 0xff,
+  0xff, 0xbf, 0xff, 0xff, 0x17, 0x00, 0x82, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9,
+  0x02, 0x03, 0x82, 0xff, 0xff, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x07, 0x82, 0xff, 0xff,
+  0x18, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xdd, 0x41, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xf8, 0xff,
+  0xff, 0xbb, 0xff, 0xff, 0x57, 0x41, 0xff, 0xff, 0x01, 0x83, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xe1, 0xff, 0xff, 0x14, 0x02, 0x02, 0x83, 0xff, 0xff, 0x03, 0xff, 0xff, 0xe4, 0xff,
+  0xff, 0xf9, 0xff, 0xff, 0x17, 0x0a, 0x81, 0xff, 0xff, 0x06, 0xff, 0xff, 0x11, 0x02, 0x84, 0xff,
+  0xff, 0x27, 0xff, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0x26, 0x03, 0x02,
+  0x82, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x0d, 0x86, 0xff, 0xff, 0x01, 0xff,
+  0xff, 0x48, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff,
+  0x1d, 0x04, 0x02, 0x82, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x0b, 0x82, 0xff,
+  0xff, 0x15, 0xff, 0xff, 0x78, 0xff, 0xff, 0xde, 0x41, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xd8,
+  0xff, 0xff, 0x62, 0xff, 0xff, 0x01, 0x05, 0x01, 0x82, 0xff, 0xff, 0x16, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xdc, 0x00, 0x82, 0xff, 0xff, 0x68, 0xff, 0xff, 0xb9, 0xff, 0xff, 0x39, 0x06, 0x87, 0xff,
+  0xff, 0x3e, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
+  0xa9, 0xff, 0xff, 0x42, 0xff, 0xff, 0x01, 0x07, 0x01, 0x82, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xa3, 0x00, 0x82, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x03, 0x82,
+  0xff, 0xff, 0x0e, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xd5, 0x41, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff,
+  0xdf, 0xff, 0xff, 0x7a, 0xff, 0xff, 0x16, 0x0a, 0x01, 0x82, 0xff, 0xff, 0x1e, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xca, 0x00, 0x82, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x53, 0x01, 0x87,
+  0xff, 0xff, 0x2d, 0xff, 0xff, 0x97, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xb2, 0xff, 0xff, 0x4a, 0xff, 0xff, 0x01, 0x0c, 0x02, 0x82, 0xff, 0xff, 0xc6, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x76, 0x01, 0x82, 0xff, 0xff, 0x07, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xc3, 0x41,
+  0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x86, 0xff, 0xff, 0x1d, 0x0f, 0x02, 0x85,
+  0xff, 0xff, 0x2b, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xba, 0xff,
+  0xff, 0xef, 0x41, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xc6, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x06,
+  0x11, 0x03, 0x86, 0xff, 0xff, 0x25, 0xff, 0xff, 0xad, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xee, 0xff, 0xff, 0x95, 0xff, 0xff, 0x30, 0x14, 0x05, 0x82, 0xff, 0xff, 0x04, 0xff, 0xff,
+  0x12, 0xff, 0xff, 0x01, 0x16, 0x1d, 0x08, 0x84, 0xc7, 0x39, 0x0d, 0xc7, 0x39, 0x46, 0xc7, 0x39,
+  0x7a, 0xc7, 0x39, 0xa0, 0xc7, 0x39, 0xba, 0x41, 0xc7, 0x39, 0xc3, 0x84, 0xc7, 0x39, 0xbd, 0xc7,
+  0x39, 0xa6, 0xc7, 0x39, 0x81, 0xc7, 0x39, 0x50, 0xc7, 0x39, 0x16, 0x08, 0x06, 0x82, 0xc7, 0x39,
+  0x5b, 0xc7, 0x39, 0xaf, 0xc7, 0x39, 0xf0, 0x49, 0xc7, 0x39, 0xff, 0x83, 0xc7, 0x39, 0xf8, 0xc7,
+  0x39, 0xba, 0xc7, 0x39, 0x68, 0xc7, 0x39, 0x09, 0x05, 0x04, 0x81, 0xc7, 0x39, 0x6b, 0xc7, 0x39,
+  0xdb, 0x4f, 0xc7, 0x39, 0xff, 0x82, 0xc7, 0x39, 0xe8, 0xc7, 0x39, 0x7a, 0xc7, 0x39, 0x06, 0x03,
+  0x02, 0x81, 0xc7, 0x39, 0x3f, 0xc7, 0x39, 0xd2, 0x44, 0xc7, 0x39, 0xff, 0x83, 0xc7, 0x39, 0xd8,
+  0xc7, 0x39, 0xa8, 0xc7, 0x39, 0x7c, 0xc7, 0x39, 0x5f, 0x41, 0xc7, 0x39, 0x51, 0x83, 0xc7, 0x39,
+  0x5d, 0xc7, 0x39, 0x7b, 0xc7, 0x39, 0xa6, 0xc7, 0x39, 0xd5, 0x44, 0xc7, 0x39, 0xff, 0x81, 0xc7,
+  0x39, 0xe0, 0xc7, 0x39, 0x4d, 0x02, 0x01, 0x80, 0xc7, 0x39, 0x7b, 0x43, 0xc7, 0x39, 0xff, 0x82,
+  0xc7, 0x39, 0xef, 0xc7, 0x39, 0x8e, 0xc7, 0x39, 0x33, 0x09, 0x82, 0xc7, 0x39, 0x2f, 0xc7, 0x39,
+  0x89, 0xc7, 0x39, 0xeb, 0x43, 0xc7, 0x39, 0xff, 0x80, 0xc7, 0x39, 0x8d, 0x01, 0x00, 0x80, 0xc7,
+  0x39, 0xa8, 0x43, 0xc7, 0x39, 0xff, 0x81, 0xc7, 0x39, 0x83, 0xc7, 0x39, 0x0f, 0x0d, 0x82, 0xc7,
+  0x39, 0x0b, 0xc7, 0x39, 0x7a, 0xc7, 0x39, 0xfb, 0x42, 0xc7, 0x39, 0xff, 0x81, 0xc7, 0x39, 0xb6,
+  0xc7, 0x39, 0x01, 0x80, 0xc7, 0x39, 0xb3, 0x42, 0xc7, 0x39, 0xff, 0x81, 0xc7, 0x39, 0xc7, 0xc7,
+  0x39, 0x27, 0x03, 0x89, 0xc7, 0x39, 0x0f, 0xc7, 0x39, 0x53, 0xc7, 0x39, 0x8b, 0xc7, 0x39, 0xb0,
+  0xc7, 0x39, 0xc5, 0xc7, 0x39, 0xc7, 0xc7, 0x39, 0xb4, 0xc7, 0x39, 0x96, 0xc7, 0x39, 0x60, 0xc7,
+  0x39, 0x1c, 0x03, 0x81, 0xc7, 0x39, 0x20, 0xc7, 0x39, 0xbd, 0x42, 0xc7, 0x39, 0xff, 0x80, 0xc7,
+  0x39, 0xbd, 0x42, 0xc7, 0x39, 0xff, 0x80, 0xc7, 0x39, 0x99, 0x03, 0x82, 0xc7, 0x39, 0x2f, 0xc7,
+  0x39, 0x9f, 0xc7, 0x39, 0xf0, 0x47, 0xc7, 0x39, 0xff, 0x82, 0xc7, 0x39, 0xfc, 0xc7, 0x39, 0xb3,
+  0xc7, 0x39, 0x49, 0x03, 0x80, 0xc7, 0x39, 0x90, 0x42, 0xc7, 0x39, 0xff, 0x82, 0xc7, 0x39, 0x75,
+  0xc7, 0x39, 0xd6, 0xc7, 0x39, 0x87, 0x03, 0x80, 0xc7, 0x39, 0x90, 0x4d, 0xc7, 0x39, 0xff, 0x81,
+  0xc7, 0x39, 0xac, 0xc7, 0x39, 0x1a, 0x02, 0x82, 0xc7, 0x39, 0x7c, 0xc7, 0x39, 0xd7, 0xc7, 0x39,
+  0x7f, 0x04, 0x81, 0xc7, 0x39, 0x1b, 0xc7, 0x39, 0xcf, 0x43, 0xc7, 0x39, 0xff, 0x87, 0xc7, 0x39,
+  0xe7, 0xc7, 0x39, 0xaf, 0xc7, 0x39, 0x86, 0xc7, 0x39, 0x6c, 0xc7, 0x39, 0x6a, 0xc7, 0x39, 0x83,
+  0xc7, 0x39, 0xaa, 0xc7, 0x39, 0xe1, 0x43, 0xc7, 0x39, 0xff, 0x81, 0xc7, 0x39, 0xef, 0xc7, 0x39,
+  0x40, 0x04, 0x03, 0x81, 0xc7, 0x39, 0x26, 0xc7, 0x39, 0xed, 0x42, 0xc7, 0x39, 0xff, 0x82, 0xc7,
+  0x39, 0xd3, 0xc7, 0x39, 0x5e, 0xc7, 0x39, 0x06, 0x06, 0x81, 0xc7, 0x39, 0x4f, 0xc7, 0x39, 0xc1,
+  0x43, 0xc7, 0x39, 0xff, 0x80, 0xc7, 0x39, 0x45, 0x03, 0x03, 0x80, 0xc7, 0x39, 0x92, 0x42, 0xc7,
+  0x39, 0xff, 0x80, 0xc7, 0x39, 0x7d, 0x0b, 0x81, 0xc7, 0x39, 0x60, 0xc7, 0x39, 0xfe, 0x41, 0xc7,
+  0x39, 0xff, 0x80, 0xc7, 0x39, 0xcf, 0x03, 0x03, 0x83, 0xc7, 0x39, 0x38, 0xc7, 0x39, 0xf6, 0xc7,
+  0x39, 0xfa, 0xc7, 0x39, 0x4d, 0x03, 0x86, 0xc7, 0x39, 0x3c, 0xc7, 0x39, 0x89, 0xc7, 0x39, 0xb4,
+  0xc7, 0x39, 0xbd, 0xc7, 0x39, 0xa3, 0xc7, 0x39, 0x68, 0xc7, 0x39, 0x11, 0x02, 0x83, 0xc7, 0x39,
+  0x2d, 0xc7, 0x39, 0xe5, 0xc7, 0x39, 0xff, 0xc7, 0x39, 0x61, 0x03, 0x04, 0x81, 0xc7, 0x39, 0x13,
+  0xc7, 0x39, 0x16, 0x02, 0x81, 0xc7, 0x39, 0x26, 0xc7, 0x39, 0xbe, 0x45, 0xc7, 0x39, 0xff, 0x81,
+  0xc7, 0x39, 0xf1, 0xc7, 0x39, 0x79, 0x02, 0x81, 0xc7, 0x39, 0x08, 0xc7, 0x39, 0x1b, 0x04, 0x08,
+  0x81, 0xc7, 0x39, 0x3f, 0xc7, 0x39, 0xfa, 0x48, 0xc7, 0x39, 0xff, 0x81, 0xc7, 0x39, 0xa8, 0xc7,
+  0x39, 0x01, 0x07, 0x07, 0x81, 0xc7, 0x39, 0x06, 0xc7, 0x39, 0xfb, 0x42, 0xc7, 0x39, 0xff, 0x83,
+  0xc7, 0x39, 0xda, 0xc7, 0x39, 0xa1, 0xc7, 0x39, 0x9a, 0xc7, 0x39, 0xbd, 0x43, 0xc7, 0x39, 0xff,
+  0x80, 0xc7, 0x39, 0x7b, 0x07, 0x07, 0x81, 0xc7, 0x39, 0x07, 0xc7, 0x39, 0xfc, 0x41, 0xc7, 0x39,
+  0xff, 0x80, 0xc7, 0x39, 0x6d, 0x03, 0x81, 0xc7, 0x39, 0x2e, 0xc7, 0x39, 0xc9, 0x41, 0xc7, 0x39,
+  0xff, 0x80, 0xc7, 0x39, 0x7e, 0x07, 0x08, 0x82, 0xc7, 0x39, 0x35, 0xc7, 0x39, 0x93, 0xc7, 0x39,
+  0x41, 0x06, 0x82, 0xc7, 0x39, 0x8b, 0xc7, 0x39, 0x88, 0xc7, 0x39, 0x02, 0x07, 0x0c, 0x83, 0xc7,
+  0x39, 0x4e, 0xc7, 0x39, 0xc4, 0xc7, 0x39, 0xd0, 0xc7, 0x39, 0x83, 0x0c, 0x0b, 0x80, 0xc7, 0x39,
+  0x40, 0x43, 0xc7, 0x39, 0xff, 0x80, 0xc7, 0x39, 0x9a, 0x0b, 0x0b, 0x80, 0xc7, 0x39, 0xbb, 0x44,
+  0xc7, 0x39, 0xff, 0x80, 0xc7, 0x39, 0x0f, 0x0a, 0x0b, 0x80, 0xc7, 0x39, 0xbf, 0x44, 0xc7, 0x39,
+  0xff, 0x80, 0xc7, 0x39, 0x11, 0x0a, 0x0b, 0x80, 0xc7, 0x39, 0x4a, 0x43, 0xc7, 0x39, 0xff, 0x80,
+  0xc7, 0x39, 0xa2, 0x0b, 0x0c, 0x83, 0xc7, 0x39, 0x5c, 0xc7, 0x39, 0xcb, 0xc7, 0x39, 0xd7, 0xc7,
+  0x39, 0x91, 0x0c, 0x07, 0x81, 0xc7, 0x39, 0x06, 0xc7, 0x39, 0xfb, 0x42, 0xc7, 0x39, 0xff, 0x83,
+  0xa6, 0x31, 0xda, 0x24, 0x21, 0xa1, 0x04, 0x21, 0x9a, 0x66, 0x31, 0xbd, 0x43, 0xc7, 0x39, 0xff,
+  0x80, 0xc7, 0x39, 0x7b, 0x07, 0x07, 0x84, 0xc7, 0x39, 0x07, 0xc7, 0x39, 0xfc, 0xc7, 0x39, 0xff,
+  0xe7, 0x39, 0xff, 0x24, 0x21, 0x6d, 0x03, 0x81, 0xc3, 0x18, 0x2e, 0xa7, 0x39, 0xc9, 0x41, 0xc7,
+  0x39, 0xff, 0x80, 0xc7, 0x39, 0x7e, 0x07, 0x08, 0x82, 0xc7, 0x39, 0x35, 0xc7, 0x39, 0x93, 0xc3,
+  0x18, 0x41, 0x06, 0x82, 0x86, 0x31, 0x8b, 0xc7, 0x39, 0x88, 0xc7, 0x39, 0x02, 0x07, 0x0c, 0x83,
+  0xff, 0xff, 0x4e, 0x5d, 0xef, 0xc4, 0x3c, 0xe7, 0xd0, 0xdf, 0xff, 0x83, 0x0c, 0x0b, 0x81, 0xff,
+  0xff, 0x40, 0xfb, 0xde, 0xff, 0x41, 0x1b, 0xdf, 0xff, 0x81, 0xfb, 0xde, 0xff, 0x7d, 0xef, 0x9a,
+  0x0b, 0x0b, 0x80, 0xfb, 0xde, 0xbb, 0x43, 0x1b, 0xdf, 0xff, 0x81, 0xfb, 0xde, 0xff, 0x3c, 0xe7,
+  0x0f, 0x0a, 0x0b, 0x80, 0x1b, 0xdf, 0xbf, 0x44, 0x1b, 0xdf, 0xff, 0x80, 0x1b, 0xdf, 0x11, 0x0a,
+  0x0b, 0x80, 0x1b, 0xdf, 0x4a, 0x43, 0x1b, 0xdf, 0xff, 0x80, 0x1b, 0xdf, 0xa2, 0x0b, 0x0c, 0x83,
+  0x1b, 0xdf, 0x5c, 0x1b, 0xdf, 0xcb, 0x1b, 0xdf, 0xd7, 0x1b, 0xdf, 0x91, 0x0c, 0x04, 0x81, 0xc7,
+  0x39, 0x1b, 0xc7, 0x39, 0xcf, 0x43, 0xc7, 0x39, 0xff, 0x87, 0xc7, 0x39, 0xe7, 0xa6, 0x31, 0xaf,
+  0x45, 0x29, 0x86, 0x04, 0x21, 0x6c, 0x04, 0x21, 0x6a, 0x24, 0x21, 0x83, 0x86, 0x31, 0xaa, 0xc7,
+  0x39, 0xe1, 0x43, 0xc7, 0x39, 0xff, 0x81, 0xc7, 0x39, 0xef, 0xc7, 0x39, 0x40, 0x04, 0x03, 0x81,
+  0xc7, 0x39, 0x26, 0xc7, 0x39, 0xed, 0x42, 0xc7, 0x39, 0xff, 0x82, 0xc7, 0x39, 0xd3, 0x65, 0x29,
+  0x5e, 0xa3, 0x18, 0x06, 0x06, 0x81, 0x24, 0x21, 0x4f, 0xc7, 0x39, 0xc1, 0x43, 0xc7, 0x39, 0xff,
+  0x80, 0xc7, 0x39, 0x45, 0x03, 0x03, 0x80, 0xc7, 0x39, 0x92, 0x42, 0xc7, 0x39, 0xff, 0x80, 0xc7,
+  0x39, 0x7d, 0x0b, 0x81, 0x86, 0x31, 0x60, 0xc7, 0x39, 0xfe, 0x41, 0xc7, 0x39, 0xff, 0x80, 0xc7,
+  0x39, 0xcf, 0x03, 0x03, 0x83, 0xc7, 0x39, 0x38, 0xc7, 0x39, 0xf6, 0xc7, 0x39, 0xfa, 0xa6, 0x31,
+  0x4d, 0x03, 0x86, 0xdf, 0xff, 0x3c, 0x5d, 0xef, 0x89, 0x3c, 0xe7, 0xb4, 0x3c, 0xe7, 0xbd, 0x5c,
+  0xe7, 0xa3, 0xbe, 0xf7, 0x68, 0xff, 0xff, 0x11, 0x02, 0x83, 0x25, 0x29, 0x2d, 0xe7, 0x39, 0xe5,
+  0xc7, 0x39, 0xff, 0xc7, 0x39, 0x61, 0x03, 0x04, 0x81, 0xc7, 0x39, 0x13, 0x86, 0x31, 0x16, 0x02,
+  0x81, 0xff, 0xff, 0x26, 0xfb, 0xde, 0xbe, 0x45, 0x1b, 0xdf, 0xff, 0x81, 0xfb, 0xde, 0xf1, 0x7d,
+  0xef, 0x79, 0x02, 0x81, 0x04, 0x21, 0x08, 0xe7, 0x39, 0x1b, 0x04, 0x08, 0x81, 0x9d, 0xef, 0x3f,
+  0xfb, 0xde, 0xfa, 0x47, 0x1b, 0xdf, 0xff, 0x82, 0xfb, 0xde, 0xff, 0x1c, 0xe7, 0xa8, 0xff, 0xff,
+  0x01, 0x07, 0x07, 0x81, 0x7d, 0xef, 0x06, 0xfb, 0xde, 0xfb, 0x42, 0x1b, 0xdf, 0xff, 0x83, 0x1b,
+  0xdf, 0xda, 0x1b, 0xdf, 0xa1, 0x1b, 0xdf, 0x9a, 0x1b, 0xdf, 0xbd, 0x43, 0x1b, 0xdf, 0xff, 0x80,
+  0x1b, 0xdf, 0x7b, 0x07, 0x07, 0x81, 0xfb, 0xde, 0x07, 0x1b, 0xdf, 0xfc, 0x41, 0x1b, 0xdf, 0xff,
+  0x80, 0x1b, 0xdf, 0x6d, 0x03, 0x81, 0x1b, 0xdf, 0x2e, 0x1b, 0xdf, 0xc9, 0x41, 0x1b, 0xdf, 0xff,
+  0x80, 0x1b, 0xdf, 0x7e, 0x07, 0x08, 0x82, 0x1b, 0xdf, 0x35, 0x1b, 0xdf, 0x93, 0x1b, 0xdf, 0x41,
+  0x06, 0x82, 0x1b, 0xdf, 0x8b, 0x1b, 0xdf, 0x88, 0x1b, 0xdf, 0x02, 0x07, 0x0c, 0x83, 0x1b, 0xdf,
+  0x4e, 0x1b, 0xdf, 0xc4, 0x1b, 0xdf, 0xd0, 0x1b, 0xdf, 0x83, 0x0c, 0x0b, 0x80, 0x1b, 0xdf, 0x40,
+  0x43, 0x1b, 0xdf, 0xff, 0x80, 0x1b, 0xdf, 0x9a, 0x0b, 0x0b, 0x80, 0x1b, 0xdf, 0xbb, 0x44, 0x1b,
+  0xdf, 0xff, 0x80, 0x1b, 0xdf, 0x0f, 0x0a, 0x02, 0x81, 0xc7, 0x39, 0x3f, 0xc7, 0x39, 0xd2, 0x44,
+  0xc7, 0x39, 0xff, 0x83, 0xc7, 0x39, 0xd8, 0x86, 0x31, 0xa8, 0x45, 0x29, 0x7c, 0x04, 0x21, 0x5f,
+  0x41, 0x04, 0x21, 0x51, 0x83, 0x04, 0x21, 0x5d, 0x45, 0x29, 0x7b, 0x86, 0x31, 0xa6, 0xc7, 0x39,
+  0xd5, 0x44, 0xc7, 0x39, 0xff, 0x81, 0xc7, 0x39, 0xe0, 0xc7, 0x39, 0x4d, 0x02, 0x01, 0x80, 0xc7,
+  0x39, 0x7b, 0x43, 0xc7, 0x39, 0xff, 0x82, 0xc7, 0x39, 0xef, 0xa6, 0x31, 0x8e, 0xe4, 0x20, 0x33,
+  0x09, 0x82, 0xc3, 0x18, 0x2f, 0x86, 0x31, 0x89, 0xc7, 0x39, 0xeb, 0x43, 0xc7, 0x39, 0xff, 0x80,
+  0xc7, 0x39, 0x8d, 0x01, 0x00, 0x80, 0xc7, 0x39, 0xa8, 0x43, 0xc7, 0x39, 0xff, 0x81, 0xa6, 0x31,
+  0x83, 0xc3, 0x18, 0x0f, 0x0d, 0x82, 0xa3, 0x18, 0x0b, 0x86, 0x31, 0x7a, 0xc7, 0x39, 0xfb, 0x42,
+  0xc7, 0x39, 0xff, 0x81, 0xc7, 0x39, 0xb6, 0xc7, 0x39, 0x01, 0x80, 0xc7, 0x39, 0xb3, 0x42, 0xc7,
+  0x39, 0xff, 0x81, 0xe7, 0x39, 0xc7, 0x24, 0x21, 0x27, 0x03, 0x89, 0xff, 0xff, 0x0f, 0xbe, 0xf7,
+  0x53, 0x5d, 0xef, 0x8b, 0x3c, 0xe7, 0xb0, 0x3c, 0xe7, 0xc5, 0x3c, 0xe7, 0xc7, 0x3c, 0xe7, 0xb4,
+  0x5d, 0xef, 0x96, 0x9e, 0xf7, 0x60, 0xff, 0xff, 0x1c, 0x03, 0x81, 0xe4, 0x20, 0x20, 0xc7, 0x39,
+  0xbd, 0x42, 0xc7, 0x39, 0xff, 0x80, 0xc7, 0x39, 0xbd, 0x42, 0xc7, 0x39, 0xff, 0x80, 0xc7, 0x39,
+  0x99, 0x03, 0x82, 0xff, 0xff, 0x2f, 0x1c, 0xe7, 0x9f, 0x1b, 0xdf, 0xf0, 0x47, 0x1b, 0xdf, 0xff,
+  0x82, 0x1b, 0xdf, 0xfc, 0x1c, 0xe7, 0xb3, 0xde, 0xf7, 0x49, 0x03, 0x80, 0xc7, 0x39, 0x90, 0x42,
+  0xc7, 0x39, 0xff, 0x82, 0xc7, 0x39, 0x75, 0xc7, 0x39, 0xd6, 0xc7, 0x39, 0x87, 0x03, 0x81, 0x3c,
+  0xe7, 0x90, 0xfb, 0xde, 0xff, 0x4c, 0x1b, 0xdf, 0xff, 0x81, 0x1b, 0xdf, 0xac, 0xff, 0xff, 0x1a,
+  0x02, 0x82, 0xa6, 0x31, 0x7c, 0xc7, 0x39, 0xd7, 0xc7, 0x39, 0x7f, 0x04, 0x81, 0xff, 0xff, 0x1b,
+  0xfb, 0xde, 0xcf, 0x43, 0x1b, 0xdf, 0xff, 0x87, 0x1b, 0xdf, 0xe7, 0x1b, 0xdf, 0xaf, 0x1b, 0xdf,
+  0x86, 0x1b, 0xdf, 0x6c, 0x1b, 0xdf, 0x6a, 0x1b, 0xdf, 0x83, 0x1b, 0xdf, 0xaa, 0x1b, 0xdf, 0xe1,
+  0x43, 0x1b, 0xdf, 0xff, 0x81, 0xfb, 0xde, 0xef, 0xde, 0xf7, 0x40, 0x04, 0x03, 0x81, 0xbe, 0xf7,
+  0x26, 0xfb, 0xde, 0xed, 0x42, 0x1b, 0xdf, 0xff, 0x82, 0x1b, 0xdf, 0xd3, 0x1b, 0xdf, 0x5e, 0x1b,
+  0xdf, 0x06, 0x06, 0x81, 0x1b, 0xdf, 0x4f, 0x1b, 0xdf, 0xc1, 0x42, 0x1b, 0xdf, 0xff, 0x81, 0xfb,
+  0xde, 0xff, 0x9d, 0xef, 0x45, 0x03, 0x03, 0x80, 0xfb, 0xde, 0x92, 0x42, 0x1b, 0xdf, 0xff, 0x80,
+  0x1b, 0xdf, 0x7d, 0x0b, 0x81, 0x1b, 0xdf, 0x60, 0x1b, 0xdf, 0xfe, 0x41, 0x1b, 0xdf, 0xff, 0x80,
+  0xfb, 0xde, 0xcf, 0x03, 0x03, 0x83, 0x1b, 0xdf, 0x38, 0x1b, 0xdf, 0xf6, 0x1b, 0xdf, 0xfa, 0x1b,
+  0xdf, 0x4d, 0x03, 0x86, 0x1b, 0xdf, 0x3c, 0x1b, 0xdf, 0x89, 0x1b, 0xdf, 0xb4, 0x1b, 0xdf, 0xbd,
+  0x1b, 0xdf, 0xa3, 0x1b, 0xdf, 0x68, 0x1b, 0xdf, 0x11, 0x02, 0x83, 0x1b, 0xdf, 0x2d, 0x1b, 0xdf,
+  0xe5, 0x1b, 0xdf, 0xff, 0x1b, 0xdf, 0x61, 0x03, 0x04, 0x81, 0x1b, 0xdf, 0x13, 0x1b, 0xdf, 0x16,
+  0x02, 0x81, 0x1b, 0xdf, 0x26, 0x1b, 0xdf, 0xbe, 0x45, 0x1b, 0xdf, 0xff, 0x81, 0x1b, 0xdf, 0xf1,
+  0x1b, 0xdf, 0x79, 0x02, 0x81, 0x1b, 0xdf, 0x08, 0x1b, 0xdf, 0x1b, 0x04, 0x08, 0x81, 0x1b, 0xdf,
+  0x3f, 0x1b, 0xdf, 0xfa, 0x48, 0x1b, 0xdf, 0xff, 0x81, 0x1b, 0xdf, 0xa8, 0x1b, 0xdf, 0x01, 0x07,
+  0x07, 0x81, 0x1b, 0xdf, 0x06, 0x1b, 0xdf, 0xfb, 0x42, 0x1b, 0xdf, 0xff, 0x83, 0x1b, 0xdf, 0xda,
+  0x1b, 0xdf, 0xa1, 0x1b, 0xdf, 0x9a, 0x1b, 0xdf, 0xbd, 0x43, 0x1b, 0xdf, 0xff, 0x80, 0x1b, 0xdf,
+  0x7b, 0x07, 0x07, 0x81, 0x1b, 0xdf, 0x07, 0x1b, 0xdf, 0xfc, 0x41, 0x1b, 0xdf, 0xff, 0x80, 0x1b,
+  0xdf, 0x6d, 0x03, 0x81, 0x1b, 0xdf, 0x2e, 0x1b, 0xdf, 0xc9, 0x41, 0x1b, 0xdf, 0xff, 0x80, 0x1b,
+  0xdf, 0x7e, 0x07, 0x08, 0x84, 0x1b, 0xdf, 0x0d, 0x1b, 0xdf, 0x46, 0x1b, 0xdf, 0x7a, 0x1b, 0xdf,
+  0xa0, 0x1b, 0xdf, 0xba, 0x41, 0x1b, 0xdf, 0xc3, 0x84, 0x1b, 0xdf, 0xbd, 0x1b, 0xdf, 0xa6, 0x1b,
+  0xdf, 0x81, 0x1b, 0xdf, 0x50, 0x1b, 0xdf, 0x16, 0x08, 0x06, 0x82, 0x1b, 0xdf, 0x5b, 0x1b, 0xdf,
+  0xaf, 0x1b, 0xdf, 0xf0, 0x49, 0x1b, 0xdf, 0xff, 0x83, 0x1b, 0xdf, 0xf8, 0x1b, 0xdf, 0xba, 0x1b,
+  0xdf, 0x68, 0x1b, 0xdf, 0x09, 0x05, 0x04, 0x81, 0x1b, 0xdf, 0x6b, 0x1b, 0xdf, 0xdb, 0x4f, 0x1b,
+  0xdf, 0xff, 0x82, 0x1b, 0xdf, 0xe8, 0x1b, 0xdf, 0x7a, 0x1b, 0xdf, 0x06, 0x03, 0x02, 0x81, 0x1b,
+  0xdf, 0x3f, 0x1b, 0xdf, 0xd2, 0x44, 0x1b, 0xdf, 0xff, 0x83, 0x1b, 0xdf, 0xd8, 0x1b, 0xdf, 0xa8,
+  0x1b, 0xdf, 0x7c, 0x1b, 0xdf, 0x5f, 0x41, 0x1b, 0xdf, 0x51, 0x83, 0x1b, 0xdf, 0x5d, 0x1b, 0xdf,
+  0x7b, 0x1b, 0xdf, 0xa6, 0x1b, 0xdf, 0xd5, 0x44, 0x1b, 0xdf, 0xff, 0x81, 0x1b, 0xdf, 0xe0, 0x1b,
+  0xdf, 0x4d, 0x02, 0x01, 0x80, 0x1b, 0xdf, 0x7b, 0x43, 0x1b, 0xdf, 0xff, 0x82, 0x1b, 0xdf, 0xef,
+  0x1b, 0xdf, 0x8e, 0x1b, 0xdf, 0x33, 0x09, 0x82, 0x1b, 0xdf, 0x2f, 0x1b, 0xdf, 0x89, 0x1b, 0xdf,
+  0xeb, 0x43, 0x1b, 0xdf, 0xff, 0x80, 0x1b, 0xdf, 0x8d, 0x01, 0x00, 0x80, 0x1b, 0xdf, 0xa8, 0x43,
+  0x1b, 0xdf, 0xff, 0x81, 0x1b, 0xdf, 0x83, 0x1b, 0xdf, 0x0f, 0x0d, 0x82, 0x1b, 0xdf, 0x0b, 0x1b,
+  0xdf, 0x7a, 0x1b, 0xdf, 0xfb, 0x42, 0x1b, 0xdf, 0xff, 0x81, 0x1b, 0xdf, 0xb6, 0x1b, 0xdf, 0x01,
+  0x80, 0x1b, 0xdf, 0xb3, 0x42, 0x1b, 0xdf, 0xff, 0x81, 0x1b, 0xdf, 0xc7, 0x1b, 0xdf, 0x27, 0x03,
+  0x89, 0x1b, 0xdf, 0x0f, 0x1b, 0xdf, 0x53, 0x1b, 0xdf, 0x8b, 0x1b, 0xdf, 0xb0, 0x1b, 0xdf, 0xc5,
+  0x1b, 0xdf, 0xc7, 0x1b, 0xdf, 0xb4, 0x1b, 0xdf, 0x96, 0x1b, 0xdf, 0x60, 0x1b, 0xdf, 0x1c, 0x03,
+  0x81, 0x1b, 0xdf, 0x20, 0x1b, 0xdf, 0xbd, 0x42, 0x1b, 0xdf, 0xff, 0x80, 0x1b, 0xdf, 0xbd, 0x42,
+  0x1b, 0xdf, 0xff, 0x80, 0x1b, 0xdf, 0x99, 0x03, 0x82, 0x1b, 0xdf, 0x2f, 0x1b, 0xdf, 0x9f, 0x1b,
+  0xdf, 0xf0, 0x47, 0x1b, 0xdf, 0xff, 0x82, 0x1b, 0xdf, 0xfc, 0x1b, 0xdf, 0xb3, 0x1b, 0xdf, 0x49,
+  0x03, 0x80, 0x1b, 0xdf, 0x90, 0x42, 0x1b, 0xdf, 0xff, 0x82, 0x1b, 0xdf, 0x75, 0x1b, 0xdf, 0xd6,
+  0x1b, 0xdf, 0x87, 0x03, 0x80, 0x1b, 0xdf, 0x90, 0x4d, 0x1b, 0xdf, 0xff, 0x81, 0x1b, 0xdf, 0xac,
+  0x1b, 0xdf, 0x1a, 0x02, 0x82, 0x1b, 0xdf, 0x7c, 0x1b, 0xdf, 0xd7, 0x1b, 0xdf, 0x7f, 0x04, 0x81,
+  0x1b, 0xdf, 0x1b, 0x1b, 0xdf, 0xcf, 0x43, 0x1b, 0xdf, 0xff, 0x87, 0x1b, 0xdf, 0xe7, 0x1b, 0xdf,
+  0xaf, 0x1b, 0xdf, 0x86, 0x1b, 0xdf, 0x6c, 0x1b, 0xdf, 0x6a, 0x1b, 0xdf, 0x83, 0x1b, 0xdf, 0xaa,
+  0x1b, 0xdf, 0xe1, 0x43, 0x1b, 0xdf, 0xff, 0x81, 0x1b, 0xdf, 0xef, 0x1b, 0xdf, 0x40, 0x04, 0x03,
+  0x81, 0x1b, 0xdf, 0x26, 0x1b, 0xdf, 0xed, 0x42, 0x1b, 0xdf, 0xff, 0x82, 0x1b, 0xdf, 0xd3, 0x1b,
+  0xdf, 0x5e, 0x1b, 0xdf, 0x06, 0x06, 0x81, 0x1b, 0xdf, 0x4f, 0x1b, 0xdf, 0xc1, 0x43, 0x1b, 0xdf,
+  0xff, 0x80, 0x1b, 0xdf, 0x45, 0x03, 0x03, 0x80, 0x1b, 0xdf, 0x92, 0x42, 0x1b, 0xdf, 0xff, 0x80,
+  0x1b, 0xdf, 0x7d, 0x0b, 0x81, 0x1b, 0xdf, 0x60, 0x1b, 0xdf, 0xfe, 0x41, 0x1b, 0xdf, 0xff, 0x80,
+  0x1b, 0xdf, 0xcf, 0x03,
+};
+
+static const uint16_t makeit_logo_rows[80] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 9, 36, 59, 80, 117, 206, 293, 382,
+  471, 652, 851, 1048, 1291, 1510, 1723, 1916, 2107, 2322, 2535, 2764,
+  2995, 3179, 3404, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const ui_img_rle_t makeit_logo_rle = {
+  .pool = s_row_pool,
+  .rows = makeit_logo_rows,
+  .alpha = 0,
+};
+
+static const lv_img_dsc_t makeit_logo = {
+  .header.always_zero = 0,
+  .header.w = 160,
+  .header.h = 80,
+  .data_size = sizeof(ui_img_rle_t),
+  .header.cf = UI_IMG_CF_RLE,
+  .data = (const uint8_t *) &makeit_logo_rle,
+};
+
+static const uint16_t ratt_logo_rows[80] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 3561, 3589, 3635,
+  3726, 3809, 3908, 4015, 4100, 4211, 4378, 4505, 4618, 4729, 4834, 4935,
+  5028, 5119, 5212, 5331, 5446, 5555, 5664, 5767, 5860, 5943, 6032, 6165,
+  6286, 6383, 6518, 6643, 6780, 6903, 7004, 7141, 7286, 7391, 7448, 7470,
+  7498, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const ui_img_rle_t ratt_logo_rle = {
+  .pool = s_row_pool,
+  .rows = ratt_logo_rows,
+  .alpha = 0,
+};
+
+static const lv_img_dsc_t ratt_logo = {
+  .header.always_zero = 0,
+  .header.w = 160,
+  .header.h = 80,
+  .data_size = sizeof(ui_img_rle_t),
+  .header.cf = UI_IMG_CF_RLE,
+  .data = (const uint8_t *) &ratt_logo_rle,
+};
+
+static const uint16_t rfid_tag_rows[32] = {
+  7524, 7524, 7525, 7555, 7592, 7635, 7687, 7738, 7802, 7856, 7904, 7952,
+  8000, 8045, 8093, 8138, 8184, 8235, 8293, 8353, 8407, 8447, 8482, 8519,
+  8568, 8616, 8665, 8702, 8737, 8761, 7524, 7524,
+};
+
+static const ui_img_rle_t rfid_tag_rle = {
+  .pool = s_row_pool,
+  .rows = rfid_tag_rows,
+  .alpha = 1,
+};
+
+static const lv_img_dsc_t rfid_tag = {
+  .header.always_zero = 0,
+  .header.w = 32,
+  .header.h = 32,
+  .data_size = sizeof(ui_img_rle_t),
+  .header.cf = UI_IMG_CF_RLE,
+  .data = (const uint8_t *) &rfid_tag_rle,
+};
+
+static const uint16_t wifi_0_rows[30] = {
+  8773, 8773, 8773, 8774, 8812, 8841, 8864, 8918, 8957, 8995, 9058, 9100,
+  9137, 9186, 9225, 9255, 9307, 9343, 9363, 9397, 9430, 9453, 9468, 9482,
+  9496, 9510, 9524, 8773, 8773, 8773,
+};
+
+static const ui_img_rle_t wifi_0_rle = {
+  .pool = s_row_pool,
+  .rows = wifi_0_rows,
+  .alpha = 1,
+};
+
+static const lv_img_dsc_t wifi_0 = {
+  .header.always_zero = 0,
+  .header.w = 30,
+  .header.h = 30,
+  .data_size = sizeof(ui_img_rle_t),
+  .header.cf = UI_IMG_CF_RLE,
+  .data = (const uint8_t *) &wifi_0_rle,
+};
+
+static const uint16_t wifi_1_rows[30] = {
+  8773, 8773, 8773, 8774, 8812, 8841, 8864, 8918, 8957, 8995, 9058, 9100,
+  9137, 9186, 9225, 9255, 9307, 9343, 9539, 9573, 9607, 9630, 9645, 9665,
+  9682, 9696, 9710, 8773, 8773, 8773,
+};
+
+static const ui_img_rle_t wifi_1_rle = {
+  .pool = s_row_pool,
+  .rows = wifi_1_rows,
+  .alpha = 1,
+};
+
+static const lv_img_dsc_t wifi_1 = {
+  .header.always_zero = 0,
+  .header.w = 30,
+  .header.h = 30,
+  .data_size = sizeof(ui_img_rle_t),
+  .header.cf = UI_IMG_CF_RLE,
+  .data = (const uint8_t *) &wifi_1_rle,
+};
+
+static const uint16_t wifi_2_rows[30] = {
+  8773, 8773, 8773, 8774, 8812, 8841, 8864, 8918, 8957, 8995, 9058, 9100,
+  9725, 9774, 9813, 9843, 9895, 9931, 9954, 9988, 10021, 10044, 10059, 10073,
+  9682, 9696, 9710, 8773, 8773, 8773,
+};
+
+static const ui_img_rle_t wifi_2_rle = {
+  .pool = s_row_pool,
+  .rows = wifi_2_rows,
+  .alpha = 1,
+};
+
+static const lv_img_dsc_t wifi_2 = {
+  .header.always_zero = 0,
+  .header.w = 30,
+  .header.h = 30,
+  .data_size = sizeof(ui_img_rle_t),
+  .header.cf = UI_IMG_CF_RLE,
+  .data = (const uint8_t *) &wifi_2_rle,
+};
+
+static const uint16_t wifi_3_rows[30] = {
+  8773, 8773, 8773, 8774, 8812, 8841, 10087, 10141, 10180, 10218, 10281, 10323,
+  10363, 10412, 10454, 10484, 10536, 10572, 10592, 10626, 10021, 10044, 10059, 10073,
+  9682, 9696, 9710, 8773, 8773, 8773,
+};
+
+static const ui_img_rle_t wifi_3_rle = {
+  .pool = s_row_pool,
+  .rows = wifi_3_rows,
+  .alpha = 1,
+};
+
+static const lv_img_dsc_t wifi_3 = {
+  .header.always_zero = 0,
+  .header.w = 30,
+  .header.h = 30,
+  .data_size = sizeof(ui_img_rle_t),
+  .header.cf = UI_IMG_CF_RLE,
+  .data = (const uint8_t *) &wifi_3_rle,
+};
+
+static const uint16_t wifi_4_rows[30] = {
+  8773, 8773, 8773, 10659, 10697, 10726, 10749, 10803, 10842, 10880, 10943, 10985,
+  11022, 11071, 11110, 10484, 10536, 10572, 10592, 10626, 10021, 10044, 10059, 10073,
+  9682, 9696, 9710, 8773, 8773, 8773,
+};
+
+static const ui_img_rle_t wifi_4_rle = {
+  .pool = s_row_pool,
+  .rows = wifi_4_rows,
+  .alpha = 1,
+};
+
+static const lv_img_dsc_t wifi_4 = {
+  .header.always_zero = 0,
+  .header.w = 30,
+  .header.h = 30,
+  .data_size = sizeof(ui_img_rle_t),
+  .header.cf = UI_IMG_CF_RLE,
+  .data = (const uint8_t *) &wifi_4_rle,
+};
+
+void ui_img_add_builtin(void)
+{
+  ui_img_add("makeit_logo", &makeit_logo);
+  ui_img_add("ratt_logo", &ratt_logo);
+  ui_img_add("rfid_tag", &rfid_tag);
+  ui_img_add("wifi_0", &wifi_0);
+  ui_img_add("wifi_1", &wifi_1);
+  ui_img_add("wifi_2", &wifi_2);
+  ui_img_add("wifi_3", &wifi_3);
+  ui_img_add("wifi_4", &wifi_4);
+}
@@ -0,0 +1,240 @@
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+#include <string.h>
+#include "ui_bind.h"
+
+#define BIND_TEXT         (1 << 0)
+#define BIND_TEXT_STATIC  (1 << 1)
+#define BIND_TEXT_COLOR   (1 << 2)
+#define BIND_FONT         (1 << 3)
+#define BIND_IMG_SRC      (1 << 4)
+#define BIND_IMG_RECOLOR  (1 << 5)
+#define BIND_OPA          (1 << 6)
+#define BIND_HIDDEN       (1 << 7)
+#define BIND_VALUE        (1 << 8)
+
+typedef struct {
+  lv_opa_t from;
+  lv_opa_t to;
+  uint16_t period;
+} blink_dsc_t;
+
+// On/off blinks toggle from a sparse lv_timer; an lv_anim would be stepped
+// every display refresh period and keep the display task awake.  Only the
+// pulse fade, which really changes continuously, uses lv_anim.
+static const blink_dsc_t s_blink_dsc[] = {
+  [UI_BLINK_PULSE] = { LV_OPA_COVER, LV_OPA_20, 1500 },
+  [UI_BLINK_SLOW]  = { LV_OPA_COVER, LV_OPA_TRANSP, 1500 },
+  [UI_BLINK_TICK]  = { LV_OPA_COVER, LV_OPA_TRANSP, 500 },
+  [UI_BLINK_FLASH] = { LV_OPA_COVER, LV_OPA_30, 100 },
+};
+
+static int32_t pulse_path(const lv_anim_t *a)
+{
+  // quantize the fade so the label is redrawn ~12 times per sweep
+  // instead of on every animation tick
+  return lv_anim_path_ease_in_out(a) & ~0x0F;
+}
+
+void ui_bind_init(ui_bind_t *b, lv_obj_t *obj)
+{
+  memset(b, 0, sizeof(*b));
+  b->obj = obj;
+}
+
+bool ui_bind_text(ui_bind_t *b, const char *text)
+{
+  if ((b->valid & BIND_TEXT) && strncmp(b->text, text, sizeof(b->text)) == 0)
+    return false;
+
+  strncpy(b->text, text, sizeof(b->text) - 1);
+  b->text[sizeof(b->text) - 1] = '\0';
+  b->valid = (b->valid | BIND_TEXT) & ~BIND_TEXT_STATIC;
+  lv_label_set_text(b->obj, text);
+  return true;
+}
+
+bool ui_bind_text_static(ui_bind_t *b, const char *text)
+{
+  if ((b->valid & BIND_TEXT_STATIC) && b->text_static == text)
+    return false;
+
+  b->text_static = text;
+  b->valid = (b->valid | BIND_TEXT_STATIC) & ~BIND_TEXT;
+  lv_label_set_text_static(b->obj, text);
+  return true;
+}
+
+bool ui_bind_text_color(ui_bind_t *b, lv_color_t color)
+{
+  if ((b->valid & BIND_TEXT_COLOR) && b->text_color.full == color.full)
+    return false;
+
+  b->text_color = color;
+  b->valid |= BIND_TEXT_COLOR;
+  lv_obj_set_style_text_color(b->obj, color, 0);
+  return true;
+}
+
+bool ui_bind_font(ui_bind_t *b, const lv_font_t *font)
+{
+  if ((b->valid & BIND_FONT) && b->font == font)
+    return false;
+
+  b->font = font;
+  b->valid |= BIND_FONT;
+  lv_obj_set_style_text_font(b->obj, font, 0);
+  return true;
+}
+
+bool ui_bind_img_src(ui_bind_t *b, const void *src)
+{
+  if ((b->valid & BIND_IMG_SRC) && b->img_src == src)
+    return false;
+
+  b->img_src = src;
+  b->valid |= BIND_IMG_SRC;
+  lv_img_set_src(b->obj, src);
+  return true;
+}
+
+bool ui_bind_img_recolor(ui_bind_t *b, lv_color_t color)
+{
+  if ((b->valid & BIND_IMG_RECOLOR) && b->img_recolor.full == color.full)
+    return false;
+
+  b->img_recolor = color;
+  b->valid |= BIND_IMG_RECOLOR;
+  lv_obj_set_style_img_recolor(b->obj, color, 0);
+  return true;
+}
+
+bool ui_bind_opa(ui_bind_t *b, lv_opa_t opa)
+{
+  if ((b->valid & BIND_OPA) && b->opa == opa)
+    return false;
+
+  b->opa = opa;
+  b->valid |= BIND_OPA;
+  lv_obj_set_style_opa(b->obj, opa, 0);
+  return true;
+}
+
+bool ui_bind_hidden(ui_bind_t *b, bool hidden)
+{
+  if ((b->valid & BIND_HIDDEN) && b->hidden == hidden)
+    return false;
+
+  b->hidden = hidden;
+  b->valid |= BIND_HIDDEN;
+  if (hidden)
+    lv_obj_add_flag(b->obj, LV_OBJ_FLAG_HIDDEN);
+  else
+    lv_obj_clear_flag(b->obj, LV_OBJ_FLAG_HIDDEN);
+  return true;
+}
+
+// plain change detector for values the caller renders itself
+bool ui_bind_value(ui_bind_t *b, int32_t value)
+{
+  if ((b->valid & BIND_VALUE) && b->value == value)
+    return false;
+
+  b->value = value;
+  b->valid |= BIND_VALUE;
+  return true;
+}
+
+static void pulse_exec_cb(void *var, int32_t v)
+{
+  ui_bind_opa((ui_bind_t *) var, (lv_opa_t) v);
+}
+
+static void blink_stop(ui_bind_t *b)
+{
+  lv_anim_del(b, pulse_exec_cb);
+  if (b->timer) {
+    lv_timer_del(b->timer);
+    b->timer = NULL;
+  }
+  b->blink = UI_BLINK_NONE;
+  b->toggles = 0;
+}
+
+static void blink_timer_cb(lv_timer_t *t)
+{
+  ui_bind_t *b = (ui_bind_t *) t->user_data;
+  const blink_dsc_t *d = &s_blink_dsc[b->blink];
+
+  ui_bind_opa(b, b->opa == d->from ? d->to : d->from);
+
+  if (b->toggles && --b->toggles == 0) {
+    ui_bind_done_cb_t done = b->done;
+
+    b->done = NULL;
+    blink_stop(b);
+    ui_bind_opa(b, LV_OPA_COVER);
+
+    if (done)
+      done();
+  }
+}
+
+static void blink_start(ui_bind_t *b, ui_blink_t mode, uint16_t toggles)
+{
+  const blink_dsc_t *d = &s_blink_dsc[mode];
+
+  b->blink = mode;
+  b->toggles = toggles;
+  ui_bind_opa(b, d->from);
+
+  if (mode == UI_BLINK_PULSE) {
+    lv_anim_t a;
+
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, b);
+    lv_anim_set_exec_cb(&a, pulse_exec_cb);
+    lv_anim_set_path_cb(&a, pulse_path);
+    lv_anim_set_values(&a, d->from, d->to);
+    lv_anim_set_time(&a, d->period);
+    lv_anim_set_playback_time(&a, d->period);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_start(&a);
+  } else {
+    b->timer = lv_timer_create(blink_timer_cb, d->period, b);
+  }
+}
+
+void ui_bind_blink(ui_bind_t *b, ui_blink_t mode)
+{
+  if (b->blink == mode)
+    return;
+
+  blink_stop(b);
+  b->done = NULL;
+
+  if (mode == UI_BLINK_NONE) {
+    ui_bind_opa(b, LV_OPA_COVER);
+    return;
+  }
+
+  blink_start(b, mode, 0);
+}
+
+// blink `count` times, then restore full opacity and call `done`; a flash
+// already in progress is left to finish rather than restarted
+void ui_bind_flash(ui_bind_t *b, uint16_t count, ui_bind_done_cb_t done)
+{
+  if (b->blink == UI_BLINK_FLASH)
+    return;
+
+  blink_stop(b);
+  b->done = done;
+
+  // each blink is an off and an on toggle
+  blink_start(b, UI_BLINK_FLASH, count > 0 ? count * 2 : 2);
+}
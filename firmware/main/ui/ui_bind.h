@@ -0,0 +1,69 @@
+#ifndef _UI_BIND_H
+#define _UI_BIND_H
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//
+// Change-detecting wrappers around the LVGL setters used by the screens.
+// Each widget gets a ui_bind_t that remembers the last value pushed to
+// LVGL; a setter only touches the object (and so only invalidates an
+// area that must be re-rendered and flushed over SPI) when the new value
+// differs from the cached one.
+//
+// Blinking is driven by LVGL itself (lv_timer/lv_anim keyed on the
+// binding), so a steady screen produces no redraws at all.
+//
+
+#define UI_BIND_TEXT_MAX 16
+
+typedef enum {
+  UI_BLINK_NONE = 0,
+  UI_BLINK_PULSE,     // slow fade, used for "in progress"
+  UI_BLINK_SLOW,      // 1.5s on/off, used for warnings
+  UI_BLINK_TICK,      // 0.5s on/off, clock colon
+  UI_BLINK_FLASH      // short burst, see ui_bind_flash()
+} ui_blink_t;
+
+typedef void (*ui_bind_done_cb_t)(void);
+
+typedef struct ui_bind {
+  lv_obj_t *obj;
+  uint16_t valid;
+  char text[UI_BIND_TEXT_MAX];
+  const char *text_static;
+  const lv_font_t *font;
+  const void *img_src;
+  lv_color_t text_color;
+  lv_color_t img_recolor;
+  int32_t value;
+  lv_opa_t opa;
+  bool hidden;
+  ui_blink_t blink;
+  uint16_t toggles;
+  lv_timer_t *timer;
+  ui_bind_done_cb_t done;
+} ui_bind_t;
+
+void ui_bind_init(ui_bind_t *b, lv_obj_t *obj);
+
+bool ui_bind_text(ui_bind_t *b, const char *text);
+bool ui_bind_text_static(ui_bind_t *b, const char *text);
+bool ui_bind_text_color(ui_bind_t *b, lv_color_t color);
+bool ui_bind_font(ui_bind_t *b, const lv_font_t *font);
+bool ui_bind_img_src(ui_bind_t *b, const void *src);
+bool ui_bind_img_recolor(ui_bind_t *b, lv_color_t color);
+bool ui_bind_opa(ui_bind_t *b, lv_opa_t opa);
+bool ui_bind_hidden(ui_bind_t *b, bool hidden);
+bool ui_bind_value(ui_bind_t *b, int32_t value);
+
+void ui_bind_blink(ui_bind_t *b, ui_blink_t mode);
+void ui_bind_flash(ui_bind_t *b, uint16_t count, ui_bind_done_cb_t done);
+
+#endif
@@ -5,36 +5,19 @@
 #endif
 
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 #include "display_task.h"
 #include "ui_idle.h"
+#include "ui_bind.h"
+#include "ui_img.h"
 
-LV_IMG_DECLARE(wifi_0);
-LV_IMG_DECLARE(wifi_1);
-LV_IMG_DECLARE(wifi_2);
-LV_IMG_DECLARE(wifi_3);
-LV_IMG_DECLARE(wifi_4);
-
-LV_IMG_DECLARE(rfid_tag);
+// wifi_0..wifi_4, weakest to strongest
+static const lv_img_dsc_t *s_img_wifi[5];
 
 LV_FONT_DECLARE(sleep_28);
 #define SLEEP_SYMBOL "\xEF\x88\xB6"
 
-typedef struct {
-    lv_obj_t *scr;
-    int count_val;
-    bool count_dir;
-    int count_sec;
-    int mqtt_blink;
-} my_timer_context_t;
-
-static my_timer_context_t my_tim_ctx = {
-    .count_val = 0,
-    .count_dir = true,
-    .count_sec = 0,
-    .mqtt_blink = 0
-};
-
 static lv_obj_t *img_wifi_signal = NULL;
 static lv_obj_t *img_acl_status = NULL;
 static lv_obj_t *label_acl_status = NULL;
@@ -43,103 +26,56 @@ static lv_obj_t *label_wifi_status = NULL;
 static lv_obj_t *label_mqtt = NULL;
 static lv_obj_t *label_power_status = NULL;
 
-static lv_obj_t *label_status = NULL;
+static lv_obj_t *cont_clock = NULL;
+static lv_obj_t *label_hour = NULL;
+static lv_obj_t *label_colon = NULL;
+static lv_obj_t *label_min = NULL;
 static lv_obj_t *bar_progress = NULL;
 static lv_obj_t *label_progress = NULL;
-static lv_timer_t *timer;
 
-static acl_status_t acl_status = ACL_STATUS_INIT;
-static mqtt_status_t mqtt_status = MQTT_STATUS_INIT;
+// last rendered state of each widget, see ui_bind.h
+static ui_bind_t b_wifi_signal;
+static ui_bind_t b_acl_img;
+static ui_bind_t b_acl_status;
+static ui_bind_t b_wifi_status;
+static ui_bind_t b_mqtt;
+static ui_bind_t b_power_status;
+static ui_bind_t b_clock;
+static ui_bind_t b_hour;
+static ui_bind_t b_colon;
+static ui_bind_t b_min;
+static ui_bind_t b_bar;
+static ui_bind_t b_progress;
+
 static wifi_status_t wifi_status = WIFI_STATUS_INIT;
-static power_status_t power_status = POWER_STATUS_ON_EXT;
 static bool door_open = false;
 static char time[12];
 
-static void anim_timer_cb(lv_timer_t *timer)
+static void ui_idle_update_clock(void)
 {
-    my_timer_context_t *timer_ctx = (my_timer_context_t *) timer->user_data;
-    int count = timer_ctx->count_val;
-    bool count_dir = timer_ctx->count_dir;
-    int count_sec = timer_ctx->count_sec;
-    int mqtt_blink = timer_ctx->mqtt_blink;
-    //lv_obj_t *scr = timer_ctx->scr;
-
-    if (acl_status == ACL_STATUS_DOWNLOADING) {
-        lv_obj_set_style_opa(label_acl_status, (count * 12) + 64, 0);
-    } else {
-        lv_obj_set_style_opa(label_acl_status, 255, 0);
-    }
-
-    if (mqtt_status == MQTT_STATUS_DATA_SENT || mqtt_status == MQTT_STATUS_DATA_RECEIVED) {
-        if (mqtt_blink == 0) {
-            mqtt_blink = 4;
-        } else {
-            mqtt_blink--;
-            if (mqtt_blink == 0) {
-                ui_idle_set_mqtt_status(MQTT_STATUS_CONNECTED);
-            }
-        }
-        lv_obj_set_style_opa(label_mqtt, (count % 2) == 0 ? 255 : 64, 0);
-    } else {
-        lv_obj_set_style_opa(label_mqtt, 255, 0);
-    }
-    if (wifi_status == WIFI_STATUS_ERROR) {
-        lv_obj_set_style_opa(label_wifi_status, (count < 7) ? 255 : 0, 0);
-    } else if (wifi_status == WIFI_STATUS_DISCONNECTED) {
-        lv_obj_set_style_opa(label_wifi_status, (count < 7) ? 255 : 0, 0);
-    } else if (wifi_status == WIFI_STATUS_CONNECTING) {
-        lv_obj_set_style_opa(label_wifi_status, (count / 2 < 4) == 0 ? 255 : 0, 0);
-    } else {
-        lv_obj_set_style_opa(label_wifi_status, 255, 0);
-    }
-
-    if (power_status == POWER_STATUS_ON_BATT_LOW) {
-      lv_obj_set_style_opa(label_power_status, (count < 7) ? 255 : 0, 0);
-    } else {
-      lv_obj_set_style_opa(label_power_status, 255, 0);
-    }
-
     if (door_open) {
-        lv_label_set_text(label_status, "OPEN");
-    } else {
-        char time_copy[12];
-        strcpy(time_copy, time);
-
-        char color_time[60];
-
-        char *hr = time_copy;
-        char *min = strchr(time_copy, ':');
-        if (min) {
-          *min = '\0';
-          min++;
-
-          strcpy(color_time, hr);
-          strcat(color_time, (count_sec < 5) ? "#000000 :#" : ":");
-          strcat(color_time, min);
-          lv_label_set_recolor(label_status, true);
-          lv_label_set_text(label_status, color_time);
-        }
-
+        ui_bind_text_static(&b_hour, "OPEN");
+        ui_bind_hidden(&b_colon, true);
+        ui_bind_hidden(&b_min, true);
+        ui_bind_blink(&b_colon, UI_BLINK_NONE);
+        return;
     }
 
-    if (count_dir) {
-        count++;
-        if (count >= 15)
-        count_dir = !count_dir;
-    } else {
-        count--;
-        if (count <= 0)
-        count_dir = !count_dir;
-    }
-
-    count_sec++;
-    if (count_sec >= 10)
-      count_sec = 0;
-
-    timer_ctx->count_val = count;
-    timer_ctx->count_dir = count_dir;
-    timer_ctx->count_sec = count_sec;
-    timer_ctx->mqtt_blink = mqtt_blink;
+    char hr[sizeof(time)];
+    strncpy(hr, time, sizeof(hr));
+    hr[sizeof(hr) - 1] = '\0';
+
+    char *min = strchr(hr, ':');
+    if (!min)
+        return;
+    *min++ = '\0';
+
+    // only the hour/minute that actually changed gets redrawn
+    ui_bind_text(&b_hour, hr);
+    ui_bind_text(&b_min, min);
+    ui_bind_hidden(&b_colon, false);
+    ui_bind_hidden(&b_min, false);
+    ui_bind_blink(&b_colon, UI_BLINK_TICK);
 }
 
 void ui_idle_set_power_status(power_status_t status)
@@ -148,79 +84,69 @@ void ui_idle_set_power_status(power_status_t status)
   switch(status) {
       case POWER_STATUS_ON_EXT:
           color = lv_color_white();
-          lv_obj_set_style_text_font(label_power_status, &lv_font_montserrat_28, 0);
-          lv_label_set_text(label_power_status, LV_SYMBOL_CHARGE);
+          ui_bind_font(&b_power_status, &lv_font_montserrat_28);
+          ui_bind_text_static(&b_power_status, LV_SYMBOL_CHARGE);
           break;
       case POWER_STATUS_ON_BATT:
           color = lv_color_white();
-          lv_obj_set_style_text_font(label_power_status, &lv_font_montserrat_28, 0);
-          lv_label_set_text(label_power_status, LV_SYMBOL_BATTERY_FULL);
+          ui_bind_font(&b_power_status, &lv_font_montserrat_28);
+          ui_bind_text_static(&b_power_status, LV_SYMBOL_BATTERY_FULL);
           break;
       case POWER_STATUS_ON_BATT_LOW:
           color = lv_palette_main(LV_PALETTE_RED);
-          lv_obj_set_style_text_font(label_power_status, &lv_font_montserrat_28, 0);
-          lv_label_set_text(label_power_status, LV_SYMBOL_BATTERY_1);
+          ui_bind_font(&b_power_status, &lv_font_montserrat_28);
+          ui_bind_text_static(&b_power_status, LV_SYMBOL_BATTERY_1);
           break;
       case POWER_STATUS_SLEEP:
       case POWER_STATUS_WAKE:
           color = lv_palette_main(LV_PALETTE_CYAN);
-          lv_obj_set_style_text_font(label_power_status, &sleep_28, 0);
-          lv_label_set_text(label_power_status, SLEEP_SYMBOL);
+          ui_bind_font(&b_power_status, &sleep_28);
+          ui_bind_text_static(&b_power_status, SLEEP_SYMBOL);
           break;
     }
-    lv_obj_set_style_text_color(label_power_status, color, 0);
-    power_status = status;
+    ui_bind_text_color(&b_power_status, color);
+    ui_bind_blink(&b_power_status, status == POWER_STATUS_ON_BATT_LOW ? UI_BLINK_SLOW : UI_BLINK_NONE);
+}
+
+static void acl_status_show(lv_color_t color, const char *symbol, lv_color_t img_color, bool downloading)
+{
+    ui_bind_text_color(&b_acl_status, color);
+    ui_bind_text_static(&b_acl_status, symbol);
+    ui_bind_img_recolor(&b_acl_img, img_color);
+    ui_bind_hidden(&b_bar, !downloading);
+    ui_bind_hidden(&b_clock, downloading);
+    ui_bind_blink(&b_acl_status, downloading ? UI_BLINK_PULSE : UI_BLINK_NONE);
 }
 
 void ui_idle_set_acl_status(acl_status_t status)
 {
     switch(status) {
         case ACL_STATUS_INIT:
-            lv_obj_set_style_text_color(label_acl_status, lv_palette_main(LV_PALETTE_GREY), 0);
-            lv_label_set_text(label_acl_status, LV_SYMBOL_CLOSE);
-            lv_obj_set_style_img_recolor(img_acl_status, lv_color_make(60,60,60), 0);
-            lv_obj_set_style_opa(bar_progress, 0, 0);
-            lv_obj_set_style_opa(label_status, 255, 0);
+            acl_status_show(lv_palette_main(LV_PALETTE_GREY), LV_SYMBOL_CLOSE, lv_color_make(60,60,60), false);
             break;
         case ACL_STATUS_ERROR:
-            lv_obj_set_style_text_color(label_acl_status, lv_palette_main(LV_PALETTE_RED), 0);
-            lv_label_set_text(label_acl_status, LV_SYMBOL_WARNING);
-            lv_obj_set_style_img_recolor(img_acl_status, lv_color_make(60,60,60), 0);
-            lv_obj_set_style_opa(bar_progress, 0, 0);
-            lv_obj_set_style_opa(label_status, 255, 0);
+            acl_status_show(lv_palette_main(LV_PALETTE_RED), LV_SYMBOL_WARNING, lv_color_make(60,60,60), false);
             break;
         case ACL_STATUS_DOWNLOADING:
-            lv_obj_set_style_text_color(label_acl_status, lv_palette_main(LV_PALETTE_CYAN), 0);
-            lv_label_set_text(label_acl_status, LV_SYMBOL_DOWNLOAD);
-            lv_obj_set_style_img_recolor(img_acl_status, lv_color_make(90,90,90), 0);
-            lv_obj_set_style_opa(bar_progress, 255, 0);
-            lv_obj_set_style_opa(label_status, 0, 0);
+            acl_status_show(lv_palette_main(LV_PALETTE_CYAN), LV_SYMBOL_DOWNLOAD, lv_color_make(90,90,90), true);
             break;
         case ACL_STATUS_DOWNLOADED_UPDATED:
-            lv_obj_set_style_text_color(label_acl_status, lv_palette_main(LV_PALETTE_GREEN), 0);
-            lv_label_set_text(label_acl_status, LV_SYMBOL_OK);
-            lv_obj_set_style_img_recolor(img_acl_status, lv_color_make(0, 70, 130), 0);
-            lv_obj_set_style_opa(bar_progress, 0, 0);
-            lv_obj_set_style_opa(label_status, 255, 0);
+            acl_status_show(lv_palette_main(LV_PALETTE_GREEN), LV_SYMBOL_OK, lv_color_make(0, 70, 130), false);
             break;
         case ACL_STATUS_DOWNLOADED_SAME_HASH:
-            lv_obj_set_style_text_color(label_acl_status, lv_palette_main(LV_PALETTE_AMBER), 0);
-            lv_label_set_text(label_acl_status, LV_SYMBOL_OK);
-            lv_obj_set_style_img_recolor(img_acl_status, lv_color_make(0, 70, 130), 0);
-            lv_obj_set_style_opa(bar_progress, 0, 0);
-            lv_obj_set_style_opa(label_status, 255, 0);
+            acl_status_show(lv_palette_main(LV_PALETTE_AMBER), LV_SYMBOL_OK, lv_color_make(0, 70, 130), false);
             break;
         case ACL_STATUS_CACHED:
-            lv_obj_set_style_text_color(label_acl_status, lv_palette_main(LV_PALETTE_AMBER), 0);
-            lv_label_set_text(label_acl_status, LV_SYMBOL_FILE);
-            lv_obj_set_style_img_recolor(img_acl_status, lv_color_make(0, 70, 130), 0);
-            lv_obj_set_style_opa(bar_progress, 0, 0);
-            lv_obj_set_style_opa(label_status, 255, 0);
+            acl_status_show(lv_palette_main(LV_PALETTE_AMBER), LV_SYMBOL_FILE, lv_color_make(0, 70, 130), false);
             break;
         default:
         break;
     }
-    acl_status = status;
+}
+
+static void mqtt_flash_done(void)
+{
+    ui_idle_set_mqtt_status(MQTT_STATUS_CONNECTED);
 }
 
 void ui_idle_set_mqtt_status(mqtt_status_t status)
@@ -248,39 +174,50 @@ void ui_idle_set_mqtt_status(mqtt_status_t status)
         default:
         break;
     }
-    lv_obj_set_style_text_color(label_mqtt, color, 0);
-    mqtt_status = status;
+    ui_bind_text_color(&b_mqtt, color);
+
+    if (status == MQTT_STATUS_DATA_SENT || status == MQTT_STATUS_DATA_RECEIVED) {
+        // blink for a moment, then fall back to plain "connected"
+        ui_bind_flash(&b_mqtt, 2, mqtt_flash_done);
+    } else {
+        ui_bind_blink(&b_mqtt, UI_BLINK_NONE);
+    }
 }
 
 
 void ui_idle_set_wifi_status(wifi_status_t status)
 {
     lv_color_t color = lv_palette_main(LV_PALETTE_GREY);
+    ui_blink_t blink = UI_BLINK_NONE;
     switch(status) {
         case WIFI_STATUS_INIT:
             color = lv_palette_main(LV_PALETTE_GREY);
-            lv_label_set_text(label_wifi_status, LV_SYMBOL_CLOSE);
+            ui_bind_text_static(&b_wifi_status, LV_SYMBOL_CLOSE);
             break;
         case WIFI_STATUS_ERROR:
             color = lv_palette_lighten(LV_PALETTE_RED, 2);
-            lv_label_set_text(label_wifi_status, LV_SYMBOL_WARNING);
+            ui_bind_text_static(&b_wifi_status, LV_SYMBOL_WARNING);
+            blink = UI_BLINK_SLOW;
             break;
         case WIFI_STATUS_DISCONNECTED:
             color = lv_palette_lighten(LV_PALETTE_ORANGE, 1);
-            lv_label_set_text(label_wifi_status, LV_SYMBOL_CLOSE);
+            ui_bind_text_static(&b_wifi_status, LV_SYMBOL_CLOSE);
+            blink = UI_BLINK_SLOW;
             break;
         case WIFI_STATUS_CONNECTING:
             color = lv_palette_main(LV_PALETTE_CYAN);
-            lv_label_set_text(label_wifi_status, LV_SYMBOL_REFRESH);
+            ui_bind_text_static(&b_wifi_status, LV_SYMBOL_REFRESH);
+            blink = UI_BLINK_SLOW;
             break;
         case WIFI_STATUS_CONNECTED:
             color = lv_palette_main(LV_PALETTE_GREEN);
-            lv_label_set_text(label_wifi_status, "");
+            ui_bind_text_static(&b_wifi_status, "");
             break;
         default:
             break;
     }
-    lv_obj_set_style_text_color(label_wifi_status, color, 0);
+    ui_bind_text_color(&b_wifi_status, color);
+    ui_bind_blink(&b_wifi_status, blink);
     wifi_status = status;
 }
 
@@ -289,32 +226,39 @@ void ui_idle_set_rssi(int rssi)
 {
     if (wifi_status == WIFI_STATUS_CONNECTED) {
         if (rssi >= -55) {
-            lv_img_set_src(img_wifi_signal, &wifi_4);
+            ui_bind_img_src(&b_wifi_signal, s_img_wifi[4]);
         } else if (rssi >= -65) {
-            lv_img_set_src(img_wifi_signal, &wifi_3);
+            ui_bind_img_src(&b_wifi_signal, s_img_wifi[3]);
         } else if (rssi >= -75) {
-            lv_img_set_src(img_wifi_signal, &wifi_2);
+            ui_bind_img_src(&b_wifi_signal, s_img_wifi[2]);
         } else if (rssi >= -85) {
-            lv_img_set_src(img_wifi_signal, &wifi_1);
+            ui_bind_img_src(&b_wifi_signal, s_img_wifi[1]);
         } else if (rssi >= -95) {
-            lv_img_set_src(img_wifi_signal, &wifi_0);
+            ui_bind_img_src(&b_wifi_signal, s_img_wifi[0]);
         }
     }
 }
 
 void ui_idle_set_time(char *time_str)
 {
-  strncpy(time, time_str, 12);
+  strncpy(time, time_str, sizeof(time) - 1);
+  ui_idle_update_clock();
 }
 
 void ui_idle_set_door_state(bool open)
 {
   door_open = open;
+  ui_idle_update_clock();
 }
 
 void ui_idle_set_acl_download_progress(int percent)
 {
-  lv_label_set_text_fmt(label_progress, "%d%%", percent);
+  if (!ui_bind_value(&b_bar, percent))
+    return;
+
+  char pct[8];
+  snprintf(pct, sizeof(pct), "%d%%", percent);
+  ui_bind_text(&b_progress, pct);
   lv_bar_set_value(bar_progress, percent, LV_ANIM_OFF);
 }
 
@@ -337,6 +281,12 @@ lv_obj_t* ui_idle_create(void)
 {
     lv_obj_t* scr = lv_obj_create(NULL);
 
+    for (int i = 0; i < 5; i++) {
+        char name[8];
+        snprintf(name, sizeof(name), "wifi_%d", i);
+        s_img_wifi[i] = ui_img_find(name);
+    }
+
     static lv_style_t style;
     lv_style_init(&style);
     lv_style_set_radius(&style, 0);
@@ -378,7 +328,7 @@ lv_obj_t* ui_idle_create(void)
     lv_obj_set_size(wifi_cont, 30, 30);
     lv_obj_add_style(wifi_cont, &style, 0);
     img_wifi_signal = lv_img_create(wifi_cont);
-    lv_img_set_src(img_wifi_signal, &wifi_0);
+    lv_img_set_src(img_wifi_signal, s_img_wifi[0]);
     lv_obj_align(img_wifi_signal, LV_ALIGN_CENTER, 2, -2);
 
     label_wifi_status = lv_label_create(wifi_cont);
@@ -394,7 +344,7 @@ lv_obj_t* ui_idle_create(void)
     lv_obj_set_size(acl_cont, 32, 32);
     lv_obj_add_style(acl_cont, &style, 0);
     img_acl_status = lv_img_create(acl_cont);
-    lv_img_set_src(img_acl_status, &rfid_tag);
+    lv_img_set_src(img_acl_status, ui_img_find("rfid_tag"));
     lv_obj_align(img_acl_status, LV_ALIGN_CENTER, 0, 0);
     lv_obj_set_style_img_recolor_opa(img_acl_status, LV_OPA_COVER, 0);
     lv_obj_set_style_img_recolor(img_acl_status, lv_color_make(60,60,60), 0);
@@ -408,14 +358,28 @@ lv_obj_t* ui_idle_create(void)
     label_mqtt = make_grid_icon(grid, 1, 2, &gstyle, LV_SYMBOL_SHUFFLE);
     label_power_status = make_grid_icon(grid, 1, 3, &gstyle, LV_SYMBOL_CHARGE);
 
-    label_status = lv_label_create(grid);
-    lv_obj_set_grid_cell(label_status, LV_GRID_ALIGN_CENTER, 0, 4, LV_GRID_ALIGN_CENTER, 0, 1);
-    lv_label_set_long_mode(label_status, LV_LABEL_LONG_CLIP);
-    lv_obj_set_style_text_font(label_status, &lv_font_montserrat_36, 0);
-    lv_label_set_recolor(label_status, true);
-    lv_label_set_text_static(label_status, "12:00");
-    lv_obj_set_style_text_color(label_status, lv_color_white(), 0);
-    lv_obj_center(label_status);
+    // clock is split so the blinking colon and a minute rollover only
+    // redraw their own glyphs rather than the whole label
+    cont_clock = lv_obj_create(grid);
+    lv_obj_remove_style_all(cont_clock);
+    lv_obj_set_grid_cell(cont_clock, LV_GRID_ALIGN_CENTER, 0, 4, LV_GRID_ALIGN_CENTER, 0, 1);
+    lv_obj_set_size(cont_clock, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont_clock, LV_FLEX_FLOW_ROW);
+    lv_obj_clear_flag(cont_clock, LV_OBJ_FLAG_SCROLLABLE);
+
+    label_hour = lv_label_create(cont_clock);
+    label_colon = lv_label_create(cont_clock);
+    label_min = lv_label_create(cont_clock);
+
+    lv_obj_t *clock_labels[] = { label_hour, label_colon, label_min };
+    for (int i = 0; i < 3; i++) {
+        lv_label_set_long_mode(clock_labels[i], LV_LABEL_LONG_CLIP);
+        lv_obj_set_style_text_font(clock_labels[i], &lv_font_montserrat_36, 0);
+        lv_obj_set_style_text_color(clock_labels[i], lv_color_white(), 0);
+    }
+    lv_label_set_text_static(label_hour, "12");
+    lv_label_set_text_static(label_colon, ":");
+    lv_label_set_text_static(label_min, "00");
 
     static lv_style_t style_bg;
     static lv_style_t style_indic;
@@ -439,7 +403,7 @@ lv_obj_t* ui_idle_create(void)
     lv_obj_remove_style_all(bar_progress);
     lv_obj_add_style(bar_progress, &style_bg, 0);
     lv_obj_add_style(bar_progress, &style_indic, LV_PART_INDICATOR);
-    lv_obj_set_style_opa(bar_progress, 0, 0);
+    lv_obj_add_flag(bar_progress, LV_OBJ_FLAG_HIDDEN);
 
     lv_obj_center(bar_progress);
     lv_obj_set_size(bar_progress, 140, 20);
@@ -452,8 +416,18 @@ lv_obj_t* ui_idle_create(void)
     lv_label_set_text_static(label_progress, "");
     lv_obj_set_style_text_color(label_progress, lv_color_white(), 0);
 
-    my_tim_ctx.scr = scr;
-    timer = lv_timer_create(anim_timer_cb, 100, &my_tim_ctx);
+    ui_bind_init(&b_wifi_signal, img_wifi_signal);
+    ui_bind_init(&b_acl_img, img_acl_status);
+    ui_bind_init(&b_acl_status, label_acl_status);
+    ui_bind_init(&b_wifi_status, label_wifi_status);
+    ui_bind_init(&b_mqtt, label_mqtt);
+    ui_bind_init(&b_power_status, label_power_status);
+    ui_bind_init(&b_clock, cont_clock);
+    ui_bind_init(&b_hour, label_hour);
+    ui_bind_init(&b_colon, label_colon);
+    ui_bind_init(&b_min, label_min);
+    ui_bind_init(&b_bar, bar_progress);
+    ui_bind_init(&b_progress, label_progress);
 
     return scr;
 }
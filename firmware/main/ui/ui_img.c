@@ -0,0 +1,325 @@
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ui_img.h"
+
+#ifndef UI_SIMULATOR
+#include "esp_timer.h"
+#include "perf.h"
+#define img_now_us() ((uint32_t) esp_timer_get_time())
+#else
+#include <time.h>
+static uint32_t img_now_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+#endif
+
+#define TOK_KIND(t)   ((t) & 0xC0)
+#define TOK_COUNT(t)  (((t) & 0x3F) + 1)
+#define TOK_SKIP      0x00
+#define TOK_FILL      0x40
+#define TOK_COPY      0x80
+
+typedef struct {
+  const lv_img_dsc_t *src;
+  uint8_t *buf;
+  uint32_t size;
+  uint32_t stamp;
+  uint16_t refs;
+} img_slot_t;
+
+typedef struct {
+  const char *name;
+  const lv_img_dsc_t *dsc;
+} img_named_t;
+
+typedef struct {
+  lv_img_dsc_t dsc;
+  ui_img_rle_t rle;
+} img_rle_alloc_t;
+
+static img_named_t s_named[UI_IMG_MAX_NAMED];
+static int s_num_named = 0;
+
+static img_slot_t s_slots[UI_IMG_CACHE_SLOTS];
+static uint32_t s_stamp = 0;
+static ui_img_stats_t s_stats;
+
+#ifndef UI_SIMULATOR
+static perf_stat_t *s_decode_stat = NULL;
+#endif
+
+static inline uint32_t px_size(const ui_img_rle_t *rle)
+{
+  return rle->alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+}
+
+static inline void put_px(uint8_t *out, const uint8_t *p, bool alpha)
+{
+  uint16_t c565 = p[0] | (p[1] << 8);
+  uint8_t r = (c565 >> 11) & 0x1F;
+  uint8_t g = (c565 >> 5) & 0x3F;
+  uint8_t b = c565 & 0x1F;
+  lv_color_t c = lv_color_make((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+
+  memcpy(out, &c, sizeof(lv_color_t));
+  if (alpha)
+    out[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = p[2];
+}
+
+//
+// Decode pixels [x, x + len) of row y into out.  Tokens wholly left of x
+// are skipped without expanding them.
+//
+static void rle_decode_row(const ui_img_rle_t *rle, lv_coord_t y, lv_coord_t x, lv_coord_t len, uint8_t *out)
+{
+  const uint8_t *p = rle->pool + rle->rows[y];
+  const uint32_t in_px = rle->alpha ? 3 : 2;
+  const uint32_t out_px = px_size(rle);
+  lv_coord_t pos = 0;
+  lv_coord_t end = x + len;
+
+  while (pos < end) {
+    uint8_t t = *p++;
+    lv_coord_t n = TOK_COUNT(t);
+    lv_coord_t from = LV_MAX(pos, x);
+    lv_coord_t to = LV_MIN(pos + n, end);
+
+    switch (TOK_KIND(t)) {
+      case TOK_SKIP:
+        if (to > from)
+          memset(out + (from - x) * out_px, 0, (to - from) * out_px);
+        break;
+      case TOK_FILL:
+        for (lv_coord_t i = from; i < to; i++)
+          put_px(out + (i - x) * out_px, p, rle->alpha);
+        p += in_px;
+        break;
+      default:
+        for (lv_coord_t i = from; i < to; i++)
+          put_px(out + (i - x) * out_px, p + (i - pos) * in_px, rle->alpha);
+        p += n * in_px;
+        break;
+    }
+    pos += n;
+  }
+}
+
+static img_slot_t *cache_find(const lv_img_dsc_t *src)
+{
+  for (int i = 0; i < UI_IMG_CACHE_SLOTS; i++) {
+    if (s_slots[i].src == src)
+      return &s_slots[i];
+  }
+  return NULL;
+}
+
+static void cache_evict(img_slot_t *slot)
+{
+  free(slot->buf);
+  s_stats.cache_bytes -= slot->size;
+  memset(slot, 0, sizeof(*slot));
+}
+
+// find room for `size` bytes, evicting the least recently used entries
+// that nobody is drawing from; NULL if it can't be made to fit
+static img_slot_t *cache_alloc(uint32_t size)
+{
+  for (;;) {
+    img_slot_t *free_slot = NULL;
+    img_slot_t *lru = NULL;
+
+    for (int i = 0; i < UI_IMG_CACHE_SLOTS; i++) {
+      img_slot_t *s = &s_slots[i];
+      if (s->src == NULL) {
+        if (!free_slot)
+          free_slot = s;
+      } else if (s->refs == 0 && (!lru || s->stamp < lru->stamp)) {
+        lru = s;
+      }
+    }
+
+    if (free_slot && s_stats.cache_bytes + size <= UI_IMG_CACHE_BYTES) {
+      free_slot->buf = malloc(size);
+      if (!free_slot->buf)
+        return NULL;
+      free_slot->size = size;
+      s_stats.cache_bytes += size;
+      if (s_stats.cache_bytes > s_stats.cache_peak)
+        s_stats.cache_peak = s_stats.cache_bytes;
+      return free_slot;
+    }
+
+    if (!lru)
+      return NULL;
+    cache_evict(lru);
+  }
+}
+
+static lv_res_t rle_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+  LV_UNUSED(decoder);
+
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE)
+    return LV_RES_INV;
+
+  const lv_img_dsc_t *img = src;
+  if (img->header.cf != UI_IMG_CF_RLE)
+    return LV_RES_INV;
+
+  const ui_img_rle_t *rle = (const ui_img_rle_t *) img->data;
+  header->always_zero = 0;
+  header->w = img->header.w;
+  header->h = img->header.h;
+  header->cf = rle->alpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+  return LV_RES_OK;
+}
+
+static lv_res_t rle_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+  LV_UNUSED(decoder);
+
+  const lv_img_dsc_t *img = dsc->src;
+  const ui_img_rle_t *rle = (const ui_img_rle_t *) img->data;
+  uint32_t stride = img->header.w * px_size(rle);
+  uint32_t size = stride * img->header.h;
+
+  dsc->img_data = NULL;
+  dsc->user_data = NULL;
+
+  img_slot_t *slot = cache_find(img);
+  if (slot) {
+    s_stats.hits++;
+  } else {
+    if (size > UI_IMG_CACHE_BYTES)
+      return LV_RES_OK;   // too big to keep, LVGL will call rle_read_line
+
+    slot = cache_alloc(size);
+    if (!slot)
+      return LV_RES_OK;
+
+    uint32_t t0 = img_now_us();
+    for (lv_coord_t y = 0; y < img->header.h; y++)
+      rle_decode_row(rle, y, 0, img->header.w, slot->buf + y * stride);
+    uint32_t dt = img_now_us() - t0;
+
+    slot->src = img;
+    s_stats.decodes++;
+    s_stats.decode_us += dt;
+    dsc->time_to_open = dt / 1000;
+#ifndef UI_SIMULATOR
+    perf_record(s_decode_stat, dt);
+#endif
+  }
+
+  slot->refs++;
+  slot->stamp = ++s_stamp;
+  dsc->img_data = slot->buf;
+  dsc->user_data = slot;
+  return LV_RES_OK;
+}
+
+static lv_res_t rle_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc,
+                              lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf)
+{
+  LV_UNUSED(decoder);
+
+  const lv_img_dsc_t *img = dsc->src;
+  uint32_t t0 = img_now_us();
+  rle_decode_row((const ui_img_rle_t *) img->data, y, x, len, buf);
+  s_stats.line_us += img_now_us() - t0;
+  s_stats.lines++;
+  return LV_RES_OK;
+}
+
+static void rle_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+  LV_UNUSED(decoder);
+
+  img_slot_t *slot = dsc->user_data;
+  if (slot && slot->refs)
+    slot->refs--;
+  dsc->user_data = NULL;
+  dsc->img_data = NULL;
+}
+
+// call once after lv_init()
+void ui_img_init(void)
+{
+  lv_img_decoder_t *dec = lv_img_decoder_create();
+
+  lv_img_decoder_set_info_cb(dec, rle_info);
+  lv_img_decoder_set_open_cb(dec, rle_open);
+  lv_img_decoder_set_read_line_cb(dec, rle_read_line);
+  lv_img_decoder_set_close_cb(dec, rle_close);
+
+#ifndef UI_SIMULATOR
+  s_decode_stat = perf_register("img_decode", "us");
+#endif
+}
+
+void ui_img_get_stats(ui_img_stats_t *stats)
+{
+  *stats = s_stats;
+}
+
+void ui_img_add(const char *name, const lv_img_dsc_t *dsc)
+{
+  for (int i = 0; i < s_num_named; i++) {
+    if (strcmp(s_named[i].name, name) == 0) {
+      s_named[i].dsc = dsc;
+      return;
+    }
+  }
+
+  if (s_num_named >= UI_IMG_MAX_NAMED) {
+    LV_LOG_WARN("ui_img: no room for %s", name);
+    return;
+  }
+
+  s_named[s_num_named].name = name;
+  s_named[s_num_named].dsc = dsc;
+  s_num_named++;
+}
+
+// wrap an RLE image that lives outside the app image (the pool and row
+// table must stay valid for as long as the image is registered)
+const lv_img_dsc_t *ui_img_add_rle(const char *name, uint16_t w, uint16_t h, bool alpha,
+                                   const uint8_t *pool, const uint16_t *rows)
+{
+  img_rle_alloc_t *a = calloc(1, sizeof(img_rle_alloc_t));
+  if (!a)
+    return NULL;
+
+  a->rle.pool = pool;
+  a->rle.rows = rows;
+  a->rle.alpha = alpha;
+  a->dsc.header.w = w;
+  a->dsc.header.h = h;
+  a->dsc.header.cf = UI_IMG_CF_RLE;
+  a->dsc.data_size = sizeof(ui_img_rle_t);
+  a->dsc.data = (const uint8_t *) &a->rle;
+
+  ui_img_add(name, &a->dsc);
+  return &a->dsc;
+}
+
+const lv_img_dsc_t *ui_img_find(const char *name)
+{
+  for (int i = 0; i < s_num_named; i++) {
+    if (strcmp(s_named[i].name, name) == 0)
+      return s_named[i].dsc;
+  }
+
+  LV_LOG_WARN("ui_img: no image %s", name);
+  return NULL;
+}
@@ -0,0 +1,62 @@
+#ifndef _UI_IMG_H
+#define _UI_IMG_H
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//
+// Run-length encoded images, generated from the PNGs in ui/images by
+// tools/mkimages.py, and the LVGL image decoder that draws them.
+//
+// Rows are encoded independently and shared between images through a
+// common pool; `rows` holds each row's offset into it.  Images that fit
+// the decode cache are decoded whole on first use and kept until evicted,
+// larger ones (the splash logos) are decoded line by line as LVGL draws
+// them and never take more RAM than one line.
+//
+// Screens look images up by name.  They are registered either from the
+// copies compiled into the app (ui_img_add_builtin(), generated into
+// images/images_rle.c) or, on the device, from the assets partition.
+//
+
+#define UI_IMG_CF_RLE LV_IMG_CF_USER_ENCODED_0
+
+#ifndef UI_IMG_CACHE_BYTES
+#define UI_IMG_CACHE_BYTES (6 * 1024)   // holds rfid_tag plus one wifi icon
+#endif
+#define UI_IMG_CACHE_SLOTS 4
+#define UI_IMG_MAX_NAMED   16
+
+typedef struct {
+  const uint8_t *pool;
+  const uint16_t *rows;
+  uint8_t alpha;
+} ui_img_rle_t;
+
+typedef struct {
+  uint32_t decodes;       // whole-image decodes into the cache
+  uint32_t hits;          // opens served from the cache
+  uint32_t lines;         // lines decoded for images drawn line by line
+  uint32_t decode_us;     // total time spent in whole-image decodes
+  uint32_t line_us;       // total time spent decoding single lines
+  uint32_t cache_bytes;
+  uint32_t cache_peak;
+} ui_img_stats_t;
+
+void ui_img_init(void);
+void ui_img_get_stats(ui_img_stats_t *stats);
+
+void ui_img_add(const char *name, const lv_img_dsc_t *dsc);
+const lv_img_dsc_t *ui_img_add_rle(const char *name, uint16_t w, uint16_t h, bool alpha,
+                                   const uint8_t *pool, const uint16_t *rows);
+const lv_img_dsc_t *ui_img_find(const char *name);
+
+void ui_img_add_builtin(void);
+
+#endif
@@ -5,28 +5,47 @@
 #endif
 
 #include <math.h>
+#include <stdio.h>
 #include "display_task.h"
 #include "esp_ota_ops.h"
 
 static lv_style_t style;
-lv_obj_t* label_mac;
-lv_obj_t* label_ip;
+static lv_obj_t* label_mac = NULL;
+static lv_obj_t* label_ip = NULL;
+
+// kept outside LVGL so the screen can be deleted and rebuilt
+static struct {
+  char mac[32];
+  char ip[32];
+} s_info;
 
 void ui_info_set_status(net_status_t status, char* buf)
 {
   switch (status) {
     case NET_STATUS_CUR_MAC:
-      lv_label_set_text(label_mac, buf);
+      snprintf(s_info.mac, sizeof(s_info.mac), "%s", buf);
+      if (label_mac)
+        lv_label_set_text(label_mac, s_info.mac);
       break;
     case NET_STATUS_CUR_IP:
-      lv_label_set_text(label_ip, buf);
+      snprintf(s_info.ip, sizeof(s_info.ip), "%s", buf);
+      if (label_ip)
+        lv_label_set_text(label_ip, s_info.ip);
       break;
   }
 }
 
+static void ui_info_deleted(lv_event_t *e)
+{
+  label_mac = NULL;
+  label_ip = NULL;
+  lv_style_reset(&style);
+}
+
 lv_obj_t* ui_info_create()
 {
   lv_obj_t* scr = lv_obj_create(NULL);
+  lv_obj_add_event_cb(scr, ui_info_deleted, LV_EVENT_DELETE, NULL);
 
   lv_style_init(&style);
   lv_style_set_radius(&style, 0);
@@ -59,6 +78,7 @@ lv_obj_t* ui_info_create()
   lv_obj_set_grid_cell(label_mac, LV_GRID_ALIGN_START, 1, 1, LV_GRID_ALIGN_START, 0, 1);
   lv_obj_set_style_text_font(label_mac, &lv_font_montserrat_12, 0);
   lv_obj_set_style_text_color(label_mac, lv_color_black(), 0);
+  lv_label_set_text(label_mac, s_info.mac);
 
   l = lv_label_create(grid);
   lv_obj_set_width(l, 40);
@@ -72,6 +92,7 @@ lv_obj_t* ui_info_create()
   lv_obj_set_grid_cell(label_ip, LV_GRID_ALIGN_STRETCH, 1, 1, LV_GRID_ALIGN_STRETCH, 1, 1);
   lv_obj_set_style_text_font(label_ip, &lv_font_montserrat_12, 0);
   lv_obj_set_style_text_color(label_ip, lv_color_black(), 0);
+  lv_label_set_text(label_ip, s_info.ip);
 
   l = lv_label_create(grid);
   lv_obj_set_width(l, 40);
@@ -13,7 +13,27 @@ static lv_obj_t *label_status = NULL;
 static lv_obj_t *bar_progress = NULL;
 static lv_obj_t *label_progress = NULL;
 
-static ota_status_t ota_status = OTA_STATUS_INIT;
+static lv_style_t style;
+static lv_style_t style_bg;
+static lv_style_t style_indic;
+
+// kept outside LVGL so the screen can be deleted and rebuilt
+static struct {
+  ota_status_t status;
+  int percent;        // -1 until a download reports progress
+} s_ota = {
+  .status = OTA_STATUS_INIT,
+  .percent = -1,
+};
+
+static void ui_ota_show_progress(void)
+{
+  if (bar_progress == NULL || s_ota.percent < 0)
+    return;
+
+  lv_label_set_text_fmt(label_progress, "%d%%", s_ota.percent);
+  lv_bar_set_value(bar_progress, s_ota.percent, LV_ANIM_OFF);
+}
 
 void ui_ota_set_status(ota_status_t status)
 {
@@ -27,22 +47,33 @@ void ui_ota_set_status(ota_status_t status)
         default:
         break;
     }
-    ota_status = status;
+    s_ota.status = status;
 }
 
 
 void ui_ota_set_download_progress(int percent)
 {
-  lv_label_set_text_fmt(label_progress, "%d%%", percent);
-  lv_bar_set_value(bar_progress, percent, LV_ANIM_OFF);
+  s_ota.percent = percent;
+  ui_ota_show_progress();
 }
 
 
+static void ui_ota_deleted(lv_event_t *e)
+{
+    label_status = NULL;
+    bar_progress = NULL;
+    label_progress = NULL;
+
+    lv_style_reset(&style);
+    lv_style_reset(&style_bg);
+    lv_style_reset(&style_indic);
+}
+
 lv_obj_t* ui_ota_create(void)
 {
     lv_obj_t* scr = lv_obj_create(NULL);
+    lv_obj_add_event_cb(scr, ui_ota_deleted, LV_EVENT_DELETE, NULL);
 
-    static lv_style_t style;
     lv_style_init(&style);
     lv_style_set_radius(&style, 0);
     lv_style_set_bg_color(&style, lv_color_black());
@@ -55,15 +86,6 @@ lv_obj_t* ui_ota_create(void)
 
     lv_obj_add_style(scr, &style, 0);
 
-    static lv_style_t gstyle;
-    lv_style_init(&gstyle);
-    lv_style_set_bg_color(&gstyle, lv_color_black());
-    lv_style_set_radius(&gstyle, 5);
-    lv_style_set_outline_width(&gstyle, 0);
-    lv_style_set_outline_pad(&gstyle, 0);
-    lv_style_set_border_width(&gstyle, 0);
-    lv_style_set_pad_all(&gstyle, 0);
-
     static lv_coord_t col_dsc[] = {160, LV_GRID_TEMPLATE_LAST};
     static lv_coord_t row_dsc[] = {40, 40, LV_GRID_TEMPLATE_LAST};
 
@@ -86,9 +108,6 @@ lv_obj_t* ui_ota_create(void)
     lv_obj_set_style_text_color(label_status, lv_color_white(), 0);
     lv_obj_center(label_status);
 
-    static lv_style_t style_bg;
-    static lv_style_t style_indic;
-
     lv_style_init(&style_bg);
     lv_style_set_border_color(&style_bg, lv_palette_main(LV_PALETTE_ORANGE));
     lv_style_set_border_width(&style_bg, 2);
@@ -120,5 +139,7 @@ lv_obj_t* ui_ota_create(void)
     lv_label_set_text_static(label_progress, "");
     lv_obj_set_style_text_color(label_progress, lv_color_white(), 0);
 
+    ui_ota_show_progress();
+
     return scr;
 }
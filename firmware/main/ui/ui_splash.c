@@ -4,8 +4,7 @@
 #include "lvgl/lvgl.h"
 #endif
 
-LV_IMG_DECLARE(makeit_logo)
-LV_IMG_DECLARE(ratt_logo)
+#include "ui_img.h"
 
 static lv_obj_t *img_logo;
 
@@ -26,7 +25,7 @@ static void anim_timer_cb(lv_timer_t *timer)
     int count = timer_ctx->count_val;
 
     if (++count == 10) {
-      lv_img_set_src(img_logo, &ratt_logo);
+      lv_img_set_src(img_logo, ui_img_find("ratt_logo"));
       lv_timer_pause(timer);
     }
 
@@ -34,27 +33,39 @@ static void anim_timer_cb(lv_timer_t *timer)
 }
 
 
-static lv_timer_t *timer;
+static lv_timer_t *timer = NULL;
 
 void ui_splash_reset()
 {
+  if (timer == NULL)
+    return;
+
   lv_timer_pause(timer);
   s_tim_ctx.count_val = 0;
-  lv_img_set_src(img_logo, &makeit_logo);
+  lv_img_set_src(img_logo, ui_img_find("makeit_logo"));
   lv_timer_resume(timer);
 }
 
+static void ui_splash_deleted(lv_event_t *e)
+{
+  lv_timer_del(timer);
+  timer = NULL;
+  img_logo = NULL;
+}
+
 lv_obj_t* ui_splash_create(void)
 {
   lv_obj_t* scr = lv_obj_create(NULL);
+  lv_obj_add_event_cb(scr, ui_splash_deleted, LV_EVENT_DELETE, NULL);
 
   // Create image
   img_logo = lv_img_create(scr);
-  lv_img_set_src(img_logo, &makeit_logo);
+  lv_img_set_src(img_logo, ui_img_find("makeit_logo"));
   lv_obj_align(img_logo, LV_ALIGN_CENTER, 0, 0);
 
   // Create timer for animation
   s_tim_ctx.scr = scr;
+  s_tim_ctx.count_val = 0;
   timer = lv_timer_create(anim_timer_cb, 100, &s_tim_ctx);
 
   return scr;
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+#
+# Build the image for the `assets` flash partition.
+#
+# The UI's images are RLE encoded exactly as mkimages.py does for the
+# compiled-in copies, but written to a flat blob that the firmware maps
+# with esp_partition_mmap() and hands to LVGL without copying
+# (main/system/assets.c).  Layout, all little endian:
+#
+#   header    u32 magic 'RATA', u16 version, u16 count, u32 size, u32 0
+#   entries   count x { char name[20], u8 type, u8 flags, u16 w, u16 h,
+#                       u16 pool, u32 offset, u32 size }
+#   data      4-byte aligned payloads
+#
+# An image entry (type 1) holds its u16 row offsets; `pool` is the index of
+# the raw entry (type 0) holding the shared row pool.  Extra raw blobs can
+# be added with --raw name=path.
+#
+# The device only downloads a new blob when its SHA-224 differs from the
+# one in flash, so the server must send it in an X-Hash-SHA224 header, the
+# same way the ACL is served; a download that doesn't hash to it is
+# rejected.  The hash is printed at the end.
+#
+# usage: mkassets.py [-o assets.bin] [--raw name=path] image.png ...
+#
+
+import argparse
+import hashlib
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from mkimages import encode_images, report  # noqa: E402
+
+MAGIC = 0x41544152      # "RATA"
+VERSION = 1
+NAME_MAX = 20
+SLOT_MAX = 512 * 1024   # the partition holds two slots
+
+TYPE_RAW = 0
+TYPE_IMG_RLE = 1
+FLAG_ALPHA = 0x01
+
+HDR = struct.Struct('<IHHII')
+ENTRY = struct.Struct('<%dsBBHHHII' % NAME_MAX)
+
+
+def align4(n):
+    return (n + 3) & ~3
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Build the assets partition image')
+    ap.add_argument('-o', '--output', default='assets.bin')
+    ap.add_argument('--raw', action='append', default=[], metavar='NAME=PATH')
+    ap.add_argument('images', nargs='*')
+    args = ap.parse_args()
+
+    entries = []    # (name, type, flags, w, h, pool, payload)
+
+    if args.images:
+        pool, images = encode_images(args.images)
+        report(pool, images)
+        entries.append(('rle_pool', TYPE_RAW, 0, 0, 0, 0, pool))
+        for name, w, h, alpha, offsets, _ in images:
+            rows = struct.pack('<%dH' % h, *offsets)
+            entries.append((name, TYPE_IMG_RLE, FLAG_ALPHA if alpha else 0, w, h, 0, rows))
+
+    for spec in args.raw:
+        name, _, path = spec.partition('=')
+        with open(path, 'rb') as f:
+            entries.append((name, TYPE_RAW, 0, 0, 0, 0, f.read()))
+
+    for e in entries:
+        if len(e[0].encode()) >= NAME_MAX:
+            sys.exit('asset name too long: %s' % e[0])
+
+    offset = align4(HDR.size + ENTRY.size * len(entries))
+    directory = b''
+    data = b''
+    for name, etype, flags, w, h, pool_idx, payload in entries:
+        directory += ENTRY.pack(name.encode(), etype, flags, w, h, pool_idx, offset, len(payload))
+        pad = align4(len(payload)) - len(payload)
+        data += payload + b'\0' * pad
+        offset += len(payload) + pad
+
+    size = align4(HDR.size + len(directory)) + len(data)
+    if size > SLOT_MAX:
+        sys.exit('assets are %d bytes, a slot holds %d' % (size, SLOT_MAX))
+
+    blob = HDR.pack(MAGIC, VERSION, len(entries), size, 0) + directory
+    blob += b'\0' * (align4(len(blob)) - len(blob)) + data
+
+    with open(args.output, 'wb') as f:
+        f.write(blob)
+
+    print('%s: %d entries, %d bytes (%d%% of a slot)' %
+          (args.output, len(entries), len(blob), len(blob) * 100 // SLOT_MAX))
+    print('X-Hash-SHA224: %s' % hashlib.sha224(blob).hexdigest())
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,266 @@
+#!/usr/bin/env python3
+#
+# Convert the UI's PNG images into run-length encoded LVGL images.
+#
+# Every row of every image is RLE encoded on its own and stored once in a
+# shared pool, so rows that repeat within an image or across images (the
+# blank margins of the wifi_0..4 icons, for instance) cost nothing extra.
+# Each image keeps a table of row offsets into the pool, which lets the
+# decoder in ui/ui_img.c decode any single line without touching the rest.
+#
+# Row encoding, one header byte per token:
+#
+#   00nnnnnn            n+1 fully transparent pixels (alpha images only)
+#   01nnnnnn px         n+1 copies of px
+#   10nnnnnn px...      n+1 literal pixels
+#
+# px is RGB565 little endian, followed by an 8-bit alpha for images that
+# have an alpha channel.
+#
+# usage: mkimages.py [-o images_rle.c] image.png ...
+#
+# Only the standard library is used; the PNG reader handles the 8-bit,
+# non-interlaced RGB/RGBA files the UI ships with.
+#
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAX_RUN = 64
+
+TOK_SKIP = 0x00
+TOK_FILL = 0x40
+TOK_COPY = 0x80
+
+
+def read_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        sys.exit('%s: not a PNG' % path)
+
+    pos = 8
+    idat = b''
+    while pos < len(data):
+        length, ctype = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b'IHDR':
+            w, h, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif ctype == b'IDAT':
+            idat += chunk
+        elif ctype == b'IEND':
+            break
+
+    if depth != 8 or color not in (2, 6) or interlace:
+        sys.exit('%s: only 8-bit non-interlaced RGB/RGBA is supported' % path)
+
+    bpp = 4 if color == 6 else 3
+    raw = zlib.decompress(idat)
+    stride = w * bpp
+    prev = bytearray(stride)
+    rows = []
+    pos = 0
+
+    for _ in range(h):
+        ftype = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+
+        row = []
+        for x in range(w):
+            px = line[x * bpp:(x + 1) * bpp]
+            row.append((px[0], px[1], px[2], px[3] if bpp == 4 else 0xFF))
+        rows.append(row)
+        prev = line
+
+    return w, h, color == 6, rows
+
+
+def to_565(r, g, b):
+    # round to nearest, as the LVGL online converter does without dithering
+    r5 = min(31, (r * 31 + 127) // 255)
+    g6 = min(63, (g * 63 + 127) // 255)
+    b5 = min(31, (b * 31 + 127) // 255)
+    return (r5 << 11) | (g6 << 5) | b5
+
+
+def pixel_bytes(px, alpha):
+    r, g, b, a = px
+    c = to_565(r, g, b)
+    out = bytes((c & 0xFF, c >> 8))
+    return out + bytes((a,)) if alpha else out
+
+
+def encode_row(row, alpha):
+    px = [None if alpha and p[3] == 0 else pixel_bytes(p, alpha) for p in row]
+    out = bytearray()
+    i = 0
+    n = len(px)
+
+    while i < n:
+        if px[i] is None:
+            j = i
+            while j < n and j - i < MAX_RUN and px[j] is None:
+                j += 1
+            out.append(TOK_SKIP | (j - i - 1))
+            i = j
+            continue
+
+        j = i
+        while j < n and j - i < MAX_RUN and px[j] == px[i]:
+            j += 1
+        if j - i >= 2:
+            out.append(TOK_FILL | (j - i - 1))
+            out += px[i]
+            i = j
+            continue
+
+        # literal until the next transparent pixel or repeated pair
+        j = i + 1
+        while j < n and j - i < MAX_RUN and px[j] is not None and \
+                not (j + 1 < n and px[j] == px[j + 1]):
+            j += 1
+        out.append(TOK_COPY | (j - i - 1))
+        for k in range(i, j):
+            out += px[k]
+        i = j
+
+    return bytes(out)
+
+
+def c_array(data, indent='  ', per_line=16, fmt='0x%02x'):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join(fmt % v for v in data[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def encode_images(paths):
+    """RLE encode every PNG into a shared row pool.
+
+    Returns (pool, images) where images holds, per PNG,
+    (name, w, h, alpha, row offsets into pool, encoded bytes before sharing).
+    """
+    pool = bytearray()
+    pool_index = {}
+    images = []
+
+    for path in paths:
+        name = os.path.splitext(os.path.basename(path))[0]
+        w, h, alpha, rows = read_png(path)
+        offsets = []
+        encoded = 0
+
+        for row in rows:
+            enc = encode_row(row, alpha)
+            encoded += len(enc)
+            if enc not in pool_index:
+                pool_index[enc] = len(pool)
+                pool += enc
+            offsets.append(pool_index[enc])
+
+        images.append((name, w, h, alpha, offsets, encoded))
+
+    if len(pool) > 0xFFFF:
+        sys.exit('row pool is %d bytes, offsets are 16-bit' % len(pool))
+
+    return bytes(pool), images
+
+
+def report(pool, images):
+    # raw is what the LVGL converter emits for a 16-bit build
+    print('%-14s %5s %9s %9s' % ('image', 'size', 'raw', 'rle'))
+    total_raw = total_enc = total_rows = 0
+    for name, w, h, alpha, offsets, encoded in images:
+        raw = w * h * (3 if alpha else 2)
+        total_raw += raw
+        total_enc += encoded + 2 * h
+        total_rows += 2 * h
+        print('%-14s %2dx%-2d %9d %9d' % (name, w, h, raw, encoded + 2 * h))
+    print('%-14s %5s %9d %9d' % ('total', '', total_raw, total_enc))
+    print('%-14s %5s %9s %9d  (%d bytes of identical rows shared)' %
+          ('stored', '', '', len(pool) + total_rows, total_enc - len(pool) - total_rows))
+    print('images that fit the decode cache take their raw size in RAM while cached;')
+    print('larger ones are decoded line by line as LVGL draws them.')
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Convert PNGs to RLE encoded LVGL images')
+    ap.add_argument('-o', '--output', default='images_rle.c')
+    ap.add_argument('images', nargs='+')
+    args = ap.parse_args()
+
+    pool, images = encode_images(args.images)
+
+    out = []
+    out.append('// Generated by tools/mkimages.py from the PNGs in this directory, do not edit.')
+    out.append('// See ui/ui_img.h for the format.')
+    out.append('')
+    out.append('#ifdef LV_LVGL_H_INCLUDE_SIMPLE')
+    out.append('#include "lvgl.h"')
+    out.append('#else')
+    out.append('#include "lvgl/lvgl.h"')
+    out.append('#endif')
+    out.append('#include "../ui_img.h"')
+    out.append('')
+    out.append('static const uint8_t s_row_pool[%d] = {' % len(pool))
+    out.append(c_array(pool))
+    out.append('};')
+
+    for name, w, h, alpha, offsets, _ in images:
+        out.append('')
+        out.append('static const uint16_t %s_rows[%d] = {' % (name, h))
+        out.append(c_array(offsets, per_line=12, fmt='%d'))
+        out.append('};')
+        out.append('')
+        out.append('static const ui_img_rle_t %s_rle = {' % name)
+        out.append('  .pool = s_row_pool,')
+        out.append('  .rows = %s_rows,' % name)
+        out.append('  .alpha = %d,' % int(alpha))
+        out.append('};')
+        out.append('')
+        out.append('static const lv_img_dsc_t %s = {' % name)
+        out.append('  .header.always_zero = 0,')
+        out.append('  .header.w = %d,' % w)
+        out.append('  .header.h = %d,' % h)
+        out.append('  .data_size = sizeof(ui_img_rle_t),')
+        out.append('  .header.cf = UI_IMG_CF_RLE,')
+        out.append('  .data = (const uint8_t *) &%s_rle,' % name)
+        out.append('};')
+
+    out.append('')
+    out.append('void ui_img_add_builtin(void)')
+    out.append('{')
+    for name, *_ in images:
+        out.append('  ui_img_add("%s", &%s);' % (name, name))
+    out.append('}')
+
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+    report(pool, images)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+#
+# Build compressed and delta OTA images for main/net/net_ota_delta.c.
+#
+# Given the new app image and the images devices may be running, writes
+# into the output directory
+#
+#   full.ratd             the new image, zlib compressed
+#   <sha256>.ratd         a patch from each old image, named after the
+#                         old image's hash as the device reports it in
+#                         the X-Running-SHA256 request header
+#
+# and prints the size of each against the full image so it's easy to see
+# what a delta saves.  tools/ota_server.py --patch-dir serves them.
+#
+# The delta is bsdiff-like: target runs that line up with a source run
+# (allowing scattered differing bytes, as relocated addresses are) are
+# sent as the bytewise difference against the source, which is mostly
+# zeros and compresses away; everything else is sent literally.  Layout
+# is described in net_ota_delta.h.  The zlib window is limited to 8K so
+# the device can inflate into an 8K buffer.
+#
+# usage: mkpatch.py [-o patches] new.bin [old.bin ...]
+#
+
+import argparse
+import hashlib
+import os
+import struct
+import sys
+import time
+import zlib
+
+MAGIC = 0x44544152      # "RATD"
+VERSION = 1
+F_DELTA = 0x0001
+F_ZLIB = 0x0002
+WINDOW_BITS = 13
+
+OP_DIFF = 0x01
+OP_ADD = 0x02
+
+BLOCK = 16              # match seed length
+MIN_MATCH = 32
+MAX_DRIFT = 32          # give up extending after this many net mismatches
+
+HDR = struct.Struct('<IHHII32s32s')
+
+
+def image_hash(image):
+    """The hash esp_partition_get_sha256() returns for an app image.
+
+    esptool appends the SHA-256 of the rest of the image, and that is what
+    the bootloader reports for the running partition.
+    """
+    digest = hashlib.sha256(image[:-32]).digest()
+    if image[-32:] == digest:
+        return digest
+    return hashlib.sha256(image).digest()
+
+
+def deflate(data):
+    c = zlib.compressobj(9, zlib.DEFLATED, WINDOW_BITS)
+    return c.compress(data) + c.flush()
+
+
+def extend(src, s, tgt, t):
+    """Length of the approximate match at src[s:], tgt[t:]."""
+    limit = min(len(src) - s, len(tgt) - t)
+    score = best = best_len = 0
+    for k in range(limit):
+        score += 1 if src[s + k] == tgt[t + k] else -1
+        if score > best:
+            best, best_len = score, k + 1
+        elif best - score > MAX_DRIFT:
+            break
+    return best_len
+
+
+def diff_ops(src, tgt):
+    index = {}
+    for off in range(0, len(src) - BLOCK + 1, 4):
+        index.setdefault(src[off:off + BLOCK], off)
+
+    ops = bytearray()
+    lit = 0             # start of the pending literal run
+    i = 0
+
+    def add(end):
+        if end > lit:
+            ops.extend(struct.pack('<BI', OP_ADD, end - lit))
+            ops.extend(tgt[lit:end])
+
+    while i + BLOCK <= len(tgt):
+        off = index.get(bytes(tgt[i:i + BLOCK]))
+        if off is None:
+            i += 1
+            continue
+
+        # pull exactly matching bytes back out of the literal run
+        back = 0
+        while i - back > lit and off - back > 0 and tgt[i - back - 1] == src[off - back - 1]:
+            back += 1
+
+        n = extend(src, off - back, tgt, i - back)
+        if n < MIN_MATCH:
+            i += 1
+            continue
+
+        i -= back
+        off -= back
+        add(i)
+        ops.extend(struct.pack('<BII', OP_DIFF, off, n))
+        ops.extend((tgt[i + k] - src[off + k]) & 0xFF for k in range(n))
+        i += n
+        lit = i
+
+    add(len(tgt))
+    return bytes(ops)
+
+
+def header(flags, tgt, src=b''):
+    src_sha = image_hash(src) if src else b'\0' * 32
+    return HDR.pack(MAGIC, VERSION, flags, len(tgt), len(src),
+                    hashlib.sha256(tgt).digest(), src_sha)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Build compressed and delta OTA images')
+    ap.add_argument('-o', '--output', default='patches', help='output directory')
+    ap.add_argument('new')
+    ap.add_argument('old', nargs='*')
+    args = ap.parse_args()
+
+    with open(args.new, 'rb') as f:
+        tgt = f.read()
+
+    os.makedirs(args.output, exist_ok=True)
+
+    full = header(F_ZLIB, tgt) + deflate(tgt)
+    with open(os.path.join(args.output, 'full.ratd'), 'wb') as f:
+        f.write(full)
+
+    print('%-32s %9s %9s %6s %8s' % ('image', 'raw', 'sent', 'ratio', 'time'))
+    print('%-32s %9d %9d %5.1f%% %8s' % ('full', len(tgt), len(tgt), 100.0, '-'))
+    print('%-32s %9d %9d %5.1f%% %8s' % ('full_z', len(tgt), len(full),
+                                         len(full) * 100.0 / len(tgt), '-'))
+
+    for path in args.old:
+        with open(path, 'rb') as f:
+            src = f.read()
+
+        t0 = time.monotonic()
+        ops = diff_ops(src, tgt)
+        patch = header(F_DELTA | F_ZLIB, tgt, src) + deflate(ops)
+        dt = time.monotonic() - t0
+
+        name = image_hash(src).hex() + '.ratd'
+        with open(os.path.join(args.output, name), 'wb') as f:
+            f.write(patch)
+
+        print('%-32s %9d %9d %5.1f%% %7.1fs' % ('delta_z ' + os.path.basename(path), len(ops),
+                                               len(patch), len(patch) * 100.0 / len(tgt), dt))
+
+    if not args.old:
+        print('no old images given, only full.ratd written', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
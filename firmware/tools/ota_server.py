@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# Local HTTPS stand-in for the OTA server, for benchmarking downloads
+# without the production server or the internet in the way.
+#
+# Serves one file (normally build/ratt.bin) at every path with a
+# Content-Length, optionally paced to --rate KB/s to mimic a slower
+# link.  The device checks the server against its CA certificate, so
+# give it a certificate signed by the CA in main/certs (or build a test
+# firmware with a self-signed one):
+#
+#   openssl req -x509 -newkey rsa:2048 -nodes -days 30 -subj /CN=ota \
+#       -keyout ota.key -out ota.crt
+#
+# then set ota_url to https://<this host>:8443/ratt.bin and run
+# "ota --bench" on the console.  The server logs each transfer's time
+# and rate as seen from its side.
+#
+# With --patch-dir (the output of mkpatch.py) a device that sends
+# X-OTA-Accept: ratd gets the patch for the image it reports in
+# X-Running-SHA256, else the compressed full image, whichever of those
+# and the plain image is smallest.
+#
+# Every response carries an ETag and Range/If-Range requests are honoured,
+# so downloads can be resumed.  --drop-after KB injects a disconnect: each
+# response is cut off after that many KB, and the device has to resume
+# (or start over) to finish.  The server totals what it sent per client,
+# to compare against the size of the body.
+#
+# usage: ota_server.py [--port 8443] [--rate KBPS] [--patch-dir DIR]
+#                      [--drop-after KB] --cert ota.crt --key ota.key image.bin
+#
+
+import argparse
+import hashlib
+import http.server
+import os
+import re
+import socket
+import ssl
+import time
+
+CHUNK = 4096
+
+
+def load(path):
+    try:
+        with open(path, 'rb') as f:
+            return f.read()
+    except OSError:
+        return None
+
+
+def make_handler(full, rate_kbps, patch_dir, drop_kb):
+    sent_total = {}
+
+    class Handler(http.server.BaseHTTPRequestHandler):
+        protocol_version = 'HTTP/1.1'
+
+        def pick(self):
+            if not patch_dir or 'ratd' not in self.headers.get('X-OTA-Accept', ''):
+                return 'full', full
+            running = self.headers.get('X-Running-SHA256', '').lower()
+            names = ['full.ratd'] + (['%s.ratd' % running] if running else [])
+            choices = [('full', full)]
+            for name in names:
+                data = load(os.path.join(patch_dir, name))
+                if data:
+                    choices.append((name, data))
+            return min(choices, key=lambda c: len(c[1]))
+
+        def do_GET(self):
+            name, image = self.pick()
+            etag = '"%s"' % hashlib.sha256(image).hexdigest()[:32]
+
+            start = 0
+            m = re.match(r'bytes=(\d+)-$', self.headers.get('Range', ''))
+            if m and self.headers.get('If-Range', etag) == etag and int(m.group(1)) < len(image):
+                start = int(m.group(1))
+                self.send_response(206)
+                self.send_header('Content-Range', 'bytes %d-%d/%d' % (start, len(image) - 1, len(image)))
+            else:
+                self.send_response(200)
+            self.send_header('Content-Type', 'application/octet-stream')
+            self.send_header('Content-Length', str(len(image) - start))
+            self.send_header('ETag', etag)
+            self.end_headers()
+
+            end = len(image)
+            if drop_kb:
+                end = min(end, start + drop_kb * 1024)
+
+            t0 = time.monotonic()
+            for pos in range(start, end, CHUNK):
+                self.wfile.write(image[pos:min(pos + CHUNK, end)])
+                if rate_kbps:
+                    ahead = (pos + CHUNK - start) / (rate_kbps * 1024) - (time.monotonic() - t0)
+                    if ahead > 0:
+                        time.sleep(ahead)
+            self.wfile.flush()
+
+            client = self.client_address[0]
+            sent_total[client] = sent_total.get(client, 0) + end - start
+            dt = time.monotonic() - t0
+
+            if end < len(image):
+                self.log_message('dropped %s at %d of %d bytes (%d sent to this client)',
+                                 name, end, len(image), sent_total[client])
+                self.close_connection = True
+                self.request.shutdown(socket.SHUT_RDWR)
+                return
+
+            self.log_message('sent %s, %d-%d in %.2f s (%.1f KB/s), %d bytes for a %d byte body '
+                             'to this client', name, start, end, dt, (end - start) / 1024 / max(dt, 1e-6),
+                             sent_total[client], len(image))
+            sent_total[client] = 0
+
+    return Handler
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Serve a firmware image over HTTPS')
+    ap.add_argument('--port', type=int, default=8443)
+    ap.add_argument('--rate', type=int, default=0, metavar='KBPS', help='limit to KB/s (default none)')
+    ap.add_argument('--patch-dir', help='compressed/delta images from mkpatch.py')
+    ap.add_argument('--drop-after', type=int, default=0, metavar='KB',
+                    help='cut every response off after this many KB')
+    ap.add_argument('--cert', required=True)
+    ap.add_argument('--key', required=True)
+    ap.add_argument('image')
+    args = ap.parse_args()
+
+    with open(args.image, 'rb') as f:
+        image = f.read()
+
+    ctx = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    ctx.load_cert_chain(args.cert, args.key)
+
+    httpd = http.server.ThreadingHTTPServer(('', args.port), make_handler(image, args.rate, args.patch_dir, args.drop_after))
+    httpd.socket = ctx.wrap_socket(httpd.socket, server_side=True)
+    print('serving %s (%d bytes) on port %d' % (args.image, len(image), args.port))
+    httpd.serve_forever()
+
+
+if __name__ == '__main__':
+    main()
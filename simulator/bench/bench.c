@@ -0,0 +1,577 @@
+/**
+ * @file bench.c
+ *
+ * Headless render benchmark for the uRATT UI.
+ *
+ * Registers an in-memory 160x80 RGB565 display, drives the ui_* screens
+ * through a fixed script of state changes and screen transitions on a
+ * virtual tick, and records per frame the time spent rendering, the area
+ * LVGL invalidated and the bytes that would have gone over SPI.
+ *
+ * Area, bytes and the framebuffer hash are deterministic for a given tree,
+ * so they can be diffed between builds; render time depends on the host.
+ *
+ *   bench [-o results.json] [-v]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "lvgl/lvgl.h"
+#include "ui_wrapper/ui/ui_splash.h"
+#include "ui_wrapper/ui/ui_blank.h"
+#include "ui_wrapper/ui/ui_idle.h"
+#include "ui_wrapper/ui/ui_access.h"
+#include "ui_wrapper/ui/ui_info.h"
+#include "ui_wrapper/ui/ui_ota.h"
+#include "ui_wrapper/ui/ui_img.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_HOR_RES       160
+#define BENCH_VER_RES       80
+/* same number of pixels as the firmware's 80x40 draw buffers */
+#define BENCH_BUF_LINES     20
+#define BENCH_BYTES_PER_PX  2       /* RGB565 on the panel */
+#define BENCH_SCR_ANIM_MS   500
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t t_ms;
+    uint32_t render_us;
+    uint32_t area_px;
+    uint32_t bytes;
+    uint32_t flushes;
+} bench_frame_t;
+
+typedef struct {
+    const char *name;
+    void (*action)(void);
+    uint32_t duration_ms;
+} bench_step_t;
+
+typedef struct {
+    uint32_t wakeups;
+    uint32_t first_frame;
+    uint32_t num_frames;
+    uint64_t render_us;
+    uint32_t render_us_max;
+    uint64_t area_px;
+    uint64_t bytes;
+    uint32_t fb_hash;
+} bench_result_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_color_t s_fb[BENCH_HOR_RES * BENCH_VER_RES];
+static uint32_t s_now_ms = 0;
+
+static bench_frame_t *s_frames = NULL;
+static uint32_t s_num_frames = 0;
+static uint32_t s_cap_frames = 0;
+static bench_frame_t s_cur;
+
+// LVGL heap taken by each screen when built, to size lazily built screens
+typedef struct {
+    const char *name;
+    uint32_t bytes;
+} bench_screen_mem_t;
+
+static bench_screen_mem_t s_screen_mem[6];
+static int s_num_screen_mem = 0;
+
+static lv_obj_t *s_scr_splash;
+static lv_obj_t *s_scr_blank;
+static lv_obj_t *s_scr_idle;
+static lv_obj_t *s_scr_access;
+static lv_obj_t *s_scr_info;
+static lv_obj_t *s_scr_ota;
+
+static lv_timer_t *s_progress_timer = NULL;
+static int s_progress = 0;
+
+/**********************
+ *   DISPLAY DRIVER
+ **********************/
+static void bench_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    int w = area->x2 - area->x1 + 1;
+
+    for (int y = area->y1; y <= area->y2; y++) {
+        memcpy(&s_fb[y * BENCH_HOR_RES + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+
+    uint32_t px = (uint32_t) lv_area_get_size(area);
+    s_cur.area_px += px;
+    s_cur.bytes += px * BENCH_BYTES_PER_PX;
+    s_cur.flushes++;
+
+    if (lv_disp_flush_is_last(drv)) {
+        if (s_num_frames == s_cap_frames) {
+            s_cap_frames = s_cap_frames ? s_cap_frames * 2 : 256;
+            s_frames = realloc(s_frames, s_cap_frames * sizeof(bench_frame_t));
+            if (!s_frames) {
+                fprintf(stderr, "out of memory\n");
+                exit(1);
+            }
+        }
+        s_cur.t_ms = s_now_ms;
+        s_frames[s_num_frames++] = s_cur;
+        memset(&s_cur, 0, sizeof(s_cur));
+    }
+
+    lv_disp_flush_ready(drv);
+}
+
+static void bench_hal_init(void)
+{
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_color_t buf1[BENCH_HOR_RES * BENCH_BUF_LINES];
+    static lv_color_t buf2[BENCH_HOR_RES * BENCH_BUF_LINES];
+    static lv_disp_drv_t disp_drv;
+
+    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, BENCH_HOR_RES * BENCH_BUF_LINES);
+
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = BENCH_HOR_RES;
+    disp_drv.ver_res = BENCH_VER_RES;
+    disp_drv.flush_cb = bench_flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+}
+
+static uint64_t bench_wall_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint32_t bench_fb_hash(void)
+{
+    /* FNV-1a over the framebuffer */
+    const uint8_t *p = (const uint8_t *) s_fb;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < sizeof(s_fb); i++) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/*
+ * Run LVGL for `ms` of virtual time the way the firmware's display governor
+ * does: call lv_timer_handler(), then jump straight to its next deadline.
+ */
+static void bench_run(uint32_t ms, bench_result_t *r)
+{
+    uint32_t end = s_now_ms + ms;
+
+    while (s_now_ms < end) {
+        uint32_t before = s_num_frames;
+        uint64_t t0 = bench_wall_us();
+        uint32_t next = lv_timer_handler();
+        uint32_t dt = (uint32_t) (bench_wall_us() - t0);
+
+        r->wakeups++;
+        uint32_t made = s_num_frames - before;
+        for (uint32_t i = before; i < s_num_frames; i++)
+            s_frames[i].render_us = dt / made;
+
+        uint32_t step = end - s_now_ms;
+        if (next < step)
+            step = next;
+        if (step == 0)
+            step = 1;
+
+        lv_tick_inc(step);
+        s_now_ms += step;
+    }
+}
+
+/**********************
+ *   SCRIPT ACTIONS
+ **********************/
+static void load(lv_obj_t *scr, lv_scr_load_anim_t anim)
+{
+    lv_scr_load_anim(scr, anim, anim == LV_SCR_LOAD_ANIM_NONE ? 0 : BENCH_SCR_ANIM_MS, 0, false);
+}
+
+static void progress_cb(lv_timer_t *t)
+{
+    (void) t;
+    s_progress += 2;
+    if (s_progress > 100)
+        s_progress = 100;
+
+    if (lv_scr_act() == s_scr_ota)
+        ui_ota_set_download_progress(s_progress);
+    else
+        ui_idle_set_acl_download_progress(s_progress);
+}
+
+static void progress_start(void)
+{
+    s_progress = 0;
+    if (!s_progress_timer)
+        s_progress_timer = lv_timer_create(progress_cb, 50, NULL);
+}
+
+static void progress_stop(void)
+{
+    if (s_progress_timer) {
+        lv_timer_del(s_progress_timer);
+        s_progress_timer = NULL;
+    }
+}
+
+static void act_splash(void)
+{
+    load(s_scr_splash, LV_SCR_LOAD_ANIM_NONE);
+    ui_splash_reset();
+}
+
+static void act_idle_enter(void)
+{
+    char t[] = "12:00";
+
+    ui_idle_set_power_status(POWER_STATUS_ON_EXT);
+    ui_idle_set_acl_status(ACL_STATUS_CACHED);
+    ui_idle_set_mqtt_status(MQTT_STATUS_CONNECTED);
+    ui_idle_set_wifi_status(WIFI_STATUS_CONNECTED);
+    ui_idle_set_rssi(-60);
+    ui_idle_set_time(t);
+    load(s_scr_idle, LV_SCR_LOAD_ANIM_MOVE_RIGHT);
+}
+
+static void act_clock_same(void)
+{
+    /* the display task re-sends the time every second */
+    char t[] = "12:00";
+    ui_idle_set_time(t);
+}
+
+static void act_clock_minute(void)
+{
+    char t[] = "12:01";
+    ui_idle_set_time(t);
+}
+
+static void act_wifi_connecting(void)
+{
+    ui_idle_set_wifi_status(WIFI_STATUS_CONNECTING);
+}
+
+static void act_wifi_connected(void)
+{
+    ui_idle_set_wifi_status(WIFI_STATUS_CONNECTED);
+    ui_idle_set_rssi(-80);
+}
+
+static void act_rssi(void)
+{
+    ui_idle_set_rssi(-50);
+}
+
+static void act_mqtt_activity(void)
+{
+    ui_idle_set_mqtt_status(MQTT_STATUS_DATA_SENT);
+}
+
+static void act_acl_download(void)
+{
+    ui_idle_set_acl_status(ACL_STATUS_DOWNLOADING);
+    ui_idle_set_acl_download_progress(0);
+    progress_start();
+}
+
+static void act_acl_done(void)
+{
+    progress_stop();
+    ui_idle_set_acl_status(ACL_STATUS_DOWNLOADED_UPDATED);
+}
+
+static void act_door_open(void)
+{
+    ui_idle_set_door_state(true);
+}
+
+static void act_door_closed(void)
+{
+    ui_idle_set_door_state(false);
+}
+
+static void act_access_allowed(void)
+{
+    ui_access_set_user("Allowed.Person", true);
+    load(s_scr_access, LV_SCR_LOAD_ANIM_NONE);
+}
+
+static void act_access_denied(void)
+{
+    ui_access_set_user("Denied.Person", false);
+    load(s_scr_access, LV_SCR_LOAD_ANIM_NONE);
+}
+
+static void act_back_to_idle(void)
+{
+    load(s_scr_idle, LV_SCR_LOAD_ANIM_MOVE_RIGHT);
+}
+
+static void act_info(void)
+{
+    ui_info_set_status(NET_STATUS_CUR_MAC, "24:0a:c4:00:00:01");
+    ui_info_set_status(NET_STATUS_CUR_IP, "10.0.0.42");
+    load(s_scr_info, LV_SCR_LOAD_ANIM_MOVE_TOP);
+}
+
+static void act_info_exit(void)
+{
+    load(s_scr_idle, LV_SCR_LOAD_ANIM_MOVE_BOTTOM);
+}
+
+static void act_ota(void)
+{
+    ui_ota_set_status(OTA_STATUS_DOWNLOADING);
+    ui_ota_set_download_progress(0);
+    load(s_scr_ota, LV_SCR_LOAD_ANIM_MOVE_TOP);
+}
+
+static void act_ota_progress(void)
+{
+    progress_start();
+}
+
+static void act_ota_apply(void)
+{
+    progress_stop();
+    ui_ota_set_status(OTA_STATUS_APPLYING);
+}
+
+static void act_blank(void)
+{
+    load(s_scr_blank, LV_SCR_LOAD_ANIM_FADE_ON);
+}
+
+static const bench_step_t s_steps[] = {
+    { "splash",              act_splash,          1500 },
+    { "idle_enter",          act_idle_enter,      1000 },
+    { "idle_steady",         NULL,                5000 },
+    { "idle_clock_same",     act_clock_same,      1000 },
+    { "idle_clock_minute",   act_clock_minute,    1000 },
+    { "idle_wifi_connecting", act_wifi_connecting, 3000 },
+    { "idle_wifi_connected", act_wifi_connected,  1000 },
+    { "idle_rssi",           act_rssi,            1000 },
+    { "idle_mqtt_activity",  act_mqtt_activity,   1000 },
+    { "idle_acl_download",   act_acl_download,    3000 },
+    { "idle_acl_done",       act_acl_done,        1000 },
+    { "idle_door_open",      act_door_open,       1000 },
+    { "idle_door_closed",    act_door_closed,     1000 },
+    { "access_allowed",      act_access_allowed,  1000 },
+    { "access_to_idle",      act_back_to_idle,    1000 },
+    { "access_denied",       act_access_denied,   1000 },
+    { "access_to_idle_2",    act_back_to_idle,    1000 },
+    { "info_enter",          act_info,            1000 },
+    { "info_exit",           act_info_exit,       1000 },
+    { "ota_enter",           act_ota,             1000 },
+    { "ota_progress",        act_ota_progress,    3000 },
+    { "ota_apply",           act_ota_apply,       1000 },
+    { "blank",               act_blank,           1000 },
+};
+
+#define BENCH_NUM_STEPS (sizeof(s_steps) / sizeof(s_steps[0]))
+
+/**********************
+ *      OUTPUT
+ **********************/
+static void bench_write_json(FILE *f, const bench_result_t *res)
+{
+    bench_result_t tot = { 0 };
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"lvgl\": \"%d.%d.%d\",\n", LVGL_VERSION_MAJOR, LVGL_VERSION_MINOR, LVGL_VERSION_PATCH);
+    fprintf(f, "  \"width\": %d,\n  \"height\": %d,\n  \"color_depth\": %d,\n", BENCH_HOR_RES, BENCH_VER_RES, LV_COLOR_DEPTH);
+    fprintf(f, "  \"steps\": [\n");
+
+    for (size_t i = 0; i < BENCH_NUM_STEPS; i++) {
+        const bench_result_t *r = &res[i];
+
+        fprintf(f, "    {\n");
+        fprintf(f, "      \"name\": \"%s\",\n", s_steps[i].name);
+        fprintf(f, "      \"duration_ms\": %u,\n", s_steps[i].duration_ms);
+        fprintf(f, "      \"wakeups\": %u,\n", r->wakeups);
+        fprintf(f, "      \"frames\": %u,\n", r->num_frames);
+        fprintf(f, "      \"render_us\": %llu,\n", (unsigned long long) r->render_us);
+        fprintf(f, "      \"render_us_max\": %u,\n", r->render_us_max);
+        fprintf(f, "      \"area_px\": %llu,\n", (unsigned long long) r->area_px);
+        fprintf(f, "      \"bytes\": %llu,\n", (unsigned long long) r->bytes);
+        fprintf(f, "      \"fb_hash\": \"%08x\",\n", r->fb_hash);
+        fprintf(f, "      \"frame_list\": [");
+        for (uint32_t k = 0; k < r->num_frames; k++) {
+            const bench_frame_t *fr = &s_frames[r->first_frame + k];
+            fprintf(f, "%s\n        {\"t_ms\": %u, \"render_us\": %u, \"area_px\": %u, \"bytes\": %u, \"flushes\": %u}",
+                    k ? "," : "", fr->t_ms, fr->render_us, fr->area_px, fr->bytes, fr->flushes);
+        }
+        fprintf(f, "%s]\n", r->num_frames ? "\n      " : "");
+        fprintf(f, "    }%s\n", i + 1 < BENCH_NUM_STEPS ? "," : "");
+
+        tot.wakeups += r->wakeups;
+        tot.num_frames += r->num_frames;
+        tot.render_us += r->render_us;
+        tot.area_px += r->area_px;
+        tot.bytes += r->bytes;
+    }
+
+    fprintf(f, "  ],\n");
+
+    ui_img_stats_t img;
+    ui_img_get_stats(&img);
+    fprintf(f, "  \"images\": {\"decodes\": %u, \"hits\": %u, \"decode_us\": %u, \"lines\": %u, \"line_us\": %u, \"cache_peak\": %u},\n",
+            img.decodes, img.hits, img.decode_us, img.lines, img.line_us, img.cache_peak);
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    fprintf(f, "  \"lvgl_mem\": {\"total\": %u, \"used\": %u, \"peak\": %u, \"screens\": {",
+            (unsigned) mon.total_size, (unsigned) (mon.total_size - mon.free_size), (unsigned) mon.max_used);
+    for (int i = 0; i < s_num_screen_mem; i++)
+        fprintf(f, "%s\"%s\": %u", i ? ", " : "", s_screen_mem[i].name, s_screen_mem[i].bytes);
+    fprintf(f, "}},\n");
+    fprintf(f, "  \"totals\": {\"wakeups\": %u, \"frames\": %u, \"render_us\": %llu, \"area_px\": %llu, \"bytes\": %llu}\n",
+            tot.wakeups, tot.num_frames, (unsigned long long) tot.render_us,
+            (unsigned long long) tot.area_px, (unsigned long long) tot.bytes);
+    fprintf(f, "}\n");
+}
+
+static void bench_print_table(const bench_result_t *res, int verbose)
+{
+    printf("%-22s %7s %7s %10s %9s %10s %10s %9s\n",
+           "step", "ms", "wakeups", "frames", "render_us", "max_us", "area_px", "bytes");
+    for (size_t i = 0; i < BENCH_NUM_STEPS; i++) {
+        const bench_result_t *r = &res[i];
+        printf("%-22s %7u %7u %10u %9llu %10u %10llu %9llu\n", s_steps[i].name, s_steps[i].duration_ms,
+               r->wakeups, r->num_frames, (unsigned long long) r->render_us, r->render_us_max,
+               (unsigned long long) r->area_px, (unsigned long long) r->bytes);
+        if (verbose) {
+            for (uint32_t k = 0; k < r->num_frames; k++) {
+                const bench_frame_t *fr = &s_frames[r->first_frame + k];
+                printf("    t=%6u ms  render %6u us  area %6u px  %6u bytes  %u flushes\n",
+                       fr->t_ms, fr->render_us, fr->area_px, fr->bytes, fr->flushes);
+            }
+        }
+    }
+
+    ui_img_stats_t img;
+    ui_img_get_stats(&img);
+    printf("\nimages: %u decodes in %u us, %u cache hits, %u lines in %u us, cache peak %u bytes\n",
+           img.decodes, img.decode_us, img.hits, img.lines, img.line_us, img.cache_peak);
+}
+
+static uint32_t bench_lv_mem_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static lv_obj_t *bench_build(const char *name, lv_obj_t *(*create)(void))
+{
+    uint32_t before = bench_lv_mem_used();
+    lv_obj_t *scr = create();
+
+    s_screen_mem[s_num_screen_mem].name = name;
+    s_screen_mem[s_num_screen_mem].bytes = bench_lv_mem_used() - before;
+    s_num_screen_mem++;
+    return scr;
+}
+
+static void bench_print_mem(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    printf("\nlvgl heap: %u of %u bytes used, peak %u;", (unsigned) (mon.total_size - mon.free_size),
+           (unsigned) mon.total_size, (unsigned) mon.max_used);
+    for (int i = 0; i < s_num_screen_mem; i++)
+        printf(" %s %u", s_screen_mem[i].name, s_screen_mem[i].bytes);
+    printf("\n");
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+int main(int argc, char **argv)
+{
+    const char *out = "bench_results.json";
+    int verbose = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            out = argv[++i];
+        } else if (strcmp(argv[i], "-v") == 0) {
+            verbose = 1;
+        } else {
+            fprintf(stderr, "usage: %s [-o results.json] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    lv_init();
+    ui_img_init();
+    ui_img_add_builtin();
+    bench_hal_init();
+
+    s_scr_splash = bench_build("splash", ui_splash_create);
+    s_scr_blank = bench_build("blank", ui_blank_create);
+    s_scr_idle = bench_build("idle", ui_idle_create);
+    s_scr_access = bench_build("access", ui_access_create);
+    s_scr_info = bench_build("info", ui_info_create);
+    s_scr_ota = bench_build("ota", ui_ota_create);
+
+    /* settle whatever the default screen draws before measuring */
+    bench_result_t warmup = { 0 };
+    bench_run(100, &warmup);
+
+    bench_result_t res[BENCH_NUM_STEPS];
+    memset(res, 0, sizeof(res));
+
+    for (size_t i = 0; i < BENCH_NUM_STEPS; i++) {
+        bench_result_t *r = &res[i];
+
+        r->first_frame = s_num_frames;
+        if (s_steps[i].action)
+            s_steps[i].action();
+        bench_run(s_steps[i].duration_ms, r);
+
+        r->num_frames = s_num_frames - r->first_frame;
+        for (uint32_t k = 0; k < r->num_frames; k++) {
+            const bench_frame_t *fr = &s_frames[r->first_frame + k];
+            r->render_us += fr->render_us;
+            if (fr->render_us > r->render_us_max)
+                r->render_us_max = fr->render_us;
+            r->area_px += fr->area_px;
+            r->bytes += fr->bytes;
+        }
+        r->fb_hash = bench_fb_hash();
+    }
+
+    bench_print_table(res, verbose);
+    bench_print_mem();
+
+    FILE *f = fopen(out, "w");
+    if (!f) {
+        perror(out);
+        return 1;
+    }
+    bench_write_json(f, res);
+    fclose(f);
+    printf("\nresults written to %s\n", out);
+
+    return 0;
+}
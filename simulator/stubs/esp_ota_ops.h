@@ -0,0 +1,24 @@
+#ifndef _ESP_OTA_OPS_STUB_H
+#define _ESP_OTA_OPS_STUB_H
+
+/* Minimal stand-in for the ESP-IDF header so ui_info.c builds in the simulator. */
+
+typedef struct {
+    char version[32];
+    char project_name[32];
+    char time[16];
+    char date[16];
+} esp_app_desc_t;
+
+static inline const esp_app_desc_t *esp_ota_get_app_description(void)
+{
+    static const esp_app_desc_t desc = {
+        .version = "simulator",
+        .project_name = "uratt",
+        .time = __TIME__,
+        .date = __DATE__,
+    };
+    return &desc;
+}
+
+#endif
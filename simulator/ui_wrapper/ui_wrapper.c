@@ -3,7 +3,8 @@
 #include "ui/ui_splash.h"
 #include "ui/ui_idle.h"
 #include "ui/ui_access.h"
-#include "ui/ui_sleep.h"
+#include "ui/ui_blank.h"
+#include "ui/ui_img.h"
 
 typedef struct {
     lv_obj_t *scr;
@@ -21,7 +22,7 @@ static lv_timer_t* ui_timer;
 static lv_obj_t* ui_splash;
 static lv_obj_t* ui_idle;
 static lv_obj_t* ui_access;
-static lv_obj_t* ui_sleep;
+static lv_obj_t* ui_blank;
 
 void progress_cb(lv_timer_t * timer)
 {
@@ -111,9 +112,7 @@ void ui_timer_cb(lv_timer_t * timer)
     } else if (count == 518) {
         lv_scr_load(ui_idle);
     } else if (count == 520) {
-        lv_scr_load(ui_sleep);
-    } else if (count > 520 && count < 530) {
-        ui_sleep_set_countdown(10 - (count - 520));
+        lv_scr_load_anim(ui_blank, LV_SCR_LOAD_ANIM_FADE_ON, 500, 0, false);
     }
 
     count++;
@@ -122,10 +121,13 @@ void ui_timer_cb(lv_timer_t * timer)
 }
 void ui_wrapper(void)
 {
+    ui_img_init();
+    ui_img_add_builtin();
+
     ui_splash = ui_splash_create();
     ui_idle = ui_idle_create();
     ui_access = ui_access_create();
-    ui_sleep = ui_sleep_create();
+    ui_blank = ui_blank_create();
 
     static ui_timer_context_t ui_tim_ctx = {
         .count_val = 0,